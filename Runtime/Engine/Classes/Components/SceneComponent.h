@@ -230,6 +230,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category=Rendering)
 	uint8 bUseAttachParentBound:1;
 
+	/**
+	 * If true, moving this component does not immediately update the components attached to it. Instead they are updated once at the end of the
+	 * current tick group, however many times this component moved, so their transforms, bounds and render state lag behind until then.
+	 * Useful for deep hierarchies that are moved several times per frame. Only takes effect while SceneComponent.DeferChildTransformUpdates is set.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=Transform)
+	uint8 bDeferChildTransformUpdates:1;
+
 	/** Clears the skip update overlaps flag. This should be called any time a change to state would prevent the result of UpdateOverlaps. For example attachment, changing collision settings, etc... */
 	void ClearSkipUpdateOverlaps();
 
@@ -258,10 +266,20 @@ private:
 	uint8 bNetUpdateTransform : 1;
 	uint8 bNetUpdateAttachment : 1;
 
+	/** True if this component moved while bDeferChildTransformUpdates was set and its children have not been updated yet. */
+	uint8 bPendingDeferredChildTransformUpdate : 1;
+
 public:
 	/** Global flag to enable/disable overlap optimizations, settable with p.SkipUpdateOverlapsOptimEnabled cvar */ 
 	static int32 SkipUpdateOverlapsOptimEnabled;
 
+	/**
+	 * Updates the children of every component that deferred its child transform updates (see bDeferChildTransformUpdates).
+	 * Hierarchies are resolved from the top down, so a hierarchy in which several components moved is only updated once.
+	 * Called at the end of each tick group and before end of frame updates.
+	 */
+	static void FlushDeferredChildTransformUpdates();
+
 #if WITH_EDITORONLY_DATA
 	/** This component should create a sprite component for visualization in the editor */
 	UPROPERTY()
@@ -913,6 +931,12 @@ protected:
 
 private:
 	void PropagateTransformUpdate(bool bTransformChanged, EUpdateTransformFlags UpdateTransformFlags = EUpdateTransformFlags::None, ETeleportType Teleport = ETeleportType::None);
+
+	/** Queues the update of this component's children for FlushDeferredChildTransformUpdates if deferral is enabled. Returns false if the children must be updated now. */
+	bool TryDeferChildTransformUpdate(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Updates the children of the highest component above or at this one that deferred its child transform updates, leaving other hierarchies queued. */
+	void FlushDeferredChildTransformUpdatesInHierarchy();
 	void UpdateComponentToWorldWithParent(USceneComponent* Parent, FName SocketName, EUpdateTransformFlags UpdateTransformFlags, const FQuat& RelativeRotationQuat, ETeleportType Teleport = ETeleportType::None);
 
 public:
@@ -1923,6 +1947,8 @@ FORCEINLINE_DEBUGGABLE bool USceneComponent::UpdateOverlaps(const TOverlapArrayV
 	}
 	else if (!ShouldSkipUpdateOverlaps())
 	{
+		// Overlaps are computed from the transforms of this component and its children, so they must not be stale.
+		FlushDeferredChildTransformUpdatesInHierarchy();
 		bSkipUpdateOverlaps = UpdateOverlapsImpl(PendingOverlaps, bDoNotifies, OverlapsAtEndLocation);
 	}
 
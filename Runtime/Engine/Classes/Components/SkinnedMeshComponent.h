@@ -7,6 +7,7 @@
 #include "GPUSkinPublicDefs.h"
 #include "UObject/ObjectMacros.h"
 #include "UObject/Object.h"
+#include "HAL/IConsoleManager.h"
 #include "Engine/EngineTypes.h"
 #include "Components/SceneComponent.h"
 #include "Engine/TextureStreamingTypes.h"
@@ -1556,6 +1557,21 @@ public:
 	/** Animation Update Rate optimization parameters. */
 	struct FAnimUpdateRateParameters* AnimUpdateRateParams;
 
+private:
+	/** Animation update rate the skeletal mesh LOD streaming data was last gathered with, 1 or r.Streaming.SkeletalMeshAnimUpdateRateThreshold, see GetStreamingRenderAssetInfo(). */
+	int32 StreamingAnimUpdateRate;
+
+	/** Updates StreamingAnimUpdateRate from the animation update rate, gathering the streaming data again when it changes or when bForceGather is true. */
+	void UpdateStreamingAnimUpdateRate(bool bForceGather);
+
+	// Called when CVars are changed to gather the streaming data of components again when the streaming anim update rate settings change
+	static void OnStreamingCVarsChanged();
+
+	// Sink for when CVars are changed to check to see if the streaming anim update rate settings have changed
+	static FAutoConsoleVariableSink StreamingCVarSink;
+
+public:
+
 	virtual bool IsPlayingRootMotion() const { return false; }
 	virtual bool IsPlayingNetworkedRootMotionMontage() const { return false; }
 	virtual bool IsPlayingRootMotionFromEverything() const { return false; }
@@ -39,10 +39,28 @@ class ENGINE_API UCurveFloat : public UCurveBase
 	UPROPERTY()
 	bool	bIsEventCurve;
 
+	/**
+	 * If true, cooked builds bake the curve when it is loaded so that GetFloatValue doesn't search the keys.
+	 * Changes made to FloatCurve afterwards are ignored by GetFloatValue. See FBakedRichCurve.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=Baking)
+	bool	bBakeOnLoad;
+
+	/** Largest difference from the keys allowed for the baked curve. The keys are used if the baked curve can't meet it. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=Baking, meta=(EditCondition="bBakeOnLoad", ClampMin="0"))
+	float	BakeMaxError;
+
 	/** Evaluate this float curve at the specified time */
 	UFUNCTION(BlueprintCallable, Category="Math|Curves")
 	float GetFloatValue(float InTime) const;
 
+	/** Returns the baked curve, which isn't baked unless bBakeOnLoad is set and this is a cooked build */
+	const FBakedRichCurve& GetBakedCurve() const { return BakedCurve; }
+
+	//~ Begin UObject Interface.
+	virtual void PostLoad() override;
+	//~ End UObject Interface.
+
 	// Begin FCurveOwnerInterface
 	virtual TArray<FRichCurveEditInfoConst> GetCurves() const override;
 	virtual TArray<FRichCurveEditInfo> GetCurves() override;
@@ -50,5 +68,9 @@ class ENGINE_API UCurveFloat : public UCurveBase
 
 	/** Determine if Curve is the same */
 	bool operator == (const UCurveFloat& Curve) const;
+
+private:
+	/** FloatCurve baked on load */
+	FBakedRichCurve BakedCurve;
 };
 
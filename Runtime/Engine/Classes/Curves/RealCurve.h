@@ -136,6 +136,8 @@ public:
 	virtual void RemoveRedundantKeys(float Tolerance, float FirstKeyTime, float LastKeyTime) PURE_VIRTUAL(FRealCurve::RemoveRedundantKeys, );
 
 protected:
+	friend struct FBakedRichCurve;
+
 	static void CycleTime(float MinTime, float MaxTime, float& InTime, int& CycleCount);
 	virtual int32 GetKeyIndex(float KeyTime, float KeyTimeTolerance) const PURE_VIRTUAL(FRealCurve::GetKeyIndex, return INDEX_NONE;);
 
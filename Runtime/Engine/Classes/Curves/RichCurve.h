@@ -419,6 +419,87 @@ struct TStructOpsTypeTraits<FCompressedRichCurve>
 	};
 };
 
+/**
+ * Runtime only representation of a FRichCurve for fast evaluation, produced from the keys at load.
+ * The time range of the keys is cut into uniform segments, each holding the coefficients of a cubic fitted to the exact curve,
+ * so evaluating it is a multiply to find the segment and a polynomial, without key search nor per key interpolation mode dispatch.
+ * Baking validates the result against the exact evaluation and refines the segments until the requested precision is met.
+ */
+struct ENGINE_API FBakedRichCurve
+{
+	FBakedRichCurve();
+
+	/**
+	 * Bakes the curve, starting with SampleRate segments per second and doubling them until the error against FRichCurve::Eval is at most MaxError.
+	 * Returns false, leaving this curve empty, if the curve has no keys or the precision can't be reached with MaxSegments segments.
+	 */
+	bool Bake(const FRichCurve& Curve, float MaxError = 0.001f, float SampleRate = 30.0f, int32 MaxSegments = 4096);
+
+	/** Releases the baked data. */
+	void Reset();
+
+	/** Whether the curve has been baked successfully */
+	bool IsBaked() const { return NumSegments > 0; }
+
+	/** Largest error against the exact evaluation measured while baking */
+	float GetMaxError() const { return MaxError; }
+
+	/** Evaluates the curve at the specified time */
+	float Eval(float InTime) const;
+
+	/** Evaluates the curve at each of InTimes, four times at once. OutValues must have as many entries as InTimes. */
+	void EvalTimes(TArrayView<const float> InTimes, TArrayView<float> OutValues) const;
+
+	/** Evaluates each of the baked Curves at the specified time, four curves at once. OutValues must have as many entries as Curves. */
+	static void EvalCurves(TArrayView<const FBakedRichCurve* const> Curves, float InTime, TArrayView<float> OutValues);
+
+	/** Returns the memory allocated by the baked data */
+	SIZE_T GetAllocatedSize() const { return Coefficients.GetAllocatedSize(); }
+
+private:
+	/** Applies the cycling extrapolation modes to InTime, returning the value offset to add for RCCE_CycleWithOffset */
+	float RemapTime(float& InTime) const;
+
+	/** Returns the coefficients of the segment containing InTime, which must be remapped, and the position of InTime in that segment */
+	const float* GetSegment(float InTime, float& OutAlpha) const;
+
+	/** Returns the offset added by linear extrapolation at InTime */
+	float GetExtrapolationOffset(float InTime) const
+	{
+		return FMath::Min(InTime - StartTime, 0.0f) * PreInfinitySlope + FMath::Max(InTime - EndTime, 0.0f) * PostInfinitySlope;
+	}
+
+	/** Cubic coefficients of each segment, highest degree first, for a position in [0, 1] within the segment */
+	TArray<float> Coefficients;
+
+	/** Time range of the keys */
+	float StartTime;
+	float EndTime;
+
+	/** Number of segments per second */
+	float SegmentsPerSecond;
+
+	/** Number of segments */
+	int32 NumSegments;
+
+	/** Slopes of the linear extrapolations, zero when the extrapolation is constant or cycling */
+	float PreInfinitySlope;
+	float PostInfinitySlope;
+
+	/** Difference between the last and first key values, for RCCE_CycleWithOffset */
+	float CycleValueDelta;
+
+	/** Extrapolation modes, only needed to cycle */
+	TEnumAsByte<ERichCurveExtrapolation> PreInfinityExtrap;
+	TEnumAsByte<ERichCurveExtrapolation> PostInfinityExtrap;
+
+	/** Whether any of the extrapolation modes cycles, otherwise time is never remapped */
+	bool bCycles;
+
+	/** Largest error measured while baking */
+	float MaxError;
+};
+
 /**
  * Info about a curve to be edited.
  */
@@ -45,6 +45,9 @@ class UCompositeDataTable
 	ENGINE_API virtual void RemoveRow(FName RowName) override;
 	ENGINE_API virtual void AddRow(FName RowName, const FTableRowBase& RowData) override;
 
+	/** Composite data tables index the columns indexed by their parent tables as well as their own */
+	ENGINE_API virtual void GetSecondaryIndexPropertyNames(TArray<FName>& OutPropertyNames) const override;
+
 #if WITH_EDITOR
 	ENGINE_API virtual void CleanBeforeStructChange() override;
 	ENGINE_API virtual void RestoreAfterStructChange() override;
@@ -134,6 +134,8 @@ extern ENGINE_API float GPriorityLevelStreamingActorsUpdateExtraTime;
 extern ENGINE_API int32 GLevelStreamingComponentsRegistrationGranularity;
 /** Batching granularity used to unregister actor components during level streaming.  */
 extern ENGINE_API int32 GLevelStreamingComponentsUnregistrationGranularity;
+/** Whether level streaming batches the scene proxy creation of the components registered during a frame and runs it on worker threads. */
+extern ENGINE_API int32 GLevelStreamingParallelComponentRegistration;
 /** Maximum allowed time to spend for actor unregistration steps during level streaming (ms per frame). If this is 0.0 then we don't timeslice.*/
 extern ENGINE_API float GLevelStreamingUnregisterComponentsTimeLimit;
 /** Whether to force a GC after levels are streamed out to instantly reclaim the memory at the expensive of a hitch. */
@@ -144,6 +146,10 @@ extern ENGINE_API int32 GLevelStreamingContinuouslyIncrementalGCWhileLevelsPendi
 extern ENGINE_API int32 GLevelStreamingAllowLevelRequestsWhileAsyncLoadingInMatch;
 /** When we're already loading this many levels and actively in match, don't allow any more requests until one of those completes.  Set to zero to disable. */
 extern ENGINE_API int32 GLevelStreamingMaxLevelRequestsAtOnceWhileInMatch;
+/** Game thread time shared by all AddToWorld and RemoveFromWorld calls in a frame (ms per frame). If this is 0.0 each call only uses its own time limit. */
+extern ENGINE_API float GLevelStreamingFrameTimeBudget;
+/** Whether streaming levels of equal priority are updated in order of distance to the streaming views, so the nearest levels load and become visible first. */
+extern ENGINE_API int32 GLevelStreamingOrderByViewDistance;
 
 
 /**
@@ -59,6 +59,82 @@ struct FTableRowBase
 };
 
 
+/** Key of a row in a secondary index, numeric, enum and bool properties are keyed by Number and name properties by Name */
+struct FDataTableIndexKey
+{
+	double Number;
+	FName Name;
+
+	FDataTableIndexKey()
+		: Number(0.0)
+		, Name(NAME_None)
+	{
+	}
+
+	explicit FDataTableIndexKey(double InNumber)
+		: Number(InNumber)
+		, Name(NAME_None)
+	{
+	}
+
+	explicit FDataTableIndexKey(FName InName)
+		: Number(0.0)
+		, Name(InName)
+	{
+	}
+
+	/** Orders keys by number, then lexically by name */
+	bool operator<(const FDataTableIndexKey& Other) const
+	{
+		return Number != Other.Number ? Number < Other.Number : Name.Compare(Other.Name) < 0;
+	}
+};
+
+/** Rows of a data table sorted by the value of one of their properties, see UDataTable::IndexedProperties */
+struct ENGINE_API FDataTableSecondaryIndex
+{
+	struct FEntry
+	{
+		FDataTableIndexKey Key;
+		FName RowName;
+		uint8* RowData;
+	};
+
+	/** Name of the indexed column */
+	FName PropertyName;
+
+	/** Indexed property of the row struct */
+	const FProperty* Property;
+
+	/** Rows sorted by key */
+	TArray<FEntry> Entries;
+
+	FDataTableSecondaryIndex()
+		: Property(nullptr)
+	{
+	}
+
+	/** Returns the rows whose key is within [Min, Max], valid until the table changes */
+	TArrayView<const FEntry> GetEntriesInRange(const FDataTableIndexKey& Min, const FDataTableIndexKey& Max) const;
+
+	/** Returns the key of a row */
+	FDataTableIndexKey GetKey(const uint8* RowData) const;
+
+	/** Adds or removes a row, keeping the entries sorted */
+	void AddRow(FName RowName, uint8* RowData);
+	void RemoveRow(uint8* RowData);
+
+	/** Points the entry of a row to a copy of it, with the same key, that replaces it */
+	void ReplaceRowData(const uint8* OldRowData, uint8* NewRowData);
+
+	/** Returns the entry of a row, looked up by its key first, INDEX_NONE if it isn't indexed */
+	int32 FindEntryIndex(const uint8* RowData, const FDataTableIndexKey& Key) const;
+
+	/** Returns whether rows can be indexed by a property: numeric, enum, bool and name properties can */
+	static bool CanIndexProperty(const FProperty* Property);
+};
+
+
 /**
  * Imported spreadsheet table.
  */
@@ -85,7 +161,7 @@ protected:
 	TMap<FName, uint8*>		RowMap;
 
 	// TODO: remove this, it is temporarily here to allow DataTableEditorUtils to compile until I get around to updating functions like RemoveRow and RenameRow
-	virtual TMap<FName, uint8*>& GetNonConstRowMap() { return RowMap; }
+	virtual TMap<FName, uint8*>& GetNonConstRowMap() { UnpackRows(); return RowMap; }
 
 	/** Called to add rows to the data table */
 	ENGINE_API virtual void AddRowInternal(FName RowName, uint8* RowDataPtr);
@@ -103,6 +179,23 @@ public:
 	UPROPERTY(EditAnywhere, Category=DataTable)
 	uint8 bStripFromClientBuilds : 1;
 
+	/**
+	 * Set to true to construct the rows contiguously in a single allocation when the table is loaded or imported, and to index them by name
+	 * in an open addressing table. Speeds up FindRow on large tables and lets TDataTableRowIndex find rows again without hashing their name.
+	 * Rows added later are moved into the allocation when the change ends. When they don't fit, every row moves to a larger allocation,
+	 * so row pointers returned by FindRow must not be kept across AddRow, RemoveRow or imports of a packed table.
+	 */
+	UPROPERTY(EditAnywhere, Category=DataTable)
+	uint8 bPackRows : 1;
+
+	/**
+	 * Columns to build secondary indices for, so that FindRowsByIndexedValue and FindRowsInIndexedRange can find rows by their value without going through every row.
+	 * Numeric, enum, bool and name columns can be indexed. Indices are built when the table is loaded or imported and kept up to date by AddRow and RemoveRow.
+	 * Changing an indexed value in place, through a row returned by FindRow, leaves the row sorted under its old value: pass the changed row to AddRow to update the indices.
+	 */
+	UPROPERTY(EditAnywhere, Category=DataTable)
+	TArray<FName> IndexedProperties;
+
 	/** Set to true to ignore extra fields in the import data, if false it will warn about them */
 	UPROPERTY(EditAnywhere, Category=ImportOptions)
 	uint8 bIgnoreExtraFields : 1;
@@ -219,8 +312,8 @@ public:
 			return nullptr;
 		}
 
-		uint8* const* RowDataPtr = GetRowMap().Find(RowName);
-		if (RowDataPtr == nullptr)
+		uint8* RowData = FindRowData(RowName);
+		if (RowData == nullptr)
 		{
 			if (bWarnIfRowMissing)
 			{
@@ -229,9 +322,6 @@ public:
 			return nullptr;
 		}
 
-		uint8* RowData = *RowDataPtr;
-		check(RowData);
-
 		return reinterpret_cast<T*>(RowData);
 	}
 
@@ -241,6 +331,70 @@ public:
 		return FindRow<T>(RowName, *ContextString, bWarnIfRowMissing);
 	}
 
+	/** Finds the rows of a table given their names, OutRows[Index] receives the row named RowNames[Index] or nullptr if there is none. */
+	template <class T>
+	void FindRows(TArrayView<const FName> RowNames, TArrayView<T*> OutRows, const TCHAR* ContextString) const
+	{
+		check(RowNames.Num() == OutRows.Num());
+
+		if (RowStruct == nullptr || !RowStruct->IsChildOf(T::StaticStruct()))
+		{
+			UE_LOG(LogDataTable, Error, TEXT("UDataTable::FindRows : '%s' specified %s for DataTable '%s'."), ContextString, RowStruct ? TEXT("incorrect type") : TEXT("no row"), *GetPathName());
+			for (T*& Row : OutRows)
+			{
+				Row = nullptr;
+			}
+			return;
+		}
+
+		FindRowsUnchecked(RowNames, TArrayView<uint8*>(reinterpret_cast<uint8**>(OutRows.GetData()), OutRows.Num()));
+	}
+
+	/** Finds the rows whose indexed property is within [Min, Max] and adds them to OutRows. Returns false if the property isn't one of IndexedProperties. */
+	template <class T>
+	bool FindRowsInIndexedRange(FName PropertyName, const FDataTableIndexKey& Min, const FDataTableIndexKey& Max, TArray<T*>& OutRows, const TCHAR* ContextString) const
+	{
+		if (RowStruct == nullptr)
+		{
+			UE_LOG(LogDataTable, Error, TEXT("UDataTable::FindRowsInIndexedRange : '%s' specified no row for DataTable '%s'."), ContextString, *GetPathName());
+			return false;
+		}
+
+		if (!RowStruct->IsChildOf(T::StaticStruct()))
+		{
+			UE_LOG(LogDataTable, Error, TEXT("UDataTable::FindRowsInIndexedRange : '%s' specified incorrect type for DataTable '%s'."), ContextString, *GetPathName());
+			return false;
+		}
+
+		const FDataTableSecondaryIndex* SecondaryIndex = FindSecondaryIndex(PropertyName);
+		if (SecondaryIndex == nullptr)
+		{
+			UE_LOG(LogDataTable, Warning, TEXT("UDataTable::FindRowsInIndexedRange : '%s' requested column '%s' which isn't indexed in DataTable '%s'."), ContextString, *PropertyName.ToString(), *GetPathName());
+			return false;
+		}
+
+		const TArrayView<const FDataTableSecondaryIndex::FEntry> Entries = SecondaryIndex->GetEntriesInRange(Min, Max);
+		OutRows.Reserve(OutRows.Num() + Entries.Num());
+		for (const FDataTableSecondaryIndex::FEntry& Entry : Entries)
+		{
+			OutRows.Add(reinterpret_cast<T*>(Entry.RowData));
+		}
+		return true;
+	}
+
+	/** Finds the rows whose indexed property equals Value and adds them to OutRows. Returns false if the property isn't one of IndexedProperties. */
+	template <class T>
+	bool FindRowsByIndexedValue(FName PropertyName, const FDataTableIndexKey& Value, TArray<T*>& OutRows, const TCHAR* ContextString) const
+	{
+		return FindRowsInIndexedRange<T>(PropertyName, Value, Value, OutRows, ContextString);
+	}
+
+	/** Returns the secondary index of a column, nullptr if it isn't indexed */
+	ENGINE_API const FDataTableSecondaryIndex* FindSecondaryIndex(FName PropertyName) const;
+
+	/** Returns the columns to build secondary indices for */
+	ENGINE_API virtual void GetSecondaryIndexPropertyNames(TArray<FName>& OutPropertyNames) const;
+
 	/** Perform some operation for every row. */
 	template <class T>
 	void ForeachRow(const TCHAR* ContextString, TFunctionRef<void (const FName& Key, const T& Value)> Predicate) const
@@ -286,19 +440,40 @@ public:
 			return nullptr;
 		}
 
-		uint8* const* RowDataPtr = GetRowMap().Find(RowName);
+		return FindRowData(RowName);
+	}
+
+	/** Finds the rows given their names without checking their type, OutRowData[Index] receives the row named RowNames[Index] or nullptr if there is none. */
+	ENGINE_API void FindRowsUnchecked(TArrayView<const FName> RowNames, TArrayView<uint8*> OutRowData) const;
 
-		if(RowDataPtr == nullptr)
+	/** Returns the position of the row in the packed row index, INDEX_NONE if there is no such row or the rows aren't packed. See bPackRows. */
+	int32 FindRowIndex(FName RowName) const
+	{
+		if (RowIndexSlots.Num() == 0)
 		{
-			return nullptr;
+			return INDEX_NONE;
 		}
 
-		uint8* RowData = *RowDataPtr;
-		check(RowData);
-
-		return RowData;
+		const uint32 SlotMask = RowIndexSlots.Num() - 1;
+		for (uint32 Slot = HashRowName(RowName); ; Slot = (Slot + 1) & SlotMask)
+		{
+			const int32 RowIndex = RowIndexSlots[Slot];
+			if (RowIndex == INDEX_NONE || IndexedRowNames[RowIndex] == RowName)
+			{
+				return RowIndex;
+			}
+		}
 	}
 
+	/** Returns the row at a position returned by FindRowIndex, valid as long as GetRowIndexSerial doesn't change */
+	uint8* GetRowDataByIndex(int32 RowIndex) const { return IndexedRowData[RowIndex]; }
+
+	/** Changes whenever the packed row index is rebuilt or invalidated */
+	uint32 GetRowIndexSerial() const { return RowIndexSerial; }
+
+	/** Moves the rows to a single allocation and indexes them, see bPackRows. */
+	ENGINE_API void PackRows();
+
 	/** Empty the table info (will not clear RowStruct) */
 	ENGINE_API virtual void EmptyTable();
 
@@ -388,6 +563,78 @@ protected:
 
 	UScriptStruct& GetEmptyUsingStruct() const;
 
+	/** Looks the row up in the packed row index if there is one, in the row map otherwise */
+	uint8* FindRowData(FName RowName) const
+	{
+		if (RowIndexSlots.Num() > 0)
+		{
+			const int32 RowIndex = FindRowIndex(RowName);
+			return RowIndex != INDEX_NONE ? IndexedRowData[RowIndex] : nullptr;
+		}
+
+		uint8* const* RowDataPtr = GetRowMap().Find(RowName);
+		return RowDataPtr ? *RowDataPtr : nullptr;
+	}
+
+	/** Returns the first slot to probe for a row name in RowIndexSlots, using Fibonacci hashing of its comparison index and number */
+	uint32 HashRowName(FName RowName) const
+	{
+		return ((GetTypeHash(RowName.GetComparisonIndex()) + RowName.GetNumber()) * 0x9E3779B1u) >> RowIndexHashShift;
+	}
+
+	/** Rebuilds the packed row index from the row map if bPackRows is set */
+	void BuildRowIndex();
+
+	/** Drops the packed row index, lookups use the row map until it is rebuilt */
+	void ResetRowIndex();
+
+	/** Returns whether a row lives in the packed row allocation */
+	bool IsPackedRowData(const uint8* RowData) const
+	{
+		return RowData >= PackedRows && RowData < PackedRows + PackedRowsSize;
+	}
+
+	/** Moves the rows back to their own allocation so that they can be freed individually, and drops the packed row index */
+	void UnpackRows();
+
+	/** Builds the secondary indices of IndexedProperties from the row map */
+	void BuildSecondaryIndices();
+
+	/** Drops the secondary indices, they are rebuilt when the table changes next */
+	void ResetSecondaryIndices();
+
+	/** Destroys a row, freeing its memory unless it lives in the packed row allocation */
+	void FreeRowData(UScriptStruct& UsingStruct, uint8* RowData);
+
+	/** Returns the distance between two rows in the packed row allocation */
+	static int32 GetPackedRowStride(const UScriptStruct& UsingStruct);
+
+	/** Rows constructed contiguously by PackRows or when loading with bPackRows, the rows are destroyed individually but the allocation is only freed by EmptyTable */
+	uint8* PackedRows;
+	SIZE_T PackedRowsSize;
+
+	/** Bytes of PackedRows holding rows, including rows removed since, the rest is room for rows added later */
+	SIZE_T PackedRowsUsedSize;
+
+	/** Names and data of the rows in a stable order, what RowIndexSlots indexes */
+	TArray<FName> IndexedRowNames;
+	TArray<uint8*> IndexedRowData;
+
+	/** Open addressing table of positions in IndexedRowNames, INDEX_NONE for empty slots. Its size is a power of two, empty when there is no index */
+	TArray<int32> RowIndexSlots;
+
+	/** Shift turning a 32 bit hash into a slot of RowIndexSlots */
+	uint32 RowIndexHashShift;
+
+	/** Incremented whenever the packed row index changes */
+	uint32 RowIndexSerial;
+
+	/** Rows sorted by each of the indexed properties */
+	TArray<FDataTableSecondaryIndex> SecondaryIndices;
+
+	/** Whether SecondaryIndices match the rows, otherwise they are rebuilt when the table changes next */
+	bool bSecondaryIndicesValid;
+
 	/** Used to trigger the data table changed delegate. This allows us to trigger the delegate only once from more complex changes */
 	struct FScopedDataTableChange
 	{
@@ -476,6 +723,64 @@ struct TStructOpsTypeTraits< FDataTableRowHandle > : public TStructOpsTypeTraits
 	};
 };
 
+/**
+ * Typed handle to a row of a table packing its rows (see UDataTable::bPackRows).
+ * The row is looked up by name the first time, then by its position in the table as long as the rows of the table don't change, skipping hashing and the type check.
+ * It doesn't keep the table alive, GetRow returns nullptr once the table is destroyed.
+ */
+template <class T>
+struct TDataTableRowIndex
+{
+	TDataTableRowIndex()
+		: RowName(NAME_None)
+		, RowIndex(INDEX_NONE)
+		, RowIndexSerial(0)
+	{
+	}
+
+	TDataTableRowIndex(const UDataTable* InDataTable, FName InRowName)
+		: DataTable(InDataTable)
+		, RowName(InRowName)
+		, RowIndex(INDEX_NONE)
+		, RowIndexSerial(0)
+	{
+	}
+
+	explicit TDataTableRowIndex(const FDataTableRowHandle& RowHandle)
+		: TDataTableRowIndex(RowHandle.DataTable, RowHandle.RowName)
+	{
+	}
+
+	/** Get the row, from the cached position when it is still valid */
+	T* GetRow(const TCHAR* ContextString) const
+	{
+		const UDataTable* Table = DataTable.Get();
+		if (Table == nullptr)
+		{
+			return nullptr;
+		}
+
+		if (RowIndex != INDEX_NONE && RowIndexSerial == Table->GetRowIndexSerial())
+		{
+			return reinterpret_cast<T*>(Table->GetRowDataByIndex(RowIndex));
+		}
+
+		T* Row = Table->FindRow<T>(RowName, ContextString);
+		RowIndex = Row ? Table->FindRowIndex(RowName) : INDEX_NONE;
+		RowIndexSerial = Table->GetRowIndexSerial();
+		return Row;
+	}
+
+	const UDataTable* GetDataTable() const { return DataTable.Get(); }
+	FName GetRowName() const { return RowName; }
+
+private:
+	TWeakObjectPtr<const UDataTable> DataTable;
+	FName RowName;
+	mutable int32 RowIndex;
+	mutable uint32 RowIndexSerial;
+};
+
 /** Handle to a particular set of rows in a table */
 USTRUCT(BlueprintType)
 struct ENGINE_API FDataTableCategoryHandle
@@ -497,6 +497,13 @@ public:
 	UPROPERTY()
 	TArray<FGuid> StreamingTextureGuids;
 
+	/**
+	 * Actors validated at cook time as needing no initialization work (see AActor::CanSkipInitializationWhenStreamed).
+	 * RouteActorInitialize flags them initialized directly when this level is streamed in, never when it is the persistent level. Only filled in cooked packages.
+	 */
+	UPROPERTY()
+	TArray<AActor*> PreInitializedActors;
+
 	/** Data structures for holding the tick functions **/
 	class FTickTaskLevel*						TickTaskLevel;
 
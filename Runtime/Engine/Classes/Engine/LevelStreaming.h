@@ -554,8 +554,18 @@ private:
 	static bool DetermineTargetState(ULevelStreaming* StreamingLevel) { return StreamingLevel->DetermineTargetState(); }
 	/** Update the load process of the streaming level. Out parameters instruct calling code how to proceed. */
 	static void UpdateStreamingState(ULevelStreaming* StreamingLevel, bool& bOutUpdateAgain, bool& bOutRedetermineTarget) { StreamingLevel->UpdateStreamingState(bOutUpdateAgain, bOutRedetermineTarget); }
+	/** Returns whether the streaming level is heading towards being unloaded or hidden. */
+	static bool IsStreamingOut(const ULevelStreaming* StreamingLevel)
+	{
+		using ECurrentState = ULevelStreaming::ECurrentState;
+		using ETargetState = ULevelStreaming::ETargetState;
+		return StreamingLevel->TargetState == ETargetState::Unloaded
+			|| StreamingLevel->TargetState == ETargetState::UnloadedAndRemoved
+			|| (StreamingLevel->TargetState == ETargetState::LoadedNotVisible && (StreamingLevel->CurrentState == ECurrentState::LoadedVisible || StreamingLevel->CurrentState == ECurrentState::MakingInvisible));
+	}
 
 	/** Friend classes to manipulate the streaming level more extensively */
 	friend class UEngine;
 	friend class UWorld;
+	friend struct FLevelStreamingScheduler;
 };
\ No newline at end of file
@@ -47,6 +47,7 @@ public:
 	virtual void PostLoad() override;	
 #endif // WITH_EDITOR
 	virtual void Serialize(FArchive& Ar) override;
+	virtual UClass* GetNativeInitializationClass() const override { return AStaticMeshActor::StaticClass(); }
 	//~ End AActor Interface
 
 	// INavRelevantInterface begin
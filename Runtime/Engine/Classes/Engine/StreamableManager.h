@@ -146,8 +146,8 @@ private:
 	/** Called from manager to complete the request */
 	void CompleteLoad();
 
-	/** Callback when async load finishes, it's here so we can use a shared pointer for callback safety */
-	void AsyncLoadCallbackWrapper(const FName& PackageName, UPackage* LevelPackage, EAsyncLoadingResult::Type Result, FSoftObjectPath TargetName);
+	/** Callback when async load of a package finishes, it's here so we can use a shared pointer for callback safety. TargetNames are the requested assets in that package */
+	void AsyncLoadCallbackWrapper(const FName& PackageName, UPackage* LevelPackage, EAsyncLoadingResult::Type Result, TArray<FSoftObjectPath> TargetNames);
 
 	/** Notify all parents that a child completed loading */
 	void NotifyParentsOfCompletion();
@@ -206,6 +206,12 @@ private:
 	/** How many of our children that have been canceled */
 	int32 CanceledChildCount = 0;
 
+	/** How many package requests issued for this handle haven't called back yet */
+	int32 PendingPackageRequests = 0;
+
+	/** Time the requests of this handle were started, to track load latency */
+	double RequestStartTime = 0.0;
+
 	/** List of assets that were referenced by this handle */
 	TArray<FSoftObjectPath> RequestedAssets;
 
@@ -346,16 +352,27 @@ private:
 	friend FStreamableHandle;
 
 	void RemoveReferencedAsset(const FSoftObjectPath& Target, TSharedRef<FStreamableHandle> Handle);
+	/** Handles whose streamables all finished loading, completed together once a batch of streamables has been checked */
+	struct FCompletedRequests
+	{
+		TArray<TSharedRef<FStreamableHandle>> HandlesToComplete;
+		TArray<TSharedRef<FStreamableHandle>> HandlesToRelease;
+	};
+
+	/** Package names to the targets of a handle in that package, so that a single async request is issued per package */
+	typedef TMap<FString, TArray<FSoftObjectPath>> TPackagesToLoad;
+
 	void StartHandleRequests(TSharedRef<FStreamableHandle> Handle);
 	void FindInMemory(FSoftObjectPath& InOutTarget, struct FStreamable* Existing);
 	FSoftObjectPath HandleLoadedRedirector(UObjectRedirector* LoadedRedirector, FSoftObjectPath RequestedPath, struct FStreamable* RequestedStreamable);
 	struct FStreamable* FindStreamable(const FSoftObjectPath& Target) const;
-	struct FStreamable* StreamInternal(const FSoftObjectPath& Target, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle);
+	struct FStreamable* StreamInternal(const FSoftObjectPath& Target, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle, TPackagesToLoad& OutPackagesToLoad);
 	UObject* GetStreamed(const FSoftObjectPath& Target) const;
-	void CheckCompletedRequests(const FSoftObjectPath& Target, struct FStreamable* Existing);
+	void CheckCompletedRequests(const FSoftObjectPath& Target, struct FStreamable* Existing, FCompletedRequests& OutCompletedRequests);
+	void CompleteRequests(FCompletedRequests& CompletedRequests);
 
 	void OnPreGarbageCollect();
-	void AsyncLoadCallback(FSoftObjectPath Request);
+	void AsyncLoadCallback(const TArray<FSoftObjectPath>& Requests);
 
 	/** Map of paths to streamable objects, this will be the post-redirector name */
 	typedef TMap<FSoftObjectPath, struct FStreamable*> TStreamableMap;
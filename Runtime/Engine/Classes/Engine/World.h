@@ -1021,6 +1021,18 @@ private:
 	UPROPERTY(Transient)
 	class ULevel*								CurrentLevelPendingInvisibility;
 
+	/** Frame in which LevelStreamingFrameTimeSpent was last reset. */
+	uint64										LevelStreamingFrameBudgetFrameNumber;
+
+	/** Game thread time in seconds AddToWorld and RemoveFromWorld have spent this frame, drawn from GLevelStreamingFrameTimeBudget. */
+	double										LevelStreamingFrameTimeSpent;
+
+	/** Clamps the time limit (ms) of an incremental AddToWorld or RemoveFromWorld call to what is left of this frame's shared level streaming budget. */
+	double ClampToLevelStreamingFrameBudget(double TimeLimit);
+
+	/** Charges the game thread time since StartTime to this frame's shared level streaming budget. */
+	void ChargeLevelStreamingFrameBudget(double StartTime);
+
 public:
 	/** NetDriver for capturing network traffic to record demos */
 	UE_DEPRECATED(4.26, "DemoNetDriver will be made private in a future release.  Please use GetDemoNetDriver/SetDemoNetDriver instead.")
@@ -5,6 +5,7 @@
 #include "UObject/ObjectMacros.h"
 #include "UObject/Object.h"
 #include "Misc/WorldCompositionUtility.h"
+#include "FlatQuadTree.h"
 #include "WorldComposition.generated.h"
 
 class ULevel;
@@ -130,6 +131,9 @@ class ENGINE_API UWorldComposition : public UObject
 	/** @returns Level bounding box in current shifted space */
 	FBox GetLevelBounds(ULevel* InLevel) const;
 
+	/** @returns Bounding box of the tile with the specified package name in current shifted space, invalid if there is no such tile */
+	FBox GetTileBounds(const FName& InPackageName) const;
+
 	/** Scans world root folder for relevant packages and initializes world composition structures */
 	void Rescan();
 
@@ -198,6 +202,15 @@ private:
 	/** @returns Whether specified streaming level is distance dependent */
 	bool IsDistanceDependentLevel(int32 TileIdx) const;
 
+	/** Marks tiles that could be within streaming distance of any of the provided locations, using the tiles spatial index */
+	void GetTilesNearLocations(const FVector* InLocations, int32 NumLocations, TBitArray<>& OutTilesNearLocations) const;
+
+	/** Tests a distance dependent tile against the provided locations and adds it to the visible or hidden levels */
+	void GetTileDistanceVisibility(int32 TileIdx, const FVector* InLocations, int32 NumLocations, TArray<FDistanceVisibleLevel>& OutVisibleLevels, TArray<FDistanceVisibleLevel>& OutHiddenLevels) const;
+
+	/** Discards the tiles spatial index, to be rebuilt on next use after tiles were added or moved */
+	void InvalidateTilesSpatialIndex();
+
 	/** Attempts to set new streaming state for a particular tile, could be rejected if state change on 'cooldown' */
 	bool CommitTileStreamingState(UWorld* PersistentWorld, int32 TileIdx, bool bShouldBeLoaded, bool bShouldBeVisible, bool bShouldBlock, int32 LODIdx);
 
@@ -218,6 +231,18 @@ private:
 	// List of all tiles participating in the world composition
 	FTilesList					Tiles;
 
+	// Tile indices keyed by tile bounds in absolute XY space, built on demand
+	mutable TUniquePtr<TFlatQuadTree<int32>> TilesSpatialIndex;
+
+	// Largest streaming distance of any tile LOD plus the hysteresis band, by which spatial index queries are grown
+	mutable float				TilesSpatialIndexQueryExtent;
+
+	// Distance dependent tiles the last streaming update left loaded, reevaluated on the next update even if no view is near them anymore
+	TArray<int32>				DistanceStreamedTiles;
+
+	// Whether DistanceStreamedTiles can be trusted, otherwise the next streaming update evaluates every tile
+	bool						bDistanceStreamedTilesValid;
+
 public:
 	// Streaming level objects for each tile
 	UPROPERTY(transient)
@@ -227,6 +252,10 @@ public:
 	UPROPERTY(config)
 	double						TilesStreamingTimeThreshold;
 
+	// Extra distance past a tile LOD streaming distance the views have to move before a visible tile drops that LOD or gets hidden
+	UPROPERTY(config)
+	float						TilesStreamingDistanceHysteresis;
+
 	// Whether all distance dependent tiles should be loaded and visible during cinematic
 	UPROPERTY(config)
 	bool						bLoadAllTilesDuringCinematic;
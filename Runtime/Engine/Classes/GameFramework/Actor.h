@@ -341,6 +341,15 @@ protected:
 	UPROPERTY(Category=Actor, EditAnywhere, AdvancedDisplay)
 	uint8 bCanBeInCluster:1;
 
+	/**
+	 * If true, this actor's PreInitializeComponents/InitializeComponents/PostInitializeComponents do nothing beyond the AActor defaults,
+	 * so a cooked level may mark it initialized directly when streamed in instead of routing them.
+	 * Only honored for classes whose native class declares it doesn't override them, see GetNativeInitializationClass().
+	 * @see CanSkipInitializationWhenStreamed()
+	 */
+	UPROPERTY(Category=Actor, EditAnywhere, AdvancedDisplay)
+	uint8 bCanSkipInitializationWhenStreamed:1;
+
 	/**
 	 * If false, the Blueprint ReceiveTick() event will be disabled on dedicated servers.
 	 * @see AllowReceiveTickEventOnDedicatedServer()
@@ -1491,6 +1500,19 @@ public:
 	/** Returns whether an actor has been initialized for gameplay */
 	bool IsActorInitialized() const { return bActorInitialized; }
 
+	/**
+	 * Returns whether a cooked level may record this actor as pre-initialized, so that RouteActorInitialize of a streamed level flags it
+	 * initialized without routing PreInitializeComponents/InitializeComponents/PostInitializeComponents. Evaluated at cook time.
+	 */
+	virtual bool CanSkipInitializationWhenStreamed() const;
+
+	/**
+	 * Returns the most derived native class whose PreInitializeComponents/InitializeComponents/PostInitializeComponents are the AActor ones.
+	 * Native classes that don't override them may override this to return their StaticClass(), a native subclass that doesn't is assumed
+	 * to override them and can't skip initialization when streamed.
+	 */
+	virtual UClass* GetNativeInitializationClass() const { return AActor::StaticClass(); }
+
 	/** Returns whether an actor is in the process of beginning play */
 	bool IsActorBeginningPlay() const { return ActorHasBegunPlay == EActorBeginPlayState::BeginningPlay; }
 
@@ -3295,6 +3317,7 @@ private:
 	friend struct FMarkActorIsBeingDestroyed;
 	friend struct FActorParentComponentSetter;
 	friend struct FSetActorWantsDestroyDuringBeginPlay;
+	friend struct FSetActorPreInitialized;
 #if WITH_EDITOR
 	friend struct FSetActorHiddenInSceneOutliner;
 	friend struct FSetActorGuid;
@@ -3508,6 +3531,18 @@ private:
 	friend UWorld;
 };
 
+/** This should only be used by ULevel::RouteActorInitialize for actors the level recorded as pre-initialized at cook time */
+struct FSetActorPreInitialized
+{
+private:
+	FSetActorPreInitialized(AActor* InActor)
+	{
+		InActor->bActorInitialized = true;
+	}
+
+	friend class ULevel;
+};
+
 /** Helper struct that allows UPrimitiveComponent and FPrimitiveSceneInfo write to the Actor's LastRenderTime member */
 struct FActorLastRenderTime
 {
@@ -8,6 +8,21 @@
 #include "Materials/MaterialInstance.h"
 #include "MaterialInstanceDynamic.generated.h"
 
+/** Hash of parameter infos to their index in one of a material instance's parameter value arrays. */
+struct FMaterialInstanceParameterIndexMap
+{
+	TMap<FHashedMaterialParameterInfo, int32> Indices;
+
+	/** Number of parameter values the map was built from, INDEX_NONE if it has to be rebuilt. */
+	int32 NumParameters = INDEX_NONE;
+
+	void Invalidate()
+	{
+		Indices.Reset();
+		NumParameters = INDEX_NONE;
+	}
+};
+
 UCLASS(hidecategories=Object, collapsecategories, BlueprintType)
 class ENGINE_API UMaterialInstanceDynamic : public UMaterialInstance
 {
@@ -35,6 +50,25 @@ class ENGINE_API UMaterialInstanceDynamic : public UMaterialInstance
 	// Use the cached value of OutParameterIndex above to set the vector parameter ONLY on the exact same MID
 	bool SetVectorParameterByIndex(int32 ParameterIndex, const FLinearColor& Value);
 
+	/**
+	 * Sets many scalar and vector parameter values at once. All the values that changed are sent to the rendering thread
+	 * in a single update, prefer this over the individual setters when updating several parameters of a MID every frame.
+	 * Parameters not overridden by this MID yet are added, as with SetScalarParameterValueByInfo and SetVectorParameterValueByInfo.
+	 */
+	void SetParameterValues(TArrayView<const FMaterialParameterInfo> ScalarParameterInfos, TArrayView<const float> ScalarValues, TArrayView<const FMaterialParameterInfo> VectorParameterInfos, TArrayView<const FLinearColor> VectorValues);
+
+	/** Sets many scalar parameter values at once, see SetParameterValues */
+	void SetScalarParameterValues(TArrayView<const FMaterialParameterInfo> ParameterInfos, TArrayView<const float> Values)
+	{
+		SetParameterValues(ParameterInfos, Values, TArrayView<const FMaterialParameterInfo>(), TArrayView<const FLinearColor>());
+	}
+
+	/** Sets many vector parameter values at once, see SetParameterValues */
+	void SetVectorParameterValues(TArrayView<const FMaterialParameterInfo> ParameterInfos, TArrayView<const FLinearColor> Values)
+	{
+		SetParameterValues(TArrayView<const FMaterialParameterInfo>(), TArrayView<const float>(), ParameterInfos, Values);
+	}
+
 	/** Get the current scalar (float) parameter value from an MID */
 	UFUNCTION(BlueprintCallable, meta=(DisplayName = "GetScalarParameterValue", ScriptName = "GetScalarParameterValue", Keywords = "GetFloatParameterValue"), Category="Rendering|Material")
 	float K2_GetScalarParameterValue(FName ParameterName);
@@ -170,5 +204,20 @@ class ENGINE_API UMaterialInstanceDynamic : public UMaterialInstance
 	// This overrides does the remapping before looking at the parent data.
 	virtual float GetTextureDensity(FName TextureName, const struct FMeshUVChannelInfo& UVChannelData) const override;
 
+private:
+	/** Sets a parameter through the parameter index maps, adding it if this MID doesn't override it yet */
+	void SetScalarParameterValueHashed(const FMaterialParameterInfo& ParameterInfo, float Value);
+	void SetVectorParameterValueHashed(const FMaterialParameterInfo& ParameterInfo, const FLinearColor& Value);
+
+	/** Discards the parameter index maps, to be rebuilt on next use after the parameter arrays were replaced */
+	void InvalidateParameterIndexMaps()
+	{
+		ScalarParameterIndexMap.Invalidate();
+		VectorParameterIndexMap.Invalidate();
+	}
+
+	/** Indices of ScalarParameterValues and VectorParameterValues by parameter info, built on demand */
+	FMaterialInstanceParameterIndexMap ScalarParameterIndexMap;
+	FMaterialInstanceParameterIndexMap VectorParameterIndexMap;
 };
 
@@ -24,6 +24,7 @@ class UEdGraph;
 class USoundCue;
 class USoundNode;
 struct FActiveSound;
+struct FSoundCueNodeLayout;
 struct FSoundParseParameters;
 
 USTRUCT()
@@ -124,6 +125,9 @@ protected:
 private:
 	float MaxAudibleDistance;
 
+	/** Payload layout of the node graph, rebuilt on the game thread whenever the graph changes. Captured by active sounds when they start playing the cue. */
+	TSharedPtr<const FSoundCueNodeLayout, ESPMode::ThreadSafe> NodeLayout;
+
 public:
 	/* Indicates whether attenuation should use the Attenuation Overrides or the Attenuation Settings asset */
 	UPROPERTY(EditAnywhere, Category = Attenuation)
@@ -262,6 +266,12 @@ public:
 	/** Call to cache any values which need to be computed from the sound cue graph. e.g. MaxDistance, Duration, etc. */
 	void CacheAggregateValues();
 
+	/** Rebuilds the node payload layout of the graph, must be called on the game thread after the graph changes. */
+	void CacheNodeLayout();
+
+	/** Returns the node payload layout of the graph, or null if the graph is too large or was built at runtime. */
+	const TSharedPtr<const FSoundCueNodeLayout, ESPMode::ThreadSafe>& GetNodeLayout() const { return NodeLayout; }
+
 	/** Call this when stream caching is enabled to prime all SoundWave assets referenced by this Sound Cue. */
 	void PrimeSoundCue();
 
@@ -274,6 +284,7 @@ public:
 
 protected:
 	bool RecursiveFindPathToNode(USoundNode* CurrentNode, const UPTRINT CurrentHash, const UPTRINT NodeHashToFind, TArray<USoundNode*>& OutPath) const;
+	bool RecursiveAddToNodeLayout(USoundNode* CurrentNode, const UPTRINT CurrentHash, FSoundCueNodeLayout& OutLayout) const;
 
 private:
 	void AudioQualityChanged();
@@ -35,12 +35,12 @@ struct FActiveSound;
 		uint8*	Payload					= NULL;													\
 		uint32*	RequiresInitialization	= NULL;													\
 		{																						\
-			uint32* TempOffset = ActiveSound.SoundNodeOffsetMap.Find(NodeWaveInstanceHash);		\
+			uint32* TempOffset = ActiveSound.FindSoundNodeDataOffset(NodeWaveInstanceHash);		\
 			uint32 Offset;																		\
 			if( !TempOffset )																	\
 			{																					\
 				Offset = ActiveSound.SoundNodeData.AddZeroed( Size + sizeof(uint32));				\
-				ActiveSound.SoundNodeOffsetMap.Add( NodeWaveInstanceHash, Offset );				\
+				ActiveSound.AddSoundNodeDataOffset( NodeWaveInstanceHash, Offset );				\
 				RequiresInitialization = (uint32*) &ActiveSound.SoundNodeData[Offset];			\
 				*RequiresInitialization = 1;													\
 				Offset += sizeof(uint32);															\
@@ -5,6 +5,8 @@
 #include "EngineDefines.h"
 #include "VisualLogger/VisualLoggerTypes.h"
 
+class FVisualLoggerBinaryFileWriter;
+
 #if ENABLE_VISUAL_LOG
 
 #define VISLOG_FILENAME_EXT TEXT("bvlog")
@@ -31,9 +33,11 @@ public:
 protected:
 	int32 bUseCompression : 1;
 	float FrameCacheLenght;
+	float ChunkLength;
 	float StartRecordingTime;
 	float LastLogTimeStamp;
 	FArchive* FileArchive;
+	FVisualLoggerBinaryFileWriter* FileWriter;
 	FString TempFileName;
 	FString FileName;
 	TArray<FVisualLogEntryItem> FrameCache;
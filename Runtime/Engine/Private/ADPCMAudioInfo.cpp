@@ -44,6 +44,13 @@ FAutoConsoleVariableRef CVarADPCMOnlySeekForwardOneChunk(
 	TEXT("When set to 1, we will not continue to seek forward after failing to load two chunks in a row.\n"),
 	ECVF_Default);
 
+static int32 ADPCMDecodeDirectlyToOutputCVar = 1;
+FAutoConsoleVariableRef CVarADPCMDecodeDirectlyToOutput(
+	TEXT("au.adpcm.DecodeDirectlyToOutput"),
+	ADPCMDecodeDirectlyToOutputCVar,
+	TEXT("When set to 1, whole ADPCM blocks that fit in the requested buffer are decoded straight into it rather than through the intermediate block buffer.\n"),
+	ECVF_Default);
+
 static float ChanceForIntentionalChunkMissCVar = 0.0f;
 FAutoConsoleVariableRef CVarChanceForIntentionalChunkMiss(
 	TEXT("au.adpcm.ChanceForIntentionalChunkMiss"),
@@ -56,7 +63,6 @@ FAutoConsoleVariableRef CVarChanceForIntentionalChunkMiss(
 
 namespace ADPCM
 {
-	void DecodeBlock(const uint8* EncodedADPCMBlock, int32 BlockSize, int16* DecodedPCMData);
 	void DecodeBlockStereo(const uint8* EncodedADPCMBlockLeft, const uint8* EncodedADPCMBlockRight, int32 BlockSize, int16* DecodedPCMData);
 }
 
@@ -336,50 +342,54 @@ bool FADPCMAudioInfo::ReadCompressedData(uint8* Destination, bool bLooping, uint
 	bool ReachedEndOfSamples = false;
 	if(Format == WAVE_FORMAT_ADPCM)
 	{
+		const uint32 SamplesPerUncompressedBlock = UncompressedBlockSize / sizeof(uint16);
+
 		// We need to loop over the number of samples requested since an uncompressed block will not match the number of frames requested
 		while(BufferSize > 0)
 		{
-			if(CurrentUncompressedBlockSampleIndex >= UncompressedBlockSize / sizeof(uint16))
+			uint32 DecompressedSamplesToCopy = 0;
+
+			if(CurrentUncompressedBlockSampleIndex >= SamplesPerUncompressedBlock)
 			{
 				// we need to decompress another block of compressed data from the current chunk
+				const uint8* FirstChannelBlock = WaveInfo.SampleDataStart + CurrentCompressedBlockIndex * CompressedBlockSize;
+				const uint32 ChannelStride = TotalCompressedBlocksPerChannel * CompressedBlockSize;
+				++CurrentCompressedBlockIndex;
 
-				// Decompress one block for each channel and store it in UncompressedBlockData
-				for(int32 ChannelItr = 0; ChannelItr < NumChannels; ++ChannelItr)
+				if (CanDecodeBlockDirectlyToOutput(BufferSize))
 				{
-					ADPCM::DecodeBlock(
-						WaveInfo.SampleDataStart + (ChannelItr * TotalCompressedBlocksPerChannel + CurrentCompressedBlockIndex) * CompressedBlockSize,
-						CompressedBlockSize,
-						(int16*)(UncompressedBlockData + ChannelItr * UncompressedBlockSize));
+					// The whole block fits in the output, so skip the intermediate block buffer.
+					DecodeBlocks(FirstChannelBlock, ChannelStride, OutData);
+					DecompressedSamplesToCopy = SamplesPerUncompressedBlock;
+					CurrentUncompressedBlockSampleIndex = SamplesPerUncompressedBlock;
+				}
+				else
+				{
+					DecodeBlocks(FirstChannelBlock, ChannelStride, (int16*)UncompressedBlockData);
+					CurrentUncompressedBlockSampleIndex = 0;
 				}
-
-				// Update some bookkeeping
-				CurrentUncompressedBlockSampleIndex = 0;
-				++CurrentCompressedBlockIndex;
 			}
 
-			// Only copy over the number of samples we currently have available, we will loop around if needed
-			uint32 DecompressedSamplesToCopy = FMath::Min<uint32>(UncompressedBlockSize / sizeof(uint16) - CurrentUncompressedBlockSampleIndex, BufferSize / (sizeof(uint16) * NumChannels));
-			check(DecompressedSamplesToCopy > 0);
-
-			// Ensure we don't go over the number of samples left in the audio data
-			if(DecompressedSamplesToCopy > TotalSamplesPerChannel - TotalSamplesStreamed)
+			if (DecompressedSamplesToCopy == 0)
 			{
-				DecompressedSamplesToCopy = TotalSamplesPerChannel - TotalSamplesStreamed;
-			}
+				// Only copy over the number of samples we currently have available, we will loop around if needed
+				DecompressedSamplesToCopy = FMath::Min<uint32>(SamplesPerUncompressedBlock - CurrentUncompressedBlockSampleIndex, BufferSize / ChannelSampleSize);
+				check(DecompressedSamplesToCopy > 0);
 
-			// Copy over the actual sample data
-			for(uint32 SampleItr = 0; SampleItr < DecompressedSamplesToCopy; ++SampleItr)
-			{
-				for(int32 ChannelItr = 0; ChannelItr < NumChannels; ++ChannelItr)
+				// Ensure we don't go over the number of samples left in the audio data
+				if(DecompressedSamplesToCopy > TotalSamplesPerChannel - TotalSamplesStreamed)
 				{
-					uint16 Value = *(int16*)(UncompressedBlockData + ChannelItr * UncompressedBlockSize + (CurrentUncompressedBlockSampleIndex + SampleItr) * sizeof(int16));
-					*OutData++ = Value;
+					DecompressedSamplesToCopy = TotalSamplesPerChannel - TotalSamplesStreamed;
 				}
+
+				// UncompressedBlockData is interleaved the same way as the output.
+				FMemory::Memcpy(OutData, (int16*)UncompressedBlockData + CurrentUncompressedBlockSampleIndex * NumChannels, DecompressedSamplesToCopy * ChannelSampleSize);
+				CurrentUncompressedBlockSampleIndex += DecompressedSamplesToCopy;
 			}
 
 			// Update bookkeeping
-			CurrentUncompressedBlockSampleIndex += DecompressedSamplesToCopy;
-			BufferSize -= DecompressedSamplesToCopy * sizeof(uint16) * NumChannels;
+			OutData += DecompressedSamplesToCopy * NumChannels;
+			BufferSize -= DecompressedSamplesToCopy * ChannelSampleSize;
 			TotalSamplesStreamed += DecompressedSamplesToCopy;
 
 			// Check for the end of the audio samples and loop if needed
@@ -428,7 +438,7 @@ bool FADPCMAudioInfo::ReadCompressedData(uint8* Destination, bool bLooping, uint
 				if (!bLooping)
 				{
 					// Zero remaining buffer
-					FMemory::Memzero(OutData, BufferSize);
+					FMemory::Memzero(OutData + OutDataOffset, BufferSize);
 					return true;
 				}
 			}
@@ -445,6 +455,26 @@ void FADPCMAudioInfo::ExpandFile(uint8* DstBuffer, struct FSoundQualityInfo* Qua
 	ReadCompressedData(DstBuffer, false, TotalDecodedSize);
 }
 
+bool FADPCMAudioInfo::CanDecodeBlockDirectlyToOutput(uint32 BufferSize) const
+{
+	const uint32 SamplesPerUncompressedBlock = UncompressedBlockSize / sizeof(uint16);
+	return ADPCMDecodeDirectlyToOutputCVar != 0
+		&& BufferSize >= UncompressedBlockSize * NumChannels
+		&& TotalSamplesPerChannel - TotalSamplesStreamed >= SamplesPerUncompressedBlock;
+}
+
+void FADPCMAudioInfo::DecodeBlocks(const uint8* FirstChannelBlock, uint32 ChannelStride, int16* Destination)
+{
+	TArray<const uint8*, TInlineAllocator<ADPCM::MaxInterleavedDecodeChannels>> ChannelBlocks;
+	ChannelBlocks.AddUninitialized(NumChannels);
+	for (int32 ChannelItr = 0; ChannelItr < NumChannels; ++ChannelItr)
+	{
+		ChannelBlocks[ChannelItr] = FirstChannelBlock + ChannelItr * ChannelStride;
+	}
+
+	ADPCM::DecodeBlocksInterleaved(ChannelBlocks.GetData(), NumChannels, CompressedBlockSize, Destination);
+}
+
 int FADPCMAudioInfo::GetStreamBufferSize() const
 {
 	return StreamBufferSize;
@@ -623,6 +653,8 @@ bool FADPCMAudioInfo::StreamCompressedData(uint8* Destination, bool bLooping, ui
 		// We need to loop over the number of samples requested since an uncompressed block will not match the number of frames requested
 		while(BufferSize > 0)
 		{
+			uint32 DecompressedSamplesToCopy = 0;
+
 			if(CurCompressedChunkData == nullptr || CurrentUncompressedBlockSampleIndex >= UncompressedBlockSize / sizeof(uint16))
 			{
 				// we need to decompress another block of compressed data from the current chunk
@@ -779,44 +811,45 @@ bool FADPCMAudioInfo::StreamCompressedData(uint8* Destination, bool bLooping, ui
 					bSeekPending = false;
 				}
 
-				// Decompress one block for each channel and store it in UncompressedBlockData
-				for(int32 ChannelItr = 0; ChannelItr < NumChannels; ++ChannelItr)
-				{
-					ADPCM::DecodeBlock(
-						CurCompressedChunkData + CurrentChunkBufferOffset + ChannelItr * CompressedBlockSize,
-						CompressedBlockSize,
-						(int16*)(UncompressedBlockData + ChannelItr * UncompressedBlockSize));
-				}
-
-				// Update some bookkeeping
-				CurrentUncompressedBlockSampleIndex = 0;
+				// The channels of each block are stored back to back in the chunk.
+				const uint8* FirstChannelBlock = CurCompressedChunkData + CurrentChunkBufferOffset;
 				CurrentChunkBufferOffset += NumChannels * CompressedBlockSize;
-			}
-
-			// Only copy over the number of samples we currently have available, we will loop around if needed
-			uint32 DecompressedSamplesToCopy = FMath::Min<uint32>(
-				(UncompressedBlockSize / sizeof(uint16)) - CurrentUncompressedBlockSampleIndex,
-				BufferSize / (ChannelSampleSize));
-			check(DecompressedSamplesToCopy > 0);
 
-			// Ensure we don't go over the number of samples left in the audio data
-			if(DecompressedSamplesToCopy > TotalSamplesPerChannel - TotalSamplesStreamed)
-			{
-				DecompressedSamplesToCopy = TotalSamplesPerChannel - TotalSamplesStreamed;
+				if (CanDecodeBlockDirectlyToOutput(BufferSize))
+				{
+					// The whole block fits in the output, so skip the intermediate block buffer.
+					DecodeBlocks(FirstChannelBlock, CompressedBlockSize, OutData);
+					DecompressedSamplesToCopy = UncompressedBlockSize / sizeof(uint16);
+					CurrentUncompressedBlockSampleIndex = DecompressedSamplesToCopy;
+				}
+				else
+				{
+					DecodeBlocks(FirstChannelBlock, CompressedBlockSize, (int16*)UncompressedBlockData);
+					CurrentUncompressedBlockSampleIndex = 0;
+				}
 			}
 
-			// Copy over the actual sample data
-			for(uint32 SampleItr = 0; SampleItr < DecompressedSamplesToCopy; ++SampleItr)
+			if (DecompressedSamplesToCopy == 0)
 			{
-				for(int32 ChannelItr = 0; ChannelItr < NumChannels; ++ChannelItr)
+				// Only copy over the number of samples we currently have available, we will loop around if needed
+				DecompressedSamplesToCopy = FMath::Min<uint32>(
+					(UncompressedBlockSize / sizeof(uint16)) - CurrentUncompressedBlockSampleIndex,
+					BufferSize / (ChannelSampleSize));
+				check(DecompressedSamplesToCopy > 0);
+
+				// Ensure we don't go over the number of samples left in the audio data
+				if(DecompressedSamplesToCopy > TotalSamplesPerChannel - TotalSamplesStreamed)
 				{
-					uint16 Value = *(int16*)(UncompressedBlockData + ChannelItr * UncompressedBlockSize + (CurrentUncompressedBlockSampleIndex + SampleItr) * sizeof(int16));
-					*OutData++ = Value;
+					DecompressedSamplesToCopy = TotalSamplesPerChannel - TotalSamplesStreamed;
 				}
+
+				// UncompressedBlockData is interleaved the same way as the output.
+				FMemory::Memcpy(OutData, (int16*)UncompressedBlockData + CurrentUncompressedBlockSampleIndex * NumChannels, DecompressedSamplesToCopy * ChannelSampleSize);
+				CurrentUncompressedBlockSampleIndex += DecompressedSamplesToCopy;
 			}
 
 			// Update bookkeeping
-			CurrentUncompressedBlockSampleIndex += DecompressedSamplesToCopy;
+			OutData += DecompressedSamplesToCopy * NumChannels;
 			BufferSize -= DecompressedSamplesToCopy * ChannelSampleSize;
 			TotalSamplesStreamed += DecompressedSamplesToCopy;
 
@@ -95,6 +95,7 @@ FActiveSound::FActiveSound()
 	, CurrentInteriorLPF(MAX_FILTER_FREQUENCY)
 	, EnvelopeFollowerAttackTime(10)
 	, EnvelopeFollowerReleaseTime(100)
+	, SoundNodeParseCursor(0)
 	, bHasNewBusSends(false)
 #if ENABLE_AUDIO_DEBUG
 	, DebugColor(FColor::Black)
@@ -237,6 +238,11 @@ void FActiveSound::SetWorld(UWorld* InWorld)
 void FActiveSound::SetSound(USoundBase* InSound)
 {
 	Sound = InSound;
+
+	USoundCue* SoundCue = Cast<USoundCue>(Sound);
+	SoundNodeLayout = SoundCue ? SoundCue->GetNodeLayout() : nullptr;
+	SoundNodeLayoutOffsets.Reset();
+
 	bApplyInteriorVolumes = (SoundClassOverride && SoundClassOverride->Properties.bApplyAmbientVolumes)
 		|| (Sound && Sound->ShouldApplyInteriorVolumes());
 }
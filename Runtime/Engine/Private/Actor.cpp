@@ -331,6 +331,36 @@ bool AActor::CanBeInCluster() const
 	return bCanBeInCluster;
 }
 
+bool AActor::CanSkipInitializationWhenStreamed() const
+{
+	// Anything PreInitializeComponents/PostInitializeComponents would act on has to be absent, since neither will be routed
+	if (!bCanSkipInitializationWhenStreamed || GetIsReplicated() || AutoReceiveInput != EAutoReceiveInput::Disabled || IsChildActor())
+	{
+		return false;
+	}
+
+	// Blueprints can't override the initialization functions, the nearest native class has to be the one declaring that it doesn't either
+	UClass* NativeClass = GetClass();
+	while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+	if (NativeClass != GetNativeInitializationClass())
+	{
+		return false;
+	}
+
+	for (const UActorComponent* ActorComp : GetComponents())
+	{
+		if (ActorComp && (ActorComp->bAutoActivate || ActorComp->bWantsInitializeComponent || ActorComp->GetIsReplicated()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void AActor::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
 	AActor* This = CastChecked<AActor>(InThis);
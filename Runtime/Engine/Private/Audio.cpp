@@ -37,6 +37,7 @@ DEFINE_STAT(STAT_AudioMemorySize);
 DEFINE_STAT(STAT_ActiveSounds);
 DEFINE_STAT(STAT_AudioSources);
 DEFINE_STAT(STAT_AudioVirtualLoops);
+DEFINE_STAT(STAT_AudioVirtualLoopsCulled);
 DEFINE_STAT(STAT_WaveInstances);
 DEFINE_STAT(STAT_WavesDroppedDueToPriority);
 DEFINE_STAT(STAT_AudioMaxChannels);
@@ -62,6 +63,8 @@ DEFINE_STAT(STAT_AudioSourceCreateTime);
 DEFINE_STAT(STAT_AudioSubmitBuffersTime);
 DEFINE_STAT(STAT_AudioStartSources);
 DEFINE_STAT(STAT_AudioGatherWaveInstances);
+DEFINE_STAT(STAT_AudioPrioritizeWaveInstances);
+DEFINE_STAT(STAT_WaveInstancesSorted);
 DEFINE_STAT(STAT_AudioFindNearestLocation);
 
 /** CVars */
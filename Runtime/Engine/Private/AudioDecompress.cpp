@@ -630,6 +630,146 @@ namespace ADPCM
 		}
 
 	}
+
+	// Sign extended value of each 4 bit nibble, used in place of SignExtend in the block decoder below.
+	static const int32 SignedNibbleTable[16] =
+	{
+		0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1
+	};
+
+	static const int32 NibbleAdaptationTable[NUM_ADAPTATION_TABLE] =
+	{
+		230, 230, 230, 230, 307, 409, 512, 614,
+		768, 614, 512, 409, 307, 230, 230, 230
+	};
+
+	static const int32 BlockCoefficient1[NUM_ADAPTATION_COEFF] =
+	{
+		256, 512, 0, 192, 240, 460, 392
+	};
+
+	static const int32 BlockCoefficient2[NUM_ADAPTATION_COEFF] =
+	{
+		0, -256, 0, 64, 0, -208, -232
+	};
+
+	// Unpacks 8 bytes of encoded data into 16 nibbles in stream order (high nibble first) using 64 bit word operations.
+	FORCEINLINE void UnpackNibbles(const uint8* EncodedBytes, uint8* OutNibbles)
+	{
+		uint64 Word;
+		FMemory::Memcpy(&Word, EncodedBytes, sizeof(Word));
+
+		const uint64 HighNibbles = (Word >> 4) & 0x0F0F0F0F0F0F0F0FULL;
+		const uint64 LowNibbles = Word & 0x0F0F0F0F0F0F0F0FULL;
+
+		for (int32 ByteIndex = 0; ByteIndex < 8; ++ByteIndex)
+		{
+#if PLATFORM_LITTLE_ENDIAN
+			const int32 Shift = ByteIndex * 8;
+#else
+			const int32 Shift = (7 - ByteIndex) * 8;
+#endif
+			OutNibbles[ByteIndex * 2] = (uint8)(HighNibbles >> Shift);
+			OutNibbles[ByteIndex * 2 + 1] = (uint8)(LowNibbles >> Shift);
+		}
+	}
+
+	void DecodeBlocksInterleaved(const uint8* const* EncodedADPCMBlocks, int32 NumChannels, int32 BlockSize, int16* DecodedPCMData)
+	{
+		if (NumChannels > MaxInterleavedDecodeChannels)
+		{
+			// Fall back to decoding each channel separately and interleaving afterwards.
+			const int32 SamplesPerChannel = GetNumSamplesPerBlock(BlockSize);
+			TArray<int16> ChannelData;
+			ChannelData.AddUninitialized(SamplesPerChannel);
+
+			for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+			{
+				DecodeBlock(EncodedADPCMBlocks[ChannelIndex], BlockSize, ChannelData.GetData());
+				for (int32 SampleIndex = 0; SampleIndex < SamplesPerChannel; ++SampleIndex)
+				{
+					DecodedPCMData[SampleIndex * NumChannels + ChannelIndex] = ChannelData[SampleIndex];
+				}
+			}
+			return;
+		}
+
+		// Decoder state for each channel. The channels are independent, so decoding them in lockstep interleaves their dependency chains.
+		int32 AdaptationDelta[MaxInterleavedDecodeChannels];
+		int32 Coefficient1[MaxInterleavedDecodeChannels];
+		int32 Coefficient2[MaxInterleavedDecodeChannels];
+		int32 Sample1[MaxInterleavedDecodeChannels];
+		int32 Sample2[MaxInterleavedDecodeChannels];
+
+		for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+		{
+			const uint8* EncodedBlock = EncodedADPCMBlocks[ChannelIndex];
+			int32 ReadIndex = 0;
+
+			const uint8 CoefficientIndex = ReadFromByteStream<uint8>(EncodedBlock, ReadIndex);
+			AdaptationDelta[ChannelIndex] = ReadFromByteStream<int16>(EncodedBlock, ReadIndex);
+			Sample1[ChannelIndex] = ReadFromByteStream<int16>(EncodedBlock, ReadIndex);
+			Sample2[ChannelIndex] = ReadFromByteStream<int16>(EncodedBlock, ReadIndex);
+			Coefficient1[ChannelIndex] = BlockCoefficient1[CoefficientIndex];
+			Coefficient2[ChannelIndex] = BlockCoefficient2[CoefficientIndex];
+
+			// The first two samples are sent directly to the output in reverse order, as per the standard
+			DecodedPCMData[ChannelIndex] = (int16)Sample2[ChannelIndex];
+			DecodedPCMData[NumChannels + ChannelIndex] = (int16)Sample1[ChannelIndex];
+		}
+
+		int16* WritePtr = DecodedPCMData + 2 * NumChannels;
+
+		auto DecodeNibbles = [&](const uint8 (&Nibbles)[MaxInterleavedDecodeChannels][16], int32 NumNibbles)
+		{
+			for (int32 NibbleIndex = 0; NibbleIndex < NumNibbles; ++NibbleIndex)
+			{
+				for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+				{
+					const uint8 EncodedNibble = Nibbles[ChannelIndex][NibbleIndex];
+
+					int32 PredictedSample = (Sample1[ChannelIndex] * Coefficient1[ChannelIndex] + Sample2[ChannelIndex] * Coefficient2[ChannelIndex]) / 256;
+					PredictedSample += SignedNibbleTable[EncodedNibble] * AdaptationDelta[ChannelIndex];
+					PredictedSample = FMath::Clamp(PredictedSample, -32768, 32767);
+
+					Sample2[ChannelIndex] = Sample1[ChannelIndex];
+					Sample1[ChannelIndex] = PredictedSample;
+					AdaptationDelta[ChannelIndex] = FMath::Max((AdaptationDelta[ChannelIndex] * NibbleAdaptationTable[EncodedNibble]) / 256, 16);
+
+					*WritePtr++ = (int16)PredictedSample;
+				}
+			}
+		};
+
+		uint8 Nibbles[MaxInterleavedDecodeChannels][16];
+
+		// The block preamble is 7 bytes, after which every byte holds two samples.
+		int32 ReadIndex = 7;
+		for (; ReadIndex + 8 <= BlockSize; ReadIndex += 8)
+		{
+			for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+			{
+				UnpackNibbles(EncodedADPCMBlocks[ChannelIndex] + ReadIndex, Nibbles[ChannelIndex]);
+			}
+			DecodeNibbles(Nibbles, 16);
+		}
+
+		// Decode the remaining bytes that don't fill a whole 64 bit word.
+		const int32 NumRemainingBytes = BlockSize - ReadIndex;
+		if (NumRemainingBytes > 0)
+		{
+			for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+			{
+				const uint8* EncodedBytes = EncodedADPCMBlocks[ChannelIndex] + ReadIndex;
+				for (int32 ByteIndex = 0; ByteIndex < NumRemainingBytes; ++ByteIndex)
+				{
+					Nibbles[ChannelIndex][ByteIndex * 2] = (EncodedBytes[ByteIndex] >> 4) & 0x0F;
+					Nibbles[ChannelIndex][ByteIndex * 2 + 1] = EncodedBytes[ByteIndex] & 0x0F;
+				}
+			}
+			DecodeNibbles(Nibbles, NumRemainingBytes * 2);
+		}
+	}
 } // end namespace ADPCM
 
 //////////////////////////////////////////////////////////////////////////
@@ -135,6 +135,14 @@ FAutoConsoleVariableRef CVarNumPrecacheFrames(
 	TEXT("0: Use default value for precache frames, >0: Number of frames to precache."),
 	ECVF_Default);
 
+static int32 PartialSortWaveInstancesCVar = 1;
+FAutoConsoleVariableRef CVarPartialSortWaveInstances(
+	TEXT("au.PartialSortWaveInstances"),
+	PartialSortWaveInstancesCVar,
+	TEXT("When there are more wave instances than voices, only sorts the wave instances which will be given a voice.\n")
+	TEXT("0: Sort all wave instances, 1: Select the highest priority wave instances and sort those only."),
+	ECVF_Default);
+
 static int32 DisableLegacyReverb = 0;
 FAutoConsoleVariableRef CVarDisableLegacyReverb(
 	TEXT("au.DisableLegacyReverb"),
@@ -3821,29 +3829,114 @@ int32 FAudioDevice::GetSortedActiveWaveInstances(TArray<FWaveInstance*>& WaveIns
 	}
 
 	int32 FirstActiveIndex = 0;
-	// Only need to do the wave instance sort if we have any waves and if our wave instances are greater than our max channels.
-	if (WaveInstances.Num() >= 0)
+	if (WaveInstances.Num() > 0)
 	{
+		SCOPE_CYCLE_COUNTER(STAT_AudioPrioritizeWaveInstances);
+
+		// Get the first index that will result in a active source voice
+		const int32 CurrentMaxChannels = GetMaxChannels();
+		FirstActiveIndex = FMath::Max(WaveInstances.Num() - CurrentMaxChannels, 0);
+
+		// Evaluate each priority once up front, as it requires computing the distance attenuated volume of the wave instance.
+		PrioritizedWaveInstances.Reset(WaveInstances.Num());
+		for (FWaveInstance* WaveInstance : WaveInstances)
+		{
+			PrioritizedWaveInstances.Emplace(WaveInstance->GetVolumeWeightedPriority(), WaveInstance);
+		}
+
 		// Helper function for "Sort" (higher priority sorts last).
 		struct FCompareFWaveInstanceByPlayPriority
 		{
-			FORCEINLINE bool operator()(const FWaveInstance& A, const FWaveInstance& B) const
+			FORCEINLINE bool operator()(const TPair<float, FWaveInstance*>& A, const TPair<float, FWaveInstance*>& B) const
 			{
-				return A.GetVolumeWeightedPriority() < B.GetVolumeWeightedPriority();
+				return A.Key < B.Key;
 			}
 		};
 
+		// Wave instances below the first active index never get a voice and are only stopped, so their relative order
+		// doesn't matter. Partition the highest priority wave instances to the end and only sort those.
+		int32 FirstSortedIndex = 0;
+		if (PartialSortWaveInstancesCVar && FirstActiveIndex > 0)
+		{
+			SelectNthLowestPriority(PrioritizedWaveInstances, FirstActiveIndex);
+			FirstSortedIndex = FirstActiveIndex;
+		}
+
 		// Sort by priority (lowest priority first).
-		WaveInstances.Sort(FCompareFWaveInstanceByPlayPriority());
+		const int32 NumToSort = PrioritizedWaveInstances.Num() - FirstSortedIndex;
+		Sort(PrioritizedWaveInstances.GetData() + FirstSortedIndex, NumToSort, FCompareFWaveInstanceByPlayPriority());
 
-		// Get the first index that will result in a active source voice
-		int32 CurrentMaxChannels = GetMaxChannels();
-		FirstActiveIndex = FMath::Max(WaveInstances.Num() - CurrentMaxChannels, 0);
+		for (int32 i = 0; i < PrioritizedWaveInstances.Num(); ++i)
+		{
+			WaveInstances[i] = PrioritizedWaveInstances[i].Value;
+		}
+
+		SET_DWORD_STAT(STAT_WaveInstancesSorted, NumToSort);
 	}
 
 	return FirstActiveIndex;
 }
 
+void FAudioDevice::SelectNthLowestPriority(TArray<TPair<float, FWaveInstance*>>& InPrioritizedWaveInstances, const int32 NthIndex)
+{
+	// Quickselect: after returning, no element before NthIndex has a higher priority than any element at or after it.
+	int32 Low = 0;
+	int32 High = InPrioritizedWaveInstances.Num() - 1;
+
+	while (Low < High)
+	{
+		// Median of three pivot to avoid degenerate partitions on already sorted input (the common case frame to frame)
+		const int32 Mid = Low + (High - Low) / 2;
+		if (InPrioritizedWaveInstances[Mid].Key < InPrioritizedWaveInstances[Low].Key)
+		{
+			Swap(InPrioritizedWaveInstances[Mid], InPrioritizedWaveInstances[Low]);
+		}
+		if (InPrioritizedWaveInstances[High].Key < InPrioritizedWaveInstances[Low].Key)
+		{
+			Swap(InPrioritizedWaveInstances[High], InPrioritizedWaveInstances[Low]);
+		}
+		if (InPrioritizedWaveInstances[High].Key < InPrioritizedWaveInstances[Mid].Key)
+		{
+			Swap(InPrioritizedWaveInstances[High], InPrioritizedWaveInstances[Mid]);
+		}
+
+		const float Pivot = InPrioritizedWaveInstances[Mid].Key;
+		int32 Left = Low;
+		int32 Right = High;
+		while (Left <= Right)
+		{
+			while (InPrioritizedWaveInstances[Left].Key < Pivot)
+			{
+				++Left;
+			}
+			while (Pivot < InPrioritizedWaveInstances[Right].Key)
+			{
+				--Right;
+			}
+			if (Left <= Right)
+			{
+				Swap(InPrioritizedWaveInstances[Left], InPrioritizedWaveInstances[Right]);
+				++Left;
+				--Right;
+			}
+		}
+
+		// [Low, Right] <= Pivot, (Right, Left) == Pivot, [Left, High] >= Pivot
+		if (NthIndex <= Right)
+		{
+			High = Right;
+		}
+		else if (NthIndex >= Left)
+		{
+			Low = Left;
+		}
+		else
+		{
+			return;
+		}
+	}
+}
+
 void FAudioDevice::UpdateActiveSoundPlaybackTime(bool bIsGameTicking)
 {
 	if (bIsGameTicking)
@@ -4875,6 +4968,7 @@ void FAudioDevice::AddVirtualLoop(const FAudioVirtualLoop& InVirtualLoop)
 #endif // !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 
 	VirtualLoops.Add(&ActiveSound, MoveTemp(VirtualLoop));
+	VirtualLoopSpatialHash.MarkNeedsRebuild();
 }
 
 bool FAudioDevice::RemoveVirtualLoop(FActiveSound& InActiveSound)
@@ -4897,6 +4991,7 @@ bool FAudioDevice::RemoveVirtualLoop(FActiveSound& InActiveSound)
 #endif // !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 
 		VirtualLoops.Remove(&InActiveSound);
+		VirtualLoopSpatialHash.MarkNeedsRebuild();
 		return true;
 	}
 
@@ -5098,6 +5193,31 @@ FActiveSound* FAudioDevice::FindActiveSound(const uint64 AudioComponentID)
 	return AudioComponentIDToActiveSoundMap.FindRef(AudioComponentID);
 }
 
+void FAudioDevice::SetActiveSoundTransform(FActiveSound& ActiveSound, const FTransform& InTransform)
+{
+	check(IsInAudioThread());
+
+	ActiveSound.Transform = InTransform;
+
+	if (VirtualLoops.Contains(&ActiveSound))
+	{
+		VirtualLoopSpatialHash.MarkNeedsRebuild();
+	}
+}
+
+void FAudioDevice::SetActiveSoundAttenuationSettings(FActiveSound& ActiveSound, const FSoundAttenuationSettings& InAttenuationSettings)
+{
+	check(IsInAudioThread());
+
+	ActiveSound.AttenuationSettings = InAttenuationSettings;
+
+	// The spatial hash caches each loop's audible distance, which depends on the attenuation and focus settings
+	if (VirtualLoops.Contains(&ActiveSound))
+	{
+		VirtualLoopSpatialHash.MarkNeedsRebuild();
+	}
+}
+
 void FAudioDevice::RemoveActiveSound(FActiveSound* ActiveSound)
 {
 	check(IsInAudioThread());
@@ -6469,6 +6589,35 @@ void FAudioDevice::UpdateVirtualLoops(bool bForceUpdate)
 	{
 		TArray<FAudioVirtualLoop> VirtualLoopsToRetrigger;
 
+		// Forcing an update evaluates every loop, so first determine which regions are in range of any listener
+		// to avoid evaluating focus and audible range for loops that cannot possibly be realized. Cells are only
+		// rebuilt when loops were added, removed or moved, as forced updates are typically caused by listener motion.
+		const bool bUseSpatialHash = bForceUpdate && FAudioVirtualLoopSpatialHash::IsEnabled(VirtualLoops.Num());
+		if (bUseSpatialHash)
+		{
+			if (VirtualLoopSpatialHash.NeedsRebuild())
+			{
+				VirtualLoopSpatialHash.Reset();
+				for (const FVirtualLoopPair& Pair : VirtualLoops)
+				{
+					VirtualLoopSpatialHash.Add(Pair.Value);
+				}
+			}
+
+			TArray<FVector> ListenerLocations;
+			for (int32 ListenerIndex = 0; ListenerIndex < Listeners.Num(); ++ListenerIndex)
+			{
+				FVector ListenerLocation;
+				const bool bAllowOverride = true;
+				if (GetListenerPosition(ListenerIndex, ListenerLocation, bAllowOverride))
+				{
+					ListenerLocations.Add(ListenerLocation);
+				}
+			}
+			VirtualLoopSpatialHash.UpdateAudibleCells(ListenerLocations);
+		}
+
+		int32 NumCulled = 0;
 		for (FVirtualLoopPair& Pair : VirtualLoops)
 		{
 			FAudioVirtualLoop& VirtualLoop = Pair.Value;
@@ -6489,12 +6638,24 @@ void FAudioDevice::UpdateVirtualLoops(bool bForceUpdate)
 
 			// If the loop is ready to realize, add to array to be re-triggered
 			// outside of the loop to avoid map manipulation while iterating.
-			if (VirtualLoop.Update(GetDeviceDeltaTime(), bForceUpdate))
+			float CulledDistanceToListener = 0.0f;
+			const bool bMayBeAudible = !bUseSpatialHash || VirtualLoopSpatialHash.IsInAudibleCell(VirtualLoop, CulledDistanceToListener);
+			if (!bMayBeAudible)
+			{
+				++NumCulled;
+			}
+
+			if (VirtualLoop.Update(GetDeviceDeltaTime(), bForceUpdate, bMayBeAudible, CulledDistanceToListener))
 			{
 				VirtualLoopsToRetrigger.Add(VirtualLoop);
 			}
 		}
 
+		if (bUseSpatialHash)
+		{
+			SET_DWORD_STAT(STAT_AudioVirtualLoopsCulled, NumCulled);
+		}
+
 		for (FAudioVirtualLoop& RetriggerLoop : VirtualLoopsToRetrigger)
 		{
 			RetriggerVirtualLoop(RetriggerLoop);
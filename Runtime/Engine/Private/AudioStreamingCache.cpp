@@ -19,6 +19,9 @@ AudioStreaming.cpp: Implementation of audio streaming classes.
 #include "AudioDecompress.h"
 #include "AudioDevice.h"
 #include "AudioCompressionSettingsUtils.h"
+#include "Components/AudioComponent.h"
+#include "Sound/SoundCue.h"
+#include "Sound/SoundNodeWavePlayer.h"
 
 
 DEFINE_LOG_CATEGORY(LogAudioStreamCaching);
@@ -135,6 +138,36 @@ FAutoConsoleVariableRef CVarUseObjectKeyInChunkKeyComparisons(
 	TEXT("1: (default) Compare object keys.  0: Do not compare object keys."),
 	ECVF_Default);
 
+static int32 ProtectFrequentlyUsedChunksCVar = 2;
+FAutoConsoleVariableRef CVarProtectFrequentlyUsedChunks(
+	TEXT("au.streamcaching.ProtectFrequentlyUsedChunks"),
+	ProtectFrequentlyUsedChunksCVar,
+	TEXT("When set to a nonzero value, chunks used for playback repeatedly are protected: an eviction that reaches them moves them back to the most recent end of the cache instead.\n")
+	TEXT("0: Plain LRU eviction. n: Number of playbacks acquiring a chunk while cached required to protect it."),
+	ECVF_Default);
+
+static float PrefetchDistanceScaleCVar = 0.0f;
+FAutoConsoleVariableRef CVarPrefetchDistanceScale(
+	TEXT("au.streamcaching.PrefetchDistanceScale"),
+	PrefetchDistanceScaleCVar,
+	TEXT("When set > 0, audio components registered afterwards prefetch the first chunk of their sound when their sound's max distance, scaled by this value, reaches a streaming view.\n")
+	TEXT("0: Disable prefetching. n: Scale of the sound's max distance used as the prefetch distance."),
+	ECVF_Default);
+
+static float PrefetchMaxDistanceCVar = 20000.0f;
+FAutoConsoleVariableRef CVarPrefetchMaxDistance(
+	TEXT("au.streamcaching.PrefetchMaxDistance"),
+	PrefetchMaxDistanceCVar,
+	TEXT("Upper bound on the distance from a streaming view at which audio components prefetch their sounds, for sounds with very large or no attenuation.\n"),
+	ECVF_Default);
+
+static float PrefetchUpdateIntervalCVar = 0.5f;
+FAutoConsoleVariableRef CVarPrefetchUpdateInterval(
+	TEXT("au.streamcaching.PrefetchUpdateInterval"),
+	PrefetchUpdateIntervalCVar,
+	TEXT("Time in seconds between evaluations of which registered audio components are in prefetch range.\n"),
+	ECVF_Default);
+
 static FAutoConsoleCommand GFlushAudioCacheCommand(
 	TEXT("au.streamcaching.FlushAudioCache"),
 	TEXT("This will flush any non retained audio from the cache when Stream Caching is enabled."),
@@ -234,6 +267,7 @@ bool FAudioChunkCache::FChunkKey::operator==(const FChunkKey& Other) const
 }
 
 FCachedAudioStreamingManager::FCachedAudioStreamingManager(const FCachedAudioStreamingManagerParams& InitParams)
+	: TimeSinceLastPrefetchUpdate(0.0f)
 {
 	LLM_SCOPE(ELLMTag::AudioStreamCache);
 	check(FPlatformCompressionUtilities::IsCurrentPlatformUsingStreamCaching());
@@ -255,7 +289,155 @@ FCachedAudioStreamingManager::~FCachedAudioStreamingManager()
 
 void FCachedAudioStreamingManager::UpdateResourceStreaming(float DeltaTime, bool bProcessEverything /*= false*/)
 {
-	// The cached audio streaming manager doesn't tick.
+	// The cached audio streaming manager only ticks to prefetch chunks. Chunks are otherwise loaded on demand.
+	UpdatePrefetchAudioComponents(DeltaTime);
+}
+
+void FCachedAudioStreamingManager::UpdatePrefetchAudioComponents(float DeltaTime)
+{
+	check(IsInGameThread());
+
+	if (PrefetchDistanceScaleCVar <= 0.0f || PrefetchAudioComponents.Num() == 0)
+	{
+		return;
+	}
+
+	TimeSinceLastPrefetchUpdate += DeltaTime;
+	if (TimeSinceLastPrefetchUpdate < PrefetchUpdateIntervalCVar)
+	{
+		return;
+	}
+	TimeSinceLastPrefetchUpdate = 0.0f;
+
+	const int32 NumViews = IStreamingManager::Get().GetNumViews();
+	if (NumViews == 0)
+	{
+		return;
+	}
+
+	for (TMap<TWeakObjectPtr<UAudioComponent>, bool>::TIterator It(PrefetchAudioComponents); It; ++It)
+	{
+		UAudioComponent* AudioComponent = It.Key().Get();
+		if (!AudioComponent)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		USoundBase* Sound = AudioComponent->Sound;
+		bool& bWasInRange = It.Value();
+		if (!Sound || AudioComponent->IsPlaying())
+		{
+			// Playing sounds load their chunks through playback. Require re-entering range before prefetching again.
+			bWasInRange = true;
+			continue;
+		}
+
+		const float PrefetchDistance = FMath::Min(Sound->GetMaxDistance() * PrefetchDistanceScaleCVar, PrefetchMaxDistanceCVar);
+		const float PrefetchDistanceSq = PrefetchDistance * PrefetchDistance;
+		const FVector Location = AudioComponent->GetComponentLocation();
+
+		bool bInRange = false;
+		for (int32 ViewIndex = 0; ViewIndex < NumViews && !bInRange; ++ViewIndex)
+		{
+			const FStreamingViewInfo& ViewInfo = IStreamingManager::Get().GetViewInformation(ViewIndex);
+			bInRange = FVector::DistSquared(ViewInfo.ViewOrigin, Location) <= PrefetchDistanceSq;
+		}
+
+		// Only prefetch when entering range, as chunks that were prefetched but never played are free to be evicted.
+		if (bInRange && !bWasInRange)
+		{
+			PrefetchSound(Sound);
+		}
+		bWasInRange = bInRange;
+	}
+}
+
+void FCachedAudioStreamingManager::AddPrefetchAudioComponent(UAudioComponent* AudioComponent)
+{
+	check(IsInGameThread());
+
+	// Components registered while prefetching is disabled aren't tracked, so that it costs nothing by default.
+	if (AudioComponent && PrefetchDistanceScaleCVar > 0.0f)
+	{
+		PrefetchAudioComponents.Add(AudioComponent, false);
+	}
+}
+
+void FCachedAudioStreamingManager::RemovePrefetchAudioComponent(UAudioComponent* AudioComponent)
+{
+	check(IsInGameThread());
+
+	PrefetchAudioComponents.Remove(AudioComponent);
+}
+
+void FCachedAudioStreamingManager::PrefetchSound(USoundBase* Sound)
+{
+	LLM_SCOPE(ELLMTag::AudioStreamCache);
+
+	if (USoundWave* SoundWave = Cast<USoundWave>(Sound))
+	{
+		PrefetchSoundWave(SoundWave);
+	}
+	else if (USoundCue* SoundCue = Cast<USoundCue>(Sound))
+	{
+		// Walk the cue's node graph for wave players. This does not evaluate branching nodes, so every wave the cue could play is prefetched.
+		TArray<USoundNode*, TInlineAllocator<16>> NodesToVisit;
+		NodesToVisit.Add(SoundCue->FirstNode);
+
+		while (NodesToVisit.Num() > 0)
+		{
+			USoundNode* Node = NodesToVisit.Pop(false);
+			if (!Node)
+			{
+				continue;
+			}
+
+			if (USoundNodeWavePlayer* WavePlayer = Cast<USoundNodeWavePlayer>(Node))
+			{
+				PrefetchSoundWave(WavePlayer->GetSoundWave());
+			}
+
+			const int32 MaxChildNodes = Node->GetMaxChildNodes();
+			for (int32 ChildIndex = 0; ChildIndex < Node->ChildNodes.Num() && ChildIndex < MaxChildNodes; ++ChildIndex)
+			{
+				NodesToVisit.Add(Node->ChildNodes[ChildIndex]);
+			}
+		}
+	}
+}
+
+void FCachedAudioStreamingManager::PrefetchSoundWave(USoundWave* InSoundWave)
+{
+	// The zeroth chunk is inlined on the asset, so the first streamed chunk is chunk 1.
+	if (!InSoundWave || !InSoundWave->RunningPlatformData || InSoundWave->GetNumChunks() <= 1)
+	{
+		return;
+	}
+
+	FAudioChunkCache* Cache = GetCacheForWave(InSoundWave);
+	if (!Cache)
+	{
+		return;
+	}
+
+	const FAudioChunkCache::FChunkKey ChunkKey =
+	{
+		InSoundWave
+	  , InSoundWave->GetFName()
+	  , 1
+	  , FObjectKey(InSoundWave)
+#if WITH_EDITOR
+	  , (uint32)InSoundWave->CurrentChunkRevision.GetValue()
+#endif
+	};
+
+	// If the chunk is already cached this only touches it, which is fine since the component is about to be audible. Only count actual loads.
+	const bool bWasCached = Cache->IsChunkCached(ChunkKey);
+	if (RequestChunk(InSoundWave, 1, [](EAudioChunkLoadResult) {}, ENamedThreads::AnyThread, false) && !bWasCached)
+	{
+		Cache->IncrementPrefetchCounter();
+	}
 }
 
 int32 FCachedAudioStreamingManager::BlockTillAllRequestsFinished(float TimeLimit, bool bLogResults)
@@ -657,6 +839,7 @@ FAudioChunkCache::FAudioChunkCache(uint32 InMaxChunkSize, uint32 NumChunks, uint
 	, MemoryCounterBytes(0)
 	, MemoryLimitBytes(InMemoryLimitInBytes)
 	, bLogCacheMisses(false)
+	, StallTimeCycles(0)
 {
 	CachePool.Reset(NumChunks);
 	for (uint32 Index = 0; Index < NumChunks; Index++)
@@ -697,10 +880,15 @@ uint64 FAudioChunkCache::AddOrTouchChunk(const FChunkKey& InKey, TFunction<void(
 	if (FoundElement)
 	{
 		TouchElement(FoundElement);
+
 		if (FoundElement->bIsLoaded)
 		{
 			ExecuteOnLoadCompleteCallback(EAudioChunkLoadResult::AlreadyLoaded, OnLoadCompleted, CallbackThread);
 		}
+		else if (bNeededForPlayback)
+		{
+			RecordMiss(FoundElement);
+		}
 
 #if DEBUG_STREAM_CACHE
 		FoundElement->DebugInfo.NumTimesTouched++;
@@ -753,6 +941,11 @@ uint64 FAudioChunkCache::AddOrTouchChunk(const FChunkKey& InKey, TFunction<void(
 
 		KickOffAsyncLoad(CacheElement, InKey, OnLoadCompleted, CallbackThread, bNeededForPlayback);
 
+		if (bNeededForPlayback)
+		{
+			RecordMiss(CacheElement);
+		}
+
 		if (bNeededForPlayback && (bLogCacheMisses || AlwaysLogCacheMissesCVar))
 		{
 			// We missed 
@@ -774,11 +967,19 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, bool bBlock
 	{
 		OutCacheOffset = FoundElement->CacheLookupID;
 		TouchElement(FoundElement);
+
 		if (FoundElement->IsLoadInProgress())
 		{
+			if (bNeededForPlayback)
+			{
+				RecordMiss(FoundElement);
+			}
+
 			if (bBlockForLoadCompletion)
 			{
+				const uint64 StallStartCycles = FPlatformTime::Cycles64();
 				FoundElement->WaitForAsyncLoadCompletion(false);
+				RecordStall(StallStartCycles);
 			}
 			else
 			{
@@ -787,6 +988,12 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, bool bBlock
 		}
 
 
+		// Each consumer acquiring the chunk for playback is one use of it, however many times it was requested before.
+		if (bNeededForPlayback)
+		{
+			RecordPlaybackHit(FoundElement);
+		}
+
 		// If this value is ever negative, it means that we're decrementing more than we're incrementing:
 		check(FoundElement->NumConsumers.GetValue() >= 0);
 		FoundElement->NumConsumers.Increment();
@@ -805,8 +1012,14 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, bool bBlock
 		
 		OutCacheOffset = FoundElement->CacheLookupID;
 
+		if (bNeededForPlayback)
+		{
+			RecordMiss(FoundElement);
+		}
+
 		if (bBlockForLoadCompletion)
 		{
+			const uint64 StallStartCycles = FPlatformTime::Cycles64();
 			FStreamedAudioChunk& Chunk = InKey.SoundWave->RunningPlatformData->Chunks[InKey.ChunkIndex];
 			int32 ChunkAudioDataSize = Chunk.AudioDataSize;
 #if DEBUG_STREAM_CACHE
@@ -845,6 +1058,8 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, bool bBlock
 			FoundElement->DebugInfo.TimeToLoad = (FPlatformTime::Seconds() - FoundElement->DebugInfo.TimeLoadStarted) * 1000.0f;
 
 #endif
+			RecordStall(StallStartCycles);
+
 			// If this value is ever negative, it means that we're decrementing more than we're incrementing:
 			if (ensureMsgf(FoundElement->NumConsumers.GetValue() >= 0, TEXT("NumConsumers was negative for FoundElement. Reseting to 1")))
 			{
@@ -873,6 +1088,12 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, bool bBlock
 	}
 }
 
+bool FAudioChunkCache::IsChunkCached(const FChunkKey& InKey)
+{
+	FScopeLock ScopeLock(&CacheMutationCriticalSection);
+	return FindElementForKey(InKey, InKey.SoundWave->GetCacheLookupIDForChunk(InKey.ChunkIndex)) != nullptr;
+}
+
 void FAudioChunkCache::AddNewReferenceToChunk(const FChunkKey& InKey, uint64 ChunkOffset)
 {
 	FScopeLock ScopeLock(&CacheMutationCriticalSection);
@@ -1270,6 +1491,71 @@ void FAudioChunkCache::TouchElement(FCacheElement* InElement)
 	}
 }
 
+void FAudioChunkCache::RecordPlaybackHit(FCacheElement* InElement)
+{
+	InElement->NumPlaybackHits++;
+
+	if (ProtectFrequentlyUsedChunksCVar > 0 && InElement->NumPlaybackHits >= ProtectFrequentlyUsedChunksCVar)
+	{
+		InElement->bIsProtected = true;
+	}
+}
+
+void FAudioChunkCache::RecordMiss(FCacheElement* InElement)
+{
+	// A chunk can be requested and then acquired for the same playback while it loads, that's a single miss.
+	if (!InElement->bCountedAsMiss)
+	{
+		InElement->bCountedAsMiss = true;
+		CacheMissCount.Increment();
+	}
+}
+
+void FAudioChunkCache::DemoteProtectedChunk(FCacheElement* InElement)
+{
+	// Give the chunk a second pass through the cache as if it had just been requested, it must be used again to be protected again.
+	InElement->bIsProtected = false;
+	InElement->NumPlaybackHits = 0;
+	ProtectedChunksSparedCount.Increment();
+	TouchElement(InElement);
+}
+
+void FAudioChunkCache::RecordLoadLatency(double LoadTimeSeconds)
+{
+	const double LoadTimeMs = LoadTimeSeconds * 1000.0;
+
+	int32 Bucket = 0;
+	while (Bucket < NumLoadLatencyBuckets - 1 && LoadTimeMs >= (double)(1 << Bucket))
+	{
+		Bucket++;
+	}
+
+	LoadLatencyHistogram[Bucket].Increment();
+}
+
+void FAudioChunkCache::RecordStall(uint64 StallStartCycles)
+{
+	StallCount.Increment();
+	StallTimeCycles += FPlatformTime::Cycles64() - StallStartCycles;
+}
+
+FAudioChunkCache::FCacheStats FAudioChunkCache::GetCacheStats() const
+{
+	FCacheStats Stats;
+	Stats.NumMisses = CacheMissCount.GetValue();
+	Stats.NumStalls = StallCount.GetValue();
+	Stats.StallTimeMs = FPlatformTime::ToMilliseconds64(StallTimeCycles.Load());
+	Stats.NumPrefetches = PrefetchCount.GetValue();
+	Stats.NumProtectedChunksSpared = ProtectedChunksSparedCount.GetValue();
+
+	for (int32 Bucket = 0; Bucket < NumLoadLatencyBuckets; Bucket++)
+	{
+		Stats.LoadLatencyHistogram[Bucket] = LoadLatencyHistogram[Bucket].GetValue();
+	}
+
+	return Stats;
+}
+
 bool FAudioChunkCache::ShouldAddNewChunk() const
 {
 	return (ChunksInUse < CachePool.Num()) && (MemoryCounterBytes.Load() < MemoryLimitBytes);
@@ -1317,6 +1603,9 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::InsertChunk(const FChunkKey&
 
 		check(CacheElement);
 		CacheElement->bIsLoaded = false;
+		CacheElement->NumPlaybackHits = 0;
+		CacheElement->bIsProtected = false;
+		CacheElement->bCountedAsMiss = false;
 		CacheElement->Key = InKey;
 		TouchElement(CacheElement);
 
@@ -1347,10 +1636,17 @@ void FAudioChunkCache::SetUpLeastRecentChunk()
 
 FAudioChunkCache::FCacheElement* FAudioChunkCache::EvictLeastRecentChunk(bool bBlockForPendingLoads /* = false */)
 {
+	// Protected chunks that reach the least recent end are moved back to the most recent end instead of being evicted.
+	// Each is demoted once, so this stops after at most one pass over the cache.
+	for (int32 NumDemoted = 0; NumDemoted < ChunksInUse && LeastRecentElement->bIsProtected && LeastRecentElement->CanEvictChunk(); ++NumDemoted)
+	{
+		DemoteProtectedChunk(LeastRecentElement);
+	}
+
 	FCacheElement* CacheElement = LeastRecentElement;
 
-	// If the least recent chunk is evictable, evict it.
-	bool bIsChunkEvictable = CacheElement->CanEvictChunk();
+	// If the least recent chunk is evictable and not protected, evict it.
+	bool bIsChunkEvictable = CacheElement->CanEvictChunk() && !CacheElement->bIsProtected;
 	bool bIsChunkLoadingButUnreferenced = (CacheElement->IsLoadInProgress() && !CacheElement->IsInUse());
 
 	if (bIsChunkEvictable)
@@ -1380,6 +1676,9 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::EvictLeastRecentChunk(bool bB
 		// In order to avoid cycles, we always leave at least two chunks in the cache.
 		const FCacheElement* ElementToStopAt = MostRecentElement->LessRecentElement;
 
+		// Whether we demoted a protected chunk on the way up, which makes it a candidate for another crawl if this one fails.
+		bool bDemotedProtectedChunk = false;
+
 		// Otherwise, we need to crawl up the cache from least recent used to most to find a chunk that is not in use:
 		while (CacheElement && CacheElement != ElementToStopAt)
 		{
@@ -1387,6 +1686,16 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::EvictLeastRecentChunk(bool bB
 			bIsChunkEvictable = CacheElement->CanEvictChunk();
 			bIsChunkLoadingButUnreferenced = (CacheElement->IsLoadInProgress() && !CacheElement->IsInUse());
 
+			// Protected chunks get a second chance: move them back to the most recent end and keep looking.
+			if (bIsChunkEvictable && CacheElement->bIsProtected)
+			{
+				FCacheElement* DemotedElement = CacheElement;
+				CacheElement = CacheElement->MoreRecentElement;
+				DemoteProtectedChunk(DemotedElement);
+				bDemotedProtectedChunk = true;
+				continue;
+			}
+
 			if (bIsChunkEvictable)
 			{
 				// Link the two neighboring chunks:
@@ -1421,6 +1730,12 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::EvictLeastRecentChunk(bool bB
 			}
 		}
 
+		// If every evictable chunk was protected, they're unprotected near the most recent end now, so the next crawl will find one.
+		if ((!CacheElement || CacheElement == ElementToStopAt) && bDemotedProtectedChunk)
+		{
+			return EvictLeastRecentChunk(bBlockForPendingLoads);
+		}
+
 		// If we ever hit this, it means that we couldn't find any cache elements that aren't in use.
 		if (!CacheElement || CacheElement == ElementToStopAt)
 		{
@@ -1523,6 +1838,8 @@ void FAudioChunkCache::KickOffAsyncLoad(FCacheElement* CacheElement, const FChun
 
 	MemoryCounterBytes += CacheElement->ChunkDataSize;
 
+	CacheElement->TimeLoadStarted = FPlatformTime::Seconds();
+
 #if DEBUG_STREAM_CACHE
 	CacheElement->DebugInfo.NumTotalChunks = InKey.SoundWave->GetNumChunks() - 1;
 	CacheElement->DebugInfo.LoadingBehavior = InKey.SoundWave->GetLoadingBehavior(false);
@@ -1549,13 +1866,18 @@ void FAudioChunkCache::KickOffAsyncLoad(FCacheElement* CacheElement, const FChun
 #endif
 
 
-		TFunction<void(bool)> OnLoadComplete = [OnLoadCompleted, CallbackThread, CacheElement, InKey, ChunkDataSize](bool bRequestFailed)
+		TFunction<void(bool)> OnLoadComplete = [this, OnLoadCompleted, CallbackThread, CacheElement, InKey, ChunkDataSize](bool bRequestFailed)
 		{
 			// Populate key and DataSize. The async read request was set up to write directly into CacheElement->ChunkData.
 			CacheElement->Key = InKey;
 			CacheElement->ChunkDataSize = ChunkDataSize;
 			CacheElement->bIsLoaded = true;
 
+			if (!bRequestFailed)
+			{
+				RecordLoadLatency(FPlatformTime::Seconds() - CacheElement->TimeLoadStarted);
+			}
+
 #if DEBUG_STREAM_CACHE
 			CacheElement->DebugInfo.TimeToLoad = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - CacheElement->DebugInfo.TimeLoadStarted);
 #endif
@@ -1609,6 +1931,11 @@ void FAudioChunkCache::KickOffAsyncLoad(FCacheElement* CacheElement, const FChun
 			CacheElement->ChunkDataSize = ChunkDataSize;
 			CacheElement->bIsLoaded = true;
 
+			if (!bWasCancelled)
+			{
+				RecordLoadLatency(FPlatformTime::Seconds() - CacheElement->TimeLoadStarted);
+			}
+
 #if DEBUG_STREAM_CACHE
 			CacheElement->DebugInfo.TimeToLoad = (FPlatformTime::Seconds() - CacheElement->DebugInfo.TimeLoadStarted) * 1000.0f;
 #endif
@@ -1851,6 +2178,11 @@ TPair<int, int> FAudioChunkCache::DebugDisplay(UWorld* World, FViewport* Viewpor
 	Canvas->DrawShadowedString(X + CacheTitleOffsetX, Y - 12, *CacheOverflowsDetail, UEngine::GetSmallFont(), NumCacheOverflows != 0? FLinearColor::Red : FLinearColor::Green);
 	Y += 10;
 
+	const FCacheStats Stats = GetCacheStats();
+	FString CacheStatsDetail = *FString::Printf(TEXT("Misses: %d Stalls: %d (%.2f ms) Prefetches: %d Protected chunks spared: %d"), Stats.NumMisses, Stats.NumStalls, Stats.StallTimeMs, Stats.NumPrefetches, Stats.NumProtectedChunksSpared);
+	Canvas->DrawShadowedString(X + CacheTitleOffsetX, Y - 12, *CacheStatsDetail, UEngine::GetSmallFont(), Stats.NumStalls != 0 ? FLinearColor::Yellow : FLinearColor::Green);
+	Y += 10;
+
 	// First pass: We run through and get a snap shot of the amount of memory currently in use.
 	FCacheElement* CurrentElement = MostRecentElement;
 	uint32 NumBytesCounter = 0;
@@ -1988,6 +2320,22 @@ FString FAudioChunkCache::DebugPrint()
 	OutputString += NumElementsDetail + TEXT("\n");
 	OutputString += NumCacheOverflows + TEXT("\n");
 
+	const FCacheStats Stats = GetCacheStats();
+	OutputString += FString::Printf(TEXT("Misses: %d, Stalls: %d (%.2f ms), Prefetches: %d, Protected chunks spared: %d\n"), Stats.NumMisses, Stats.NumStalls, Stats.StallTimeMs, Stats.NumPrefetches, Stats.NumProtectedChunksSpared);
+
+	OutputString += TEXT("Load latency:");
+	for (int32 Bucket = 0; Bucket < NumLoadLatencyBuckets; Bucket++)
+	{
+		if (Bucket < NumLoadLatencyBuckets - 1)
+		{
+			OutputString += FString::Printf(TEXT(" <%dms: %d,"), 1 << Bucket, Stats.LoadLatencyHistogram[Bucket]);
+		}
+		else
+		{
+			OutputString += FString::Printf(TEXT(" >=%dms: %d\n"), 1 << (Bucket - 1), Stats.LoadLatencyHistogram[Bucket]);
+		}
+	}
+
 	// First pass: We run through and get a snap shot of the amount of memory currently in use.
 	FCacheElement* CurrentElement = MostRecentElement;
 	uint32 NumBytesCounter = 0;
@@ -42,6 +42,20 @@ FAutoConsoleVariableRef CVarVirtualLoopsUpdateRateMax(
 	TEXT("Sets maximum rate to check if sound becomes audible again (at beyond sound's max audible distance + perf scaling distance).\n"),
 	ECVF_Default);
 
+static int32 VirtualLoopsSpatialHashMinLoopsCVar = 64;
+FAutoConsoleVariableRef CVarVirtualLoopsSpatialHashMinLoops(
+	TEXT("au.VirtualLoops.SpatialHash.MinLoops"),
+	VirtualLoopsSpatialHashMinLoopsCVar,
+	TEXT("Minimum number of virtual loops required to cull forced realization checks using a spatial hash (0 disables spatial hashing).\n"),
+	ECVF_Default);
+
+static float VirtualLoopsSpatialHashCellSizeCVar = 10000.0f;
+FAutoConsoleVariableRef CVarVirtualLoopsSpatialHashCellSize(
+	TEXT("au.VirtualLoops.SpatialHash.CellSize"),
+	VirtualLoopsSpatialHashCellSizeCVar,
+	TEXT("Size (in world units) of the cells used to spatially hash virtual loops.\n"),
+	ECVF_Default);
+
 
 FAudioVirtualLoop::FAudioVirtualLoop()
 	: TimeSinceLastUpdate(0.0f)
@@ -97,6 +111,13 @@ void FAudioVirtualLoop::CalculateUpdateInterval()
 	check(AudioDevice);
 
 	const float DistanceToListener = AudioDevice->GetDistanceToNearestListener(ActiveSound->Transform.GetLocation());
+	CalculateUpdateInterval(DistanceToListener);
+}
+
+void FAudioVirtualLoop::CalculateUpdateInterval(float DistanceToListener)
+{
+	check(ActiveSound);
+
 	const float DistanceRatio = (DistanceToListener - ActiveSound->MaxDistance) / FMath::Max(VirtualLoopsPerfDistanceCVar, 1.0f);
 	const float DistanceRatioClamped = FMath::Clamp(DistanceRatio, 0.0f, 1.0f);
 	UpdateInterval = FMath::Lerp(VirtualLoopsUpdateRateMinCVar, VirtualLoopsUpdateRateMaxCVar, DistanceRatioClamped);
@@ -129,23 +150,16 @@ bool FAudioVirtualLoop::IsEnabled()
 	return bVirtualLoopsEnabledCVar != 0;
 }
 
-bool FAudioVirtualLoop::IsInAudibleRange(const FActiveSound& InActiveSound, const FAudioDevice* InAudioDevice)
+float FAudioVirtualLoop::GetAudibleDistance(const FActiveSound& InActiveSound)
 {
 	if (!InActiveSound.bAllowSpatialization)
 	{
-		return true;
+		return WORLD_MAX;
 	}
 
-	const FAudioDevice* AudioDevice = InAudioDevice;
-	if (!AudioDevice)
-	{
-		AudioDevice = InActiveSound.AudioDevice;
-	}
-	check(AudioDevice);
-
 	if (InActiveSound.IsPlayWhenSilent())
 	{
-		return true;
+		return WORLD_MAX;
 	}
 
 	float DistanceScale = 1.0f;
@@ -154,15 +168,33 @@ bool FAudioVirtualLoop::IsInAudibleRange(const FActiveSound& InActiveSound, cons
 		// If we are not using distance-based attenuation, this sound will be audible regardless of distance.
 		if (!InActiveSound.AttenuationSettings.bAttenuate)
 		{
-			return true;
+			return WORLD_MAX;
 		}
 
 		DistanceScale = InActiveSound.FocusData.DistanceScale;
 	}
 
 	DistanceScale = FMath::Max(DistanceScale, KINDA_SMALL_NUMBER);
+	return InActiveSound.MaxDistance / DistanceScale;
+}
+
+bool FAudioVirtualLoop::IsInAudibleRange(const FActiveSound& InActiveSound, const FAudioDevice* InAudioDevice)
+{
+	const FAudioDevice* AudioDevice = InAudioDevice;
+	if (!AudioDevice)
+	{
+		AudioDevice = InActiveSound.AudioDevice;
+	}
+	check(AudioDevice);
+
+	const float AudibleDistance = GetAudibleDistance(InActiveSound);
+	if (AudibleDistance >= WORLD_MAX)
+	{
+		return true;
+	}
+
 	const FVector Location = InActiveSound.Transform.GetLocation();
-	return AudioDevice->LocationIsAudible(Location, InActiveSound.MaxDistance / DistanceScale);
+	return AudioDevice->LocationIsAudible(Location, AudibleDistance);
 }
 
 void FAudioVirtualLoop::UpdateFocusData(float DeltaTime)
@@ -188,7 +220,7 @@ void FAudioVirtualLoop::UpdateFocusData(float DeltaTime)
 	ActiveSound->UpdateFocusData(DeltaTime, ListenerData);
 }
 
-bool FAudioVirtualLoop::Update(float DeltaTime, bool bForceUpdate)
+bool FAudioVirtualLoop::Update(float DeltaTime, bool bForceUpdate, bool bMayBeAudible, float CulledDistanceToListener)
 {
 	// Keep playback time up-to-date as it may be used to evaluate whether or
 	// not virtual sound is eligible for playback when compared against
@@ -216,6 +248,14 @@ bool FAudioVirtualLoop::Update(float DeltaTime, bool bForceUpdate)
 	Audio::FAudioDebugger::DrawDebugInfo(*this);
 #endif // ENABLE_AUDIO_DEBUG
 
+	// Known to be out of range of all listeners, so skip evaluating focus and range. The culling
+	// cell's distance is no greater than the loop's, so the resulting interval is never longer.
+	if (!bMayBeAudible)
+	{
+		CalculateUpdateInterval(CulledDistanceToListener);
+		return false;
+	}
+
 	UpdateFocusData(UpdateDelta);
 
 	// If not audible, update when will be checked again and return false
@@ -233,4 +273,112 @@ bool FAudioVirtualLoop::ShouldListenerMoveForceUpdate(const FTransform& LastTran
 	const float DistanceSq = FVector::DistSquared(LastTransform.GetTranslation(), CurrentTransform.GetTranslation());
 	const float ForceUpdateDistSq = VirtualLoopsForceUpdateListenerMoveDistanceCVar * VirtualLoopsForceUpdateListenerMoveDistanceCVar;
 	return DistanceSq > ForceUpdateDistSq;
-}
\ No newline at end of file
+}
+
+FAudioVirtualLoopSpatialHash::FAudioVirtualLoopSpatialHash()
+	: CellSize(VirtualLoopsSpatialHashCellSizeCVar)
+	, NumAudibleCells(0)
+	, bNeedsRebuild(true)
+{
+}
+
+bool FAudioVirtualLoopSpatialHash::IsEnabled(int32 NumVirtualLoops)
+{
+	return VirtualLoopsSpatialHashMinLoopsCVar > 0 && NumVirtualLoops >= VirtualLoopsSpatialHashMinLoopsCVar;
+}
+
+void FAudioVirtualLoopSpatialHash::Reset()
+{
+	Cells.Reset();
+	CellSize = FMath::Max(VirtualLoopsSpatialHashCellSizeCVar, 100.0f);
+	NumAudibleCells = 0;
+	bNeedsRebuild = false;
+}
+
+void FAudioVirtualLoopSpatialHash::MarkNeedsRebuild()
+{
+	bNeedsRebuild = true;
+}
+
+bool FAudioVirtualLoopSpatialHash::NeedsRebuild() const
+{
+	return bNeedsRebuild;
+}
+
+FIntVector FAudioVirtualLoopSpatialHash::GetCellKey(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void FAudioVirtualLoopSpatialHash::Add(const FAudioVirtualLoop& VirtualLoop)
+{
+	const FActiveSound& ActiveSound = VirtualLoop.GetActiveSound();
+	const FVector Location = ActiveSound.Transform.GetLocation();
+
+	// Focus is only re-evaluated when a loop's realization check runs, so its distance scale may
+	// change once it is checked. Treat such loops as audible from anywhere to remain conservative.
+	float AudibleDistance = FAudioVirtualLoop::GetAudibleDistance(ActiveSound);
+	if (ActiveSound.bHasAttenuationSettings && ActiveSound.AttenuationSettings.bEnableListenerFocus)
+	{
+		AudibleDistance = WORLD_MAX;
+	}
+
+	FCell& Cell = Cells.FindOrAdd(GetCellKey(Location));
+	Cell.Bounds += Location;
+	Cell.MaxAudibleDistance = FMath::Max(Cell.MaxAudibleDistance, AudibleDistance);
+}
+
+void FAudioVirtualLoopSpatialHash::UpdateAudibleCells(const TArray<FVector>& ListenerLocations)
+{
+	NumAudibleCells = 0;
+	for (TPair<FIntVector, FCell>& Pair : Cells)
+	{
+		FCell& Cell = Pair.Value;
+
+		float DistanceToListenerSq = WORLD_MAX * WORLD_MAX;
+		for (const FVector& ListenerLocation : ListenerLocations)
+		{
+			DistanceToListenerSq = FMath::Min(DistanceToListenerSq, Cell.Bounds.ComputeSquaredDistanceToPoint(ListenerLocation));
+		}
+		Cell.DistanceToListener = FMath::Sqrt(DistanceToListenerSq);
+
+		Cell.bAudible = Cell.MaxAudibleDistance >= WORLD_MAX || DistanceToListenerSq < Cell.MaxAudibleDistance * Cell.MaxAudibleDistance;
+
+		if (Cell.bAudible)
+		{
+			++NumAudibleCells;
+		}
+	}
+}
+
+bool FAudioVirtualLoopSpatialHash::IsInAudibleCell(const FAudioVirtualLoop& VirtualLoop) const
+{
+	float DistanceToListener = 0.0f;
+	return IsInAudibleCell(VirtualLoop, DistanceToListener);
+}
+
+bool FAudioVirtualLoopSpatialHash::IsInAudibleCell(const FAudioVirtualLoop& VirtualLoop, float& OutDistanceToListener) const
+{
+	const FVector Location = VirtualLoop.GetActiveSound().Transform.GetLocation();
+	if (const FCell* Cell = Cells.Find(GetCellKey(Location)))
+	{
+		OutDistanceToListener = Cell->DistanceToListener;
+		return Cell->bAudible;
+	}
+
+	OutDistanceToListener = 0.0f;
+	return true;
+}
+
+int32 FAudioVirtualLoopSpatialHash::GetNumCells() const
+{
+	return Cells.Num();
+}
+
+int32 FAudioVirtualLoopSpatialHash::GetNumAudibleCells() const
+{
+	return NumAudibleCells;
+}
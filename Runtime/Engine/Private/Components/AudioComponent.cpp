@@ -13,6 +13,8 @@
 #include "UObject/FrameworkObjectVersion.h"
 #include "Misc/App.h"
 #include "Kismet/GameplayStatics.h"
+#include "AudioCompressionSettingsUtils.h"
+#include "ContentStreaming.h"
 
 
 
@@ -233,6 +235,12 @@ void UAudioComponent::OnRegister()
 
 	Super::OnRegister();
 
+	// Let the stream cache prefetch our sound as views approach this component.
+	if (FPlatformCompressionUtilities::IsCurrentPlatformUsingStreamCaching() && GetWorld() && GetWorld()->IsGameWorld())
+	{
+		IStreamingManager::Get().GetAudioStreamingManager().AddPrefetchAudioComponent(this);
+	}
+
 	#if WITH_EDITORONLY_DATA
 	UpdateSpriteTexture();
 	#endif
@@ -243,6 +251,11 @@ void UAudioComponent::OnUnregister()
 	// Route OnUnregister event.
 	Super::OnUnregister();
 
+	if (FPlatformCompressionUtilities::IsCurrentPlatformUsingStreamCaching() && !IStreamingManager::HasShutdown())
+	{
+		IStreamingManager::Get().GetAudioStreamingManager().RemovePrefetchAudioComponent(this);
+	}
+
 	// Don't stop audio and clean up component if owner has been destroyed (default behaviour). This function gets
 	// called from AActor::ClearComponents when an actor gets destroyed which is not usually what we want for one-
 	// shot sounds.
@@ -309,8 +322,7 @@ void UAudioComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFla
 				FActiveSound* ActiveSound = AudioDevice->FindActiveSound(MyAudioComponentID);
 				if (ActiveSound)
 				{
-					ActiveSound->Transform = MyTransform;
-
+					AudioDevice->SetActiveSoundTransform(*ActiveSound, MyTransform);
 				}
 			}, GET_STATID(STAT_AudioUpdateComponentTransform));
 		}
@@ -1399,7 +1411,7 @@ void UAudioComponent::AdjustAttenuation(const FSoundAttenuationSettings& InAtten
 				FActiveSound* ActiveSound = AudioDevice->FindActiveSound(MyAudioComponentID);
 				if (ActiveSound)
 				{
-					ActiveSound->AttenuationSettings = InAttenuationSettings;
+					AudioDevice->SetActiveSoundAttenuationSettings(*ActiveSound, InAttenuationSettings);
 				}
 			}, GET_STATID(STAT_AudioAdjustAttenuation));
 		}
@@ -68,6 +68,14 @@ static FAutoConsoleVariableRef CVarAllowCachedOverlaps(
 	TEXT("0: disable cached overlaps, 1: enable (default)"),
 	ECVF_Default);
 
+static int32 UpdateOverlapsHashedDiffMinOverlapsCVar = 16;
+static FAutoConsoleVariableRef CVarUpdateOverlapsHashedDiffMinOverlaps(
+	TEXT("p.UpdateOverlapsHashedDiffMinOverlaps"),
+	UpdateOverlapsHashedDiffMinOverlapsCVar,
+	TEXT("Number of old or new overlaps above which UpdateOverlaps compares them with hash sets rather than pairwise.\n")
+	TEXT("0: always use hash sets, <0: never use hash sets"),
+	ECVF_Default);
+
 static float InitialOverlapToleranceCVar = 0.0f;
 static FAutoConsoleVariableRef CVarInitialOverlapTolerance(
 	TEXT("p.InitialOverlapTolerance"),
@@ -190,6 +198,50 @@ FORCEINLINE_DEBUGGABLE int32 IndexOfOverlapFast(const TArray<const FOverlapInfo*
 	return OverlapPtrArray.IndexOfByPredicate(FFastOverlapInfoCompare(*SearchItem));
 }
 
+// Key funcs for sets of FOverlapInfo pointers that match like FFastOverlapInfoCompare.
+struct FFastOverlapInfoPtrKeyFuncs : BaseKeyFuncs<const FOverlapInfo*, const FOverlapInfo*, false>
+{
+	static FORCEINLINE KeyInitType GetSetKey(ElementInitType Element)
+	{
+		return Element;
+	}
+
+	static FORCEINLINE bool Matches(KeyInitType A, KeyInitType B)
+	{
+		return FFastOverlapInfoCompare(*A)(B);
+	}
+
+	static FORCEINLINE uint32 GetKeyHash(KeyInitType Key)
+	{
+		return HashCombine(GetTypeHash(Key->OverlapInfo.Component), (uint32)Key->GetBodyIndex());
+	}
+};
+
+typedef TSet<const FOverlapInfo*, FFastOverlapInfoPtrKeyFuncs, TInlineSetAllocator<32>> TInlineOverlapPointerSet;
+
+// Removes the overlaps common to both arrays, leaving only the old overlaps that ended and the new overlaps that began. Order is not preserved.
+template<class AllocatorType>
+static void RemoveCommonOverlapsHashed(TArray<const FOverlapInfo*, AllocatorType>& OldOverlapPtrs, TArray<const FOverlapInfo*, AllocatorType>& NewOverlapPtrs)
+{
+	TInlineOverlapPointerSet OldOverlapSet;
+	OldOverlapSet.Reserve(OldOverlapPtrs.Num());
+	for (const FOverlapInfo* OldOverlap : OldOverlapPtrs)
+	{
+		OldOverlapSet.Add(OldOverlap);
+	}
+
+	TInlineOverlapPointerSet NewOverlapSet;
+	NewOverlapSet.Reserve(NewOverlapPtrs.Num());
+	for (const FOverlapInfo* NewOverlap : NewOverlapPtrs)
+	{
+		NewOverlapSet.Add(NewOverlap);
+	}
+
+	const bool bAllowShrinking = false;
+	OldOverlapPtrs.RemoveAllSwap([&NewOverlapSet](const FOverlapInfo* OldOverlap) { return NewOverlapSet.Contains(OldOverlap); }, bAllowShrinking);
+	NewOverlapPtrs.RemoveAllSwap([&OldOverlapSet](const FOverlapInfo* NewOverlap) { return OldOverlapSet.Contains(NewOverlap); }, bAllowShrinking);
+}
+
 // Helper for adding an FOverlapInfo uniquely to an Array, using IndexOfOverlapFast and knowing that at least one overlap is valid (non-null).
 template<class AllocatorType>
 FORCEINLINE_DEBUGGABLE void AddUniqueOverlapFast(TArray<FOverlapInfo, AllocatorType>& OverlapArray, FOverlapInfo& NewOverlap)
@@ -3279,18 +3331,27 @@ bool UPrimitiveComponent::UpdateOverlapsImpl(const TOverlapArrayView* NewPending
 				// what overlaps are in new and not in old (need begin overlap notifies).
 				// We do this by removing common entries from both lists, since overlapping status has not changed for them.
 				// What is left over will be what has changed.
-				for (int32 CompIdx=0; CompIdx < OldOverlappingComponentPtrs.Num() && NewOverlappingComponentPtrs.Num() > 0; ++CompIdx)
+				// With many overlaps (e.g. a trigger full of pawns) the pairwise search is quadratic, so compare through hash sets instead.
+				const int32 MaxNumOverlaps = FMath::Max(OldOverlappingComponentPtrs.Num(), NewOverlappingComponentPtrs.Num());
+				if (UpdateOverlapsHashedDiffMinOverlapsCVar >= 0 && MaxNumOverlaps > UpdateOverlapsHashedDiffMinOverlapsCVar)
 				{
-					// RemoveAtSwap is ok, since it is not necessary to maintain order
-					const bool bAllowShrinking = false;
-
-					const FOverlapInfo* SearchItem = OldOverlappingComponentPtrs[CompIdx];
-					const int32 NewElementIdx = IndexOfOverlapFast(NewOverlappingComponentPtrs, SearchItem);
-					if (NewElementIdx != INDEX_NONE)
+					RemoveCommonOverlapsHashed(OldOverlappingComponentPtrs, NewOverlappingComponentPtrs);
+				}
+				else
+				{
+					for (int32 CompIdx=0; CompIdx < OldOverlappingComponentPtrs.Num() && NewOverlappingComponentPtrs.Num() > 0; ++CompIdx)
 					{
-						NewOverlappingComponentPtrs.RemoveAtSwap(NewElementIdx, 1, bAllowShrinking);
-						OldOverlappingComponentPtrs.RemoveAtSwap(CompIdx, 1, bAllowShrinking);
-						--CompIdx;
+						// RemoveAtSwap is ok, since it is not necessary to maintain order
+						const bool bAllowShrinking = false;
+
+						const FOverlapInfo* SearchItem = OldOverlappingComponentPtrs[CompIdx];
+						const int32 NewElementIdx = IndexOfOverlapFast(NewOverlappingComponentPtrs, SearchItem);
+						if (NewElementIdx != INDEX_NONE)
+						{
+							NewOverlappingComponentPtrs.RemoveAtSwap(NewElementIdx, 1, bAllowShrinking);
+							OldOverlappingComponentPtrs.RemoveAtSwap(CompIdx, 1, bAllowShrinking);
+							--CompIdx;
+						}
 					}
 				}
 
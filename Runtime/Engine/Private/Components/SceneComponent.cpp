@@ -34,6 +34,7 @@
 #include "Interfaces/ITargetPlatform.h"
 #include "DeviceProfiles/DeviceProfile.h"
 #include "Net/Core/PushModel/PushModel.h"
+#include "Algo/Sort.h"
 
 #if WITH_EDITOR
 #include "Settings/LevelEditorViewportSettings.h"	// For legacy post edit move behavior
@@ -719,6 +720,12 @@ void USceneComponent::OnUnregister()
 {
 	CachedLevelCollection = nullptr;
 
+	// Don't leave our children at a stale transform.
+	if (bPendingDeferredChildTransformUpdate)
+	{
+		FlushDeferredChildTransformUpdatesInHierarchy();
+	}
+
 	Super::OnUnregister();
 }
 
@@ -771,7 +778,12 @@ void USceneComponent::PropagateTransformUpdate(bool bTransformChanged, EUpdateTr
 			if (AttachedChildren.Num() > 0)
 			{
 				EUpdateTransformFlags ChildrenFlagNoPhysics = ~EUpdateTransformFlags::SkipPhysicsUpdate & UpdateTransformFlags;
-				UpdateChildTransforms(ChildrenFlagNoPhysics, Teleport);
+				if (!TryDeferChildTransformUpdate(ChildrenFlagNoPhysics, Teleport))
+				{
+					// Updating the children now also satisfies any update deferred earlier.
+					bPendingDeferredChildTransformUpdate = false;
+					UpdateChildTransforms(ChildrenFlagNoPhysics, Teleport);
+				}
 			}
 		}
 
@@ -3740,6 +3752,153 @@ void USceneComponent::SetShouldUpdatePhysicsVolume(bool bInShouldUpdatePhysicsVo
 int USceneComponent::SkipUpdateOverlapsOptimEnabled = 1;
 static FAutoConsoleVariableRef CVarSkipUpdateOverlapsOptimEnabled(TEXT("p.SkipUpdateOverlapsOptimEnabled"), USceneComponent::SkipUpdateOverlapsOptimEnabled, TEXT("If enabled, we cache whether we need to call UpdateOverlaps on certain components"));
 
+static int32 GDeferChildTransformUpdates = 1;
+static FAutoConsoleVariableRef CVarDeferChildTransformUpdates(
+	TEXT("SceneComponent.DeferChildTransformUpdates"),
+	GDeferChildTransformUpdates,
+	TEXT("If enabled, components with bDeferChildTransformUpdates set update their attached children once per tick group rather than every time they move."));
+
+namespace SceneComponentDeferredTransforms
+{
+	struct FPendingUpdate
+	{
+		EUpdateTransformFlags UpdateTransformFlags;
+		ETeleportType Teleport;
+	};
+
+	/** Components whose child transform updates are deferred until FlushDeferredChildTransformUpdates. Only accessed on the game thread. */
+	static TMap<TWeakObjectPtr<USceneComponent>, FPendingUpdate> PendingUpdates;
+
+	static bool bIsFlushing = false;
+}
+
+bool USceneComponent::TryDeferChildTransformUpdate(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	using namespace SceneComponentDeferredTransforms;
+
+	if (!bDeferChildTransformUpdates || !GDeferChildTransformUpdates || bIsFlushing || !bRegistered || !IsInGameThread())
+	{
+		return false;
+	}
+
+	FPendingUpdate* PendingUpdate = PendingUpdates.Find(this);
+	if (PendingUpdate && bPendingDeferredChildTransformUpdate)
+	{
+		// Only keep restrictions that apply to every coalesced move, and teleport if any of them did.
+		PendingUpdate->UpdateTransformFlags &= UpdateTransformFlags;
+		PendingUpdate->Teleport = FMath::Max(PendingUpdate->Teleport, Teleport);
+	}
+	else if (PendingUpdate)
+	{
+		// Left by the flush of a parent's hierarchy, which updated our children but not with our teleport.
+		PendingUpdate->UpdateTransformFlags = UpdateTransformFlags;
+		PendingUpdate->Teleport = FMath::Max(PendingUpdate->Teleport, Teleport);
+		bPendingDeferredChildTransformUpdate = true;
+	}
+	else
+	{
+		PendingUpdates.Add(this, FPendingUpdate{ UpdateTransformFlags, Teleport });
+		bPendingDeferredChildTransformUpdate = true;
+	}
+
+	return true;
+}
+
+void USceneComponent::FlushDeferredChildTransformUpdates()
+{
+	using namespace SceneComponentDeferredTransforms;
+
+	if (PendingUpdates.Num() == 0 || bIsFlushing)
+	{
+		return;
+	}
+
+	check(IsInGameThread());
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_USceneComponent_FlushDeferredChildTransformUpdates);
+	TGuardValue<bool> FlushGuard(bIsFlushing, true);
+
+	struct FComponentToFlush
+	{
+		USceneComponent* Component;
+		int32 AttachDepth;
+		FPendingUpdate PendingUpdate;
+	};
+
+	TArray<FComponentToFlush, TInlineAllocator<64>> ComponentsToFlush;
+	ComponentsToFlush.Reserve(PendingUpdates.Num());
+
+	for (const TPair<TWeakObjectPtr<USceneComponent>, FPendingUpdate>& Pair : PendingUpdates)
+	{
+		if (USceneComponent* Component = Pair.Key.Get())
+		{
+			int32 AttachDepth = 0;
+			for (const USceneComponent* Parent = Component->GetAttachParent(); Parent; Parent = Parent->GetAttachParent())
+			{
+				++AttachDepth;
+			}
+			ComponentsToFlush.Add({ Component, AttachDepth, Pair.Value });
+		}
+	}
+	PendingUpdates.Reset();
+
+	// Resolve hierarchies breadth first. Updating a component's children clears the pending flag of any pending descendants,
+	// so each hierarchy is only walked once from its highest moved component.
+	Algo::SortBy(ComponentsToFlush, &FComponentToFlush::AttachDepth);
+
+	for (const FComponentToFlush& ToFlush : ComponentsToFlush)
+	{
+		USceneComponent* Component = ToFlush.Component;
+
+		// A descendant that teleported still needs to pass the teleport on to its own children.
+		if (Component->bPendingDeferredChildTransformUpdate || ToFlush.PendingUpdate.Teleport != ETeleportType::None)
+		{
+			Component->bPendingDeferredChildTransformUpdate = false;
+			if (Component->IsRegistered())
+			{
+				Component->UpdateChildTransforms(ToFlush.PendingUpdate.UpdateTransformFlags, ToFlush.PendingUpdate.Teleport);
+			}
+		}
+	}
+}
+
+void USceneComponent::FlushDeferredChildTransformUpdatesInHierarchy()
+{
+	using namespace SceneComponentDeferredTransforms;
+
+	if (PendingUpdates.Num() == 0 || bIsFlushing)
+	{
+		return;
+	}
+
+	// Our transform is stale if any of our parents deferred its child updates, and our children's are if we did.
+	// Updating from the highest of them brings the whole branch up to date.
+	USceneComponent* DeferredRoot = nullptr;
+	for (USceneComponent* Component = this; Component; Component = Component->GetAttachParent())
+	{
+		if (Component->bPendingDeferredChildTransformUpdate)
+		{
+			DeferredRoot = Component;
+		}
+	}
+
+	if (DeferredRoot == nullptr)
+	{
+		return;
+	}
+
+	check(IsInGameThread());
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_USceneComponent_FlushDeferredChildTransformUpdatesInHierarchy);
+	TGuardValue<bool> FlushGuard(bIsFlushing, true);
+
+	FPendingUpdate PendingUpdate;
+	DeferredRoot->bPendingDeferredChildTransformUpdate = false;
+	if (PendingUpdates.RemoveAndCopyValue(DeferredRoot, PendingUpdate) && DeferredRoot->IsRegistered())
+	{
+		// Pending descendants keep their entry, FlushDeferredChildTransformUpdates skips them unless they teleported.
+		DeferredRoot->UpdateChildTransforms(PendingUpdate.UpdateTransformFlags, PendingUpdate.Teleport);
+	}
+}
+
 #if WITH_EDITOR
 const int32 USceneComponent::GetNumUncachedStaticLightingInteractions() const
 {
@@ -6,6 +6,7 @@
 
 #include "Components/SkinnedMeshComponent.h"
 #include "Misc/App.h"
+#include "UObject/UObjectIterator.h"
 #include "RenderingThread.h"
 #include "GameFramework/PlayerController.h"
 #include "ContentStreaming.h"
@@ -47,6 +48,26 @@ static TAutoConsoleVariable<int32> CVarDrawAnimRateOptimization(
 	0,
 	TEXT("True to draw color coded boxes for anim rate."));
 
+static float GSkeletalMeshStreamingAnimUpdateRateScale = 0.0f;
+static FAutoConsoleVariableRef CVarSkeletalMeshStreamingAnimUpdateRateScale(
+	TEXT("r.Streaming.SkeletalMeshAnimUpdateRateScale"),
+	GSkeletalMeshStreamingAnimUpdateRateScale,
+	TEXT("How much the animation update rate of skinned mesh components lowers the LODs streamed for their skeletal mesh.\n")
+	TEXT("The streaming screen size of a component updating its animation at r.Streaming.SkeletalMeshAnimUpdateRateThreshold or less often\n")
+	TEXT("is divided by 1 + (Threshold - 1) * Scale, so that components skipping animation frames for being insignificant (e.g. distant crowds)\n")
+	TEXT("don't keep the higher LODs resident. 0 (default) ignores the update rate."),
+	ECVF_Scalability
+	);
+
+static int32 GSkeletalMeshStreamingAnimUpdateRateThreshold = 4;
+static FAutoConsoleVariableRef CVarSkeletalMeshStreamingAnimUpdateRateThreshold(
+	TEXT("r.Streaming.SkeletalMeshAnimUpdateRateThreshold"),
+	GSkeletalMeshStreamingAnimUpdateRateThreshold,
+	TEXT("Animation update rate from which r.Streaming.SkeletalMeshAnimUpdateRateScale applies to a skinned mesh component.\n")
+	TEXT("The streaming data of a component is only gathered again when its update rate crosses this threshold. Default is 4."),
+	ECVF_Scalability
+	);
+
 static TAutoConsoleVariable<int32> CVarEnableMorphTargets(TEXT("r.EnableMorphTargets"), 1, TEXT("Enable Morph Targets"));
 
 static TAutoConsoleVariable<int32> CVarAnimVisualizeLODs(
@@ -321,6 +342,7 @@ namespace FAnimUpdateRateManager
 USkinnedMeshComponent::USkinnedMeshComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, AnimUpdateRateParams(nullptr)
+	, StreamingAnimUpdateRate(1)
 {
 	bAutoActivate = true;
 	PrimaryComponentTick.bCanEverTick = true;
@@ -802,6 +824,44 @@ void USkinnedMeshComponent::TickUpdateRate(float DeltaTime, bool bNeedsValidRoot
 #endif // ENABLE_DRAW_DEBUG
 		}
 	}
+
+	UpdateStreamingAnimUpdateRate(false);
+}
+
+void USkinnedMeshComponent::UpdateStreamingAnimUpdateRate(bool bForceGather)
+{
+	// Gather the streaming data again when the component becomes significant or insignificant, not on every update rate change, so that skeletal mesh LODs follow it
+	const int32 Threshold = FMath::Max(GSkeletalMeshStreamingAnimUpdateRateThreshold, 2);
+	const bool bInsignificant = GSkeletalMeshStreamingAnimUpdateRateScale > 0.f && AnimUpdateRateParams && ShouldUseUpdateRateOptimizations() && GetOwner() && AnimUpdateRateParams->UpdateRate >= Threshold;
+	const int32 NewStreamingAnimUpdateRate = bInsignificant ? Threshold : 1;
+	if (NewStreamingAnimUpdateRate != StreamingAnimUpdateRate || bForceGather)
+	{
+		StreamingAnimUpdateRate = NewStreamingAnimUpdateRate;
+		if (SkeletalMesh && SkeletalMesh->IsStreamable() && IsRegistered())
+		{
+			IStreamingManager::Get().NotifyPrimitiveUpdated(this);
+		}
+	}
+}
+
+FAutoConsoleVariableSink USkinnedMeshComponent::StreamingCVarSink(FConsoleCommandDelegate::CreateStatic(&USkinnedMeshComponent::OnStreamingCVarsChanged));
+
+void USkinnedMeshComponent::OnStreamingCVarsChanged()
+{
+	static float CachedScale = GSkeletalMeshStreamingAnimUpdateRateScale;
+	static int32 CachedThreshold = GSkeletalMeshStreamingAnimUpdateRateThreshold;
+
+	if (CachedScale != GSkeletalMeshStreamingAnimUpdateRateScale || CachedThreshold != GSkeletalMeshStreamingAnimUpdateRateThreshold)
+	{
+		CachedScale = GSkeletalMeshStreamingAnimUpdateRateScale;
+		CachedThreshold = GSkeletalMeshStreamingAnimUpdateRateThreshold;
+
+		// Components that become insignificant are gathered again as usual, the ones already insignificant report a different screen size with the new settings
+		for (USkinnedMeshComponent* Component : TObjectRange<USkinnedMeshComponent>(RF_ClassDefaultObject | RF_ArchetypeObject, true, EInternalObjectFlags::PendingKill))
+		{
+			Component->UpdateStreamingAnimUpdateRate(Component->StreamingAnimUpdateRate > 1);
+		}
+	}
 }
 
 void USkinnedMeshComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
@@ -1004,7 +1064,9 @@ void USkinnedMeshComponent::GetStreamingRenderAssetInfo(FStreamingTextureLevelCo
 	if (SkeletalMesh && SkeletalMesh->IsStreamable())
 	{
 		const int32 LocalForcedLodModel = GetForcedLOD();
-		const float TexelFactor = LocalForcedLodModel > 0 ? -(SkeletalMesh->GetLODNum() - LocalForcedLodModel + 1) : Bounds.SphereRadius * 2.f;
+		// Components updating their animation less often are less significant, so stream their mesh as if it was smaller on screen
+		const float AnimSignificanceScale = 1.f / (1.f + (StreamingAnimUpdateRate - 1) * FMath::Max(GSkeletalMeshStreamingAnimUpdateRateScale, 0.f));
+		const float TexelFactor = LocalForcedLodModel > 0 ? -(SkeletalMesh->GetLODNum() - LocalForcedLodModel + 1) : Bounds.SphereRadius * 2.f * AnimSignificanceScale;
 		new (OutStreamingRenderAssets) FStreamingRenderAssetPrimitiveInfo(SkeletalMesh, Bounds, TexelFactor, PackedRelativeBox_Identity);
 	}
 }
@@ -204,6 +204,23 @@ void UCompositeDataTable::AddRow(FName RowName, const FTableRowBase& RowData)
 	// do nothing
 }
 
+void UCompositeDataTable::GetSecondaryIndexPropertyNames(TArray<FName>& OutPropertyNames) const
+{
+	Super::GetSecondaryIndexPropertyNames(OutPropertyNames);
+
+	// Parent tables are only merged when there are no loops
+	if (FindLoops(TArray<const UCompositeDataTable*>()) == nullptr)
+	{
+		for (const UDataTable* ParentTable : ParentTables)
+		{
+			if (ParentTable != nullptr)
+			{
+				ParentTable->GetSecondaryIndexPropertyNames(OutPropertyNames);
+			}
+		}
+	}
+}
+
 void UCompositeDataTable::Serialize(FArchive& Ar)
 {
 	if (Ar.IsLoading())
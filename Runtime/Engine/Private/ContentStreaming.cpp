@@ -37,6 +37,44 @@ static TAutoConsoleVariable<int32> CVarMeshStreaming(
 	TEXT("When non zero, enables mesh stremaing.\n"),
 	ECVF_ReadOnly | ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<float> CVarStreamingPredictiveViewsHorizon(
+	TEXT("r.Streaming.PredictiveViews.Horizon"),
+	1.0f,
+	TEXT("How far ahead in seconds the streaming system predicts where fast moving views are going, based on their velocity and acceleration.\n")
+	TEXT("0 disables predicted views."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarStreamingPredictiveViewsNum(
+	TEXT("r.Streaming.PredictiveViews.Num"),
+	2,
+	TEXT("Number of predicted views added for each moving view, evenly spread over the prediction horizon."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamingPredictiveViewsMinSpeed(
+	TEXT("r.Streaming.PredictiveViews.MinSpeed"),
+	1000.0f,
+	TEXT("Speed in units per second below which views are not predicted."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamingPredictiveViewsMaxSpeed(
+	TEXT("r.Streaming.PredictiveViews.MaxSpeed"),
+	50000.0f,
+	TEXT("Speed in units per second above which a view is considered to have teleported, resetting its motion history."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamingPredictiveViewsSmoothingTime(
+	TEXT("r.Streaming.PredictiveViews.SmoothingTime"),
+	0.25f,
+	TEXT("Time in seconds over which view velocity and acceleration are smoothed."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarStreamingPredictiveViewsFarBoost(
+	TEXT("r.Streaming.PredictiveViews.FarBoost"),
+	0.5f,
+	TEXT("Boost factor, relative to the view it is predicted from, of the predicted view furthest ahead.\n")
+	TEXT("Nearer predicted views are interpolated towards the boost of the view itself."),
+	ECVF_Default);
+
 
 /** Collection of views that need to be taken into account for streaming. */
 TArray<FStreamingViewInfo> IStreamingManager::CurrentViewInfos;
@@ -53,6 +91,9 @@ TArray<IStreamingManager::FSlaveLocation> IStreamingManager::SlaveLocations;
 /** Set when Tick() has been called. The first time a new view is added, it will clear out all old views. */
 bool IStreamingManager::bPendingRemoveViews = false;
 
+/** Motion history of the regular views, used to add predicted views. */
+TArray<IStreamingManager::FViewMotion> IStreamingManager::ViewMotions;
+
 /**
  * Helper function to flush resource streaming from within Core project.
  */
@@ -549,6 +590,16 @@ void IStreamingManager::SetupViewInfos( float DeltaTime )
 		}
 	}
 
+	// Add the views where the regular views are heading.
+	if ( !bUseOverrideViews )
+	{
+		AddPredictedViewInfos( DeltaTime, SplitScreenFactor );
+	}
+	else
+	{
+		ViewMotions.Reset();
+	}
+
 	// Update duration for the lasting views, removing out-dated ones.
 	for ( int32 ViewIndex=0; ViewIndex < LastingViewInfos.Num(); ++ViewIndex )
 	{
@@ -614,6 +665,99 @@ void IStreamingManager::SetupViewInfos( float DeltaTime )
 #endif
 }
 
+/**
+ * Updates the motion of the regular views and adds views where they are predicted to be within "r.Streaming.PredictiveViews.Horizon".
+ *
+ * @param DeltaTime				Time since last call in seconds
+ * @param SplitScreenFactor		Screen size factor applied to the regular views
+ */
+void IStreamingManager::AddPredictedViewInfos( float DeltaTime, float SplitScreenFactor )
+{
+	const float Horizon = CVarStreamingPredictiveViewsHorizon.GetValueOnGameThread();
+	const int32 NumPredictedViews = CVarStreamingPredictiveViewsNum.GetValueOnGameThread();
+
+	// Views are only identified by their order, so restart the history whenever the number of views changes.
+	if ( Horizon <= 0.0f || NumPredictedViews <= 0 || ViewMotions.Num() != PendingViewInfos.Num() )
+	{
+		ViewMotions.Reset();
+		if ( Horizon <= 0.0f || NumPredictedViews <= 0 )
+		{
+			return;
+		}
+	}
+
+	const float MinSpeed = CVarStreamingPredictiveViewsMinSpeed.GetValueOnGameThread();
+	const float MaxSpeed = CVarStreamingPredictiveViewsMaxSpeed.GetValueOnGameThread();
+	const float SmoothingTime = CVarStreamingPredictiveViewsSmoothingTime.GetValueOnGameThread();
+	const float FarBoost = CVarStreamingPredictiveViewsFarBoost.GetValueOnGameThread();
+
+	const bool bInitMotions = ViewMotions.Num() == 0;
+	if ( bInitMotions )
+	{
+		ViewMotions.AddDefaulted( PendingViewInfos.Num() );
+	}
+
+	for ( int32 ViewIndex=0; ViewIndex < PendingViewInfos.Num(); ++ViewIndex )
+	{
+		const FStreamingViewInfo& ViewInfo = PendingViewInfos[ ViewIndex ];
+		FViewMotion& Motion = ViewMotions[ ViewIndex ];
+
+		if ( bInitMotions )
+		{
+			Motion.Origin = ViewInfo.ViewOrigin;
+			continue;
+		}
+
+		// UpdateResourceStreaming() can be called several times per frame, only measure the motion when time has passed.
+		if ( DeltaTime > KINDA_SMALL_NUMBER )
+		{
+			const FVector InstantVelocity = ( ViewInfo.ViewOrigin - Motion.Origin ) / DeltaTime;
+			Motion.Origin = ViewInfo.ViewOrigin;
+
+			if ( InstantVelocity.SizeSquared() > FMath::Square( MaxSpeed ) )
+			{
+				// The view teleported, there is nothing to predict from.
+				Motion = FViewMotion();
+				Motion.Origin = ViewInfo.ViewOrigin;
+				continue;
+			}
+			else if ( !Motion.bHasVelocity )
+			{
+				Motion.Velocity = InstantVelocity;
+				Motion.bHasVelocity = true;
+			}
+			else
+			{
+				const float Alpha = SmoothingTime > 0.0f ? FMath::Min( DeltaTime / SmoothingTime, 1.0f ) : 1.0f;
+				const FVector NewVelocity = FMath::Lerp( Motion.Velocity, InstantVelocity, Alpha );
+				Motion.Acceleration = FMath::Lerp( Motion.Acceleration, ( NewVelocity - Motion.Velocity ) / DeltaTime, Alpha );
+				Motion.Velocity = NewVelocity;
+			}
+		}
+
+		const float Speed = Motion.Velocity.Size();
+		if ( !Motion.bHasVelocity || Speed < MinSpeed || ViewInfo.bOverrideLocation )
+		{
+			continue;
+		}
+
+		for ( int32 PredictionIndex=1; PredictionIndex <= NumPredictedViews; ++PredictionIndex )
+		{
+			const float PredictionAlpha = (float)PredictionIndex / (float)NumPredictedViews;
+			const float PredictionTime = Horizon * PredictionAlpha;
+
+			// Don't let the acceleration take over the velocity, since it is much noisier.
+			const FVector AccelerationOffset = ( 0.5f * PredictionTime * PredictionTime * Motion.Acceleration ).GetClampedToMaxSize( Speed * PredictionTime );
+			const FVector PredictedOrigin = ViewInfo.ViewOrigin + Motion.Velocity * PredictionTime + AccelerationOffset;
+
+			// The further ahead the prediction, the less it should compete with what is currently visible.
+			const float BoostFactor = ViewInfo.BoostFactor * FMath::Lerp( 1.0f, FarBoost, PredictionAlpha );
+
+			AddViewInfoToArray( CurrentViewInfos, PredictedOrigin, ViewInfo.ScreenSize * SplitScreenFactor, ViewInfo.FOVScreenSize, BoostFactor, false, 0.0f, nullptr );
+		}
+	}
+}
+
 /**
  * Adds the passed in view information to the static array.
  *
@@ -19,10 +19,13 @@ float GPriorityLevelStreamingActorsUpdateExtraTime = 5.0f;
 float GLevelStreamingUnregisterComponentsTimeLimit = 1.0f;
 int32 GLevelStreamingComponentsRegistrationGranularity = 10;
 int32 GLevelStreamingComponentsUnregistrationGranularity = 5;
+int32 GLevelStreamingParallelComponentRegistration = 1;
 int32 GLevelStreamingForceGCAfterLevelStreamedOut = 1;
 int32 GLevelStreamingContinuouslyIncrementalGCWhileLevelsPendingPurge = 1;
 int32 GLevelStreamingAllowLevelRequestsWhileAsyncLoadingInMatch = 1;
 int32 GLevelStreamingMaxLevelRequestsAtOnceWhileInMatch = 0;
+float GLevelStreamingFrameTimeBudget = 0.0f;
+int32 GLevelStreamingOrderByViewDistance = 1;
 
 static FAutoConsoleVariableRef CVarUseBackgroundLevelStreaming(
 	TEXT("s.UseBackgroundLevelStreaming"),
@@ -87,6 +90,13 @@ static FAutoConsoleVariableRef CVarLevelStreamingComponentsUnregistrationGranula
 	ECVF_Default
 	);
 
+static FAutoConsoleVariableRef CVarLevelStreamingParallelComponentRegistration(
+	TEXT("s.LevelStreamingParallelComponentRegistration"),
+	GLevelStreamingParallelComponentRegistration,
+	TEXT("Whether level streaming batches the scene proxy creation of the components registered during a frame and runs it on worker threads."),
+	ECVF_Default
+	);
+
 static FAutoConsoleVariableRef CVarForceGCAfterLevelStreamedOut(
 	TEXT("s.ForceGCAfterLevelStreamedOut"),
 	GLevelStreamingForceGCAfterLevelStreamedOut,
@@ -115,6 +125,20 @@ static FAutoConsoleVariableRef CVarMaxLevelRequestsAtOnceWhileInMatch(
 	ECVF_Default
 );
 
+static FAutoConsoleVariableRef CVarLevelStreamingFrameTimeBudget(
+	TEXT("s.LevelStreamingFrameTimeBudget"),
+	GLevelStreamingFrameTimeBudget,
+	TEXT("Game thread time shared by all AddToWorld and RemoveFromWorld calls in a frame (ms per frame). Each call still makes at least one step of progress. Set to zero to only use the per call time limits."),
+	ECVF_Default
+);
+
+static FAutoConsoleVariableRef CVarLevelStreamingOrderByViewDistance(
+	TEXT("s.LevelStreamingOrderByViewDistance"),
+	GLevelStreamingOrderByViewDistance,
+	TEXT("Whether streaming levels of equal priority are updated in order of distance to the streaming views (including predicted views), nearest first for levels streaming in and farthest first for levels streaming out."),
+	ECVF_Default
+);
+
 UStreamingSettings::UStreamingSettings()
 	: Super()
 {
@@ -37,12 +37,24 @@ const FRichCurve* FRuntimeFloatCurve::GetRichCurveConst() const
 
 UCurveFloat::UCurveFloat(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, BakeMaxError(0.001f)
 {
 }
 
 float UCurveFloat::GetFloatValue( float InTime ) const
 {
-	return FloatCurve.Eval(InTime);
+	return BakedCurve.IsBaked() ? BakedCurve.Eval(InTime) : FloatCurve.Eval(InTime);
+}
+
+void UCurveFloat::PostLoad()
+{
+	Super::PostLoad();
+
+	// Only cooked data is guaranteed not to be edited after load
+	if (bBakeOnLoad && FPlatformProperties::RequiresCookedData())
+	{
+		BakedCurve.Bake(FloatCurve, BakeMaxError);
+	}
 }
 
 TArray<FRichCurveEditInfoConst> UCurveFloat::GetCurves() const
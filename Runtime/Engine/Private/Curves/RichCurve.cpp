@@ -2407,3 +2407,295 @@ bool FCompressedRichCurve::operator==(const FCompressedRichCurve& Other) const
 		&& ConstantValueNumKeys.NumKeys == Other.ConstantValueNumKeys.NumKeys
 		&& CompressedKeys == Other.CompressedKeys;
 }
+
+/* FBakedRichCurve interface
+ *****************************************************************************/
+
+namespace BakedRichCurve
+{
+	/** Evaluates the cubics of four segments side by side, transposing their coefficients so that each register holds one degree */
+	static FORCEINLINE VectorRegister EvalCubic4(const float* Segment0, const float* Segment1, const float* Segment2, const float* Segment3, const VectorRegister& Alpha)
+	{
+		const VectorRegister Coefficients0 = VectorLoad(Segment0);
+		const VectorRegister Coefficients1 = VectorLoad(Segment1);
+		const VectorRegister Coefficients2 = VectorLoad(Segment2);
+		const VectorRegister Coefficients3 = VectorLoad(Segment3);
+
+		const VectorRegister Low01 = VectorShuffle(Coefficients0, Coefficients1, 0, 1, 0, 1);
+		const VectorRegister Low23 = VectorShuffle(Coefficients2, Coefficients3, 0, 1, 0, 1);
+		const VectorRegister High01 = VectorShuffle(Coefficients0, Coefficients1, 2, 3, 2, 3);
+		const VectorRegister High23 = VectorShuffle(Coefficients2, Coefficients3, 2, 3, 2, 3);
+
+		const VectorRegister Cubic = VectorShuffle(Low01, Low23, 0, 2, 0, 2);
+		const VectorRegister Quadratic = VectorShuffle(Low01, Low23, 1, 3, 1, 3);
+		const VectorRegister Linear = VectorShuffle(High01, High23, 0, 2, 0, 2);
+		const VectorRegister Constant = VectorShuffle(High01, High23, 1, 3, 1, 3);
+
+		return VectorMultiplyAdd(VectorMultiplyAdd(VectorMultiplyAdd(Cubic, Alpha, Quadratic), Alpha, Linear), Alpha, Constant);
+	}
+}
+
+FBakedRichCurve::FBakedRichCurve()
+	: StartTime(0.0f)
+	, EndTime(0.0f)
+	, SegmentsPerSecond(0.0f)
+	, NumSegments(0)
+	, PreInfinitySlope(0.0f)
+	, PostInfinitySlope(0.0f)
+	, CycleValueDelta(0.0f)
+	, PreInfinityExtrap(RCCE_Constant)
+	, PostInfinityExtrap(RCCE_Constant)
+	, bCycles(false)
+	, MaxError(0.0f)
+{
+}
+
+void FBakedRichCurve::Reset()
+{
+	*this = FBakedRichCurve();
+}
+
+bool FBakedRichCurve::Bake(const FRichCurve& Curve, float InMaxError, float SampleRate, int32 MaxSegments)
+{
+	Reset();
+
+	const TArray<FRichCurveKey>& Keys = Curve.GetConstRefOfKeys();
+	const int32 NumKeys = Keys.Num();
+	if (NumKeys == 0)
+	{
+		return false;
+	}
+
+	StartTime = Keys[0].Time;
+	EndTime = Keys[NumKeys - 1].Time;
+	const float Duration = EndTime - StartTime;
+
+	if (NumKeys == 1)
+	{
+		// FRichCurve::Eval returns the key value everywhere
+		NumSegments = 1;
+		Coefficients = { 0.0f, 0.0f, 0.0f, Keys[0].Value };
+		return true;
+	}
+
+	if (Duration <= 0.0f)
+	{
+		return false;
+	}
+
+	// Same extrapolation rules as FRichCurve::RemapTimeValue and FRichCurve::Eval
+	PreInfinityExtrap = Curve.PreInfinityExtrap;
+	PostInfinityExtrap = Curve.PostInfinityExtrap;
+	bCycles = (PreInfinityExtrap != RCCE_Linear && PreInfinityExtrap != RCCE_Constant) || (PostInfinityExtrap != RCCE_Linear && PostInfinityExtrap != RCCE_Constant);
+	CycleValueDelta = Keys[NumKeys - 1].Value - Keys[0].Value;
+
+	if (PreInfinityExtrap == RCCE_Linear)
+	{
+		const float DT = Keys[1].Time - Keys[0].Time;
+		PreInfinitySlope = FMath::IsNearlyZero(DT) ? 0.0f : (Keys[1].Value - Keys[0].Value) / DT;
+	}
+	if (PostInfinityExtrap == RCCE_Linear)
+	{
+		const float DT = Keys[NumKeys - 2].Time - Keys[NumKeys - 1].Time;
+		PostInfinitySlope = FMath::IsNearlyZero(DT) ? 0.0f : (Keys[NumKeys - 2].Value - Keys[NumKeys - 1].Value) / DT;
+	}
+
+	int32 NewNumSegments = FMath::Clamp(FMath::CeilToInt(Duration * SampleRate), 1, FMath::Max(MaxSegments, 1));
+	for (;;)
+	{
+		NumSegments = NewNumSegments;
+		SegmentsPerSecond = NumSegments / Duration;
+		const float SegmentDuration = Duration / NumSegments;
+
+		// Fit each segment with the cubic going through four evenly spaced samples of the exact curve, using Newton forward differences
+		Coefficients.Reset(NumSegments * 4);
+		for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+		{
+			float Samples[4];
+			for (int32 SampleIndex = 0; SampleIndex < 4; ++SampleIndex)
+			{
+				// Clamped so that rounding never evaluates the exact curve in its cycling extrapolation
+				const float SampleTime = FMath::Min(StartTime + (SegmentIndex + SampleIndex / 3.0f) * SegmentDuration, EndTime);
+				Samples[SampleIndex] = Curve.Eval(SampleTime);
+			}
+
+			const float Delta1 = Samples[1] - Samples[0];
+			const float Delta2 = Samples[2] - 2.0f * Samples[1] + Samples[0];
+			const float Delta3 = Samples[3] - 3.0f * Samples[2] + 3.0f * Samples[1] - Samples[0];
+
+			Coefficients.Add(4.5f * Delta3);
+			Coefficients.Add(4.5f * (Delta2 - Delta3));
+			Coefficients.Add(3.0f * Delta1 - 1.5f * Delta2 + Delta3);
+			Coefficients.Add(Samples[0]);
+		}
+
+		// Validate between the fitted samples, and at the keys where stepped and weighted interpolation diverge the most
+		MaxError = 0.0f;
+		for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+		{
+			for (const float Alpha : { 1.0f / 6.0f, 0.5f, 5.0f / 6.0f })
+			{
+				const float Time = StartTime + (SegmentIndex + Alpha) * SegmentDuration;
+				MaxError = FMath::Max(MaxError, FMath::Abs(Eval(Time) - Curve.Eval(Time)));
+			}
+		}
+		for (const FRichCurveKey& Key : Keys)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(Eval(Key.Time) - Curve.Eval(Key.Time)));
+		}
+
+		if (MaxError <= InMaxError)
+		{
+			return true;
+		}
+
+		if (NumSegments >= MaxSegments)
+		{
+			Reset();
+			return false;
+		}
+
+		NewNumSegments = FMath::Min(NumSegments * 2, MaxSegments);
+	}
+}
+
+float FBakedRichCurve::RemapTime(float& InTime) const
+{
+	float ValueOffset = 0.0f;
+
+	if (InTime <= StartTime && PreInfinityExtrap != RCCE_Linear && PreInfinityExtrap != RCCE_Constant)
+	{
+		int CycleCount = 0;
+		FRealCurve::CycleTime(StartTime, EndTime, InTime, CycleCount);
+
+		if (PreInfinityExtrap == RCCE_CycleWithOffset)
+		{
+			ValueOffset = -CycleValueDelta * CycleCount;
+		}
+		else if (PreInfinityExtrap == RCCE_Oscillate && CycleCount % 2 == 1)
+		{
+			InTime = StartTime + (EndTime - InTime);
+		}
+	}
+	else if (InTime >= EndTime && PostInfinityExtrap != RCCE_Linear && PostInfinityExtrap != RCCE_Constant)
+	{
+		int CycleCount = 0;
+		FRealCurve::CycleTime(StartTime, EndTime, InTime, CycleCount);
+
+		if (PostInfinityExtrap == RCCE_CycleWithOffset)
+		{
+			ValueOffset = CycleValueDelta * CycleCount;
+		}
+		else if (PostInfinityExtrap == RCCE_Oscillate && CycleCount % 2 == 1)
+		{
+			InTime = StartTime + (EndTime - InTime);
+		}
+	}
+
+	return ValueOffset;
+}
+
+const float* FBakedRichCurve::GetSegment(float InTime, float& OutAlpha) const
+{
+	const float Position = FMath::Clamp((InTime - StartTime) * SegmentsPerSecond, 0.0f, (float)NumSegments);
+	const int32 SegmentIndex = FMath::Min((int32)Position, NumSegments - 1);
+	OutAlpha = Position - SegmentIndex;
+	return Coefficients.GetData() + SegmentIndex * 4;
+}
+
+float FBakedRichCurve::Eval(float InTime) const
+{
+	checkSlow(IsBaked());
+
+	const float ValueOffset = bCycles ? RemapTime(InTime) : 0.0f;
+
+	float Alpha;
+	const float* Segment = GetSegment(InTime, Alpha);
+	return ((Segment[0] * Alpha + Segment[1]) * Alpha + Segment[2]) * Alpha + Segment[3] + GetExtrapolationOffset(InTime) + ValueOffset;
+}
+
+void FBakedRichCurve::EvalTimes(TArrayView<const float> InTimes, TArrayView<float> OutValues) const
+{
+	check(IsBaked() && InTimes.Num() == OutValues.Num());
+
+	const VectorRegister StartTimeV = VectorSetFloat1(StartTime);
+	const VectorRegister EndTimeV = VectorSetFloat1(EndTime);
+	const VectorRegister SegmentsPerSecondV = VectorSetFloat1(SegmentsPerSecond);
+	const VectorRegister NumSegmentsV = VectorSetFloat1((float)NumSegments);
+	const VectorRegister LastSegmentV = VectorSetFloat1((float)(NumSegments - 1));
+	const VectorRegister PreInfinitySlopeV = VectorSetFloat1(PreInfinitySlope);
+	const VectorRegister PostInfinitySlopeV = VectorSetFloat1(PostInfinitySlope);
+
+	int32 Index = 0;
+	for (; Index + 4 <= InTimes.Num(); Index += 4)
+	{
+		float Times[4];
+		float ValueOffsets[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		FMemory::Memcpy(Times, &InTimes[Index], sizeof(Times));
+		if (bCycles)
+		{
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				ValueOffsets[Lane] = RemapTime(Times[Lane]);
+			}
+		}
+
+		const VectorRegister TimesV = VectorLoad(Times);
+		const VectorRegister Position = VectorMin(VectorMax(VectorMultiply(VectorSubtract(TimesV, StartTimeV), SegmentsPerSecondV), GlobalVectorConstants::FloatZero), NumSegmentsV);
+		const VectorRegister SegmentIndex = VectorMin(VectorTruncate(Position), LastSegmentV);
+
+		float SegmentIndices[4];
+		VectorStore(SegmentIndex, SegmentIndices);
+
+		const float* BaseCoefficients = Coefficients.GetData();
+		VectorRegister Values = BakedRichCurve::EvalCubic4(
+			BaseCoefficients + (int32)SegmentIndices[0] * 4,
+			BaseCoefficients + (int32)SegmentIndices[1] * 4,
+			BaseCoefficients + (int32)SegmentIndices[2] * 4,
+			BaseCoefficients + (int32)SegmentIndices[3] * 4,
+			VectorSubtract(Position, SegmentIndex));
+
+		// Linear extrapolation, see GetExtrapolationOffset
+		Values = VectorMultiplyAdd(VectorMin(VectorSubtract(TimesV, StartTimeV), GlobalVectorConstants::FloatZero), PreInfinitySlopeV, Values);
+		Values = VectorMultiplyAdd(VectorMax(VectorSubtract(TimesV, EndTimeV), GlobalVectorConstants::FloatZero), PostInfinitySlopeV, Values);
+		Values = VectorAdd(Values, VectorLoad(ValueOffsets));
+
+		VectorStore(Values, &OutValues[Index]);
+	}
+
+	for (; Index < InTimes.Num(); ++Index)
+	{
+		OutValues[Index] = Eval(InTimes[Index]);
+	}
+}
+
+void FBakedRichCurve::EvalCurves(TArrayView<const FBakedRichCurve* const> Curves, float InTime, TArrayView<float> OutValues)
+{
+	check(Curves.Num() == OutValues.Num());
+
+	int32 Index = 0;
+	for (; Index + 4 <= Curves.Num(); Index += 4)
+	{
+		const float* Segments[4];
+		float Alphas[4];
+		float ValueOffsets[4];
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const FBakedRichCurve& Curve = *Curves[Index + Lane];
+			checkSlow(Curve.IsBaked());
+
+			float Time = InTime;
+			ValueOffsets[Lane] = Curve.bCycles ? Curve.RemapTime(Time) : 0.0f;
+			ValueOffsets[Lane] += Curve.GetExtrapolationOffset(Time);
+			Segments[Lane] = Curve.GetSegment(Time, Alphas[Lane]);
+		}
+
+		const VectorRegister Values = BakedRichCurve::EvalCubic4(Segments[0], Segments[1], Segments[2], Segments[3], VectorLoad(Alphas));
+		VectorStore(VectorAdd(Values, VectorLoad(ValueOffsets)), &OutValues[Index]);
+	}
+
+	for (; Index < Curves.Num(); ++Index)
+	{
+		OutValues[Index] = Curves[Index]->Eval(InTime);
+	}
+}
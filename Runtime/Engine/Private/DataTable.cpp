@@ -13,6 +13,7 @@
 #include "DataTableJSON.h"
 #include "EditorFramework/AssetImportData.h"
 #include "Engine/UserDefinedStruct.h"
+#include "Algo/BinarySearch.h"
 
 namespace
 {
@@ -64,6 +65,14 @@ UDataTable::UDataTable(const FObjectInitializer& ObjectInitializer)
 	bIgnoreExtraFields = false;
 	bIgnoreMissingFields = false;
 	bStripFromClientBuilds = false;
+	bPackRows = false;
+
+	PackedRows = nullptr;
+	PackedRowsSize = 0;
+	PackedRowsUsedSize = 0;
+	RowIndexHashShift = 0;
+	RowIndexSerial = 0;
+	bSecondaryIndicesValid = false;
 
 #if WITH_EDITORONLY_DATA
 	{ static const FAutoRegisterLocalizationDataGatheringCallback AutomaticRegistrationOfLocalizationGatherer(UDataTable::StaticClass(), &GatherDataTableForLocalization); }
@@ -75,6 +84,11 @@ void UDataTable::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEv
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UDataTable, IndexedProperties))
+	{
+		ResetSecondaryIndices();
+	}
+
 #if WITH_EDITORONLY_DATA
 	HandleDataTableChanged();
 #endif
@@ -99,6 +113,16 @@ void UDataTable::LoadStructData(FStructuredArchiveSlot Slot)
 	DATATABLE_CHANGE_SCOPE();
 
 	RowMap.Reserve(NumRows);
+
+	// Packed tables construct all their rows in a single allocation, the table was emptied so there is none yet
+	const int32 PackedRowStride = GetPackedRowStride(*LoadUsingStruct);
+	if (bPackRows && NumRows > 0 && ensure(PackedRows == nullptr))
+	{
+		PackedRowsSize = (SIZE_T)NumRows * PackedRowStride;
+		PackedRowsUsedSize = PackedRowsSize;
+		PackedRows = (uint8*)FMemory::Malloc(PackedRowsSize, LoadUsingStruct->GetMinAlignment());
+	}
+
 	for (int32 RowIdx = 0; RowIdx < NumRows; RowIdx++)
 	{
 		FStructuredArchiveRecord RowRecord = Array.EnterElement().EnterRecord();
@@ -108,7 +132,7 @@ void UDataTable::LoadStructData(FStructuredArchiveSlot Slot)
 		RowRecord << SA_VALUE(TEXT("Name"), RowName);
 
 		// Load row data
-		uint8* RowData = (uint8*)FMemory::Malloc(LoadUsingStruct->GetStructureSize());
+		uint8* RowData = PackedRows ? PackedRows + (SIZE_T)RowIdx * PackedRowStride : (uint8*)FMemory::Malloc(LoadUsingStruct->GetStructureSize());
 
 		// And be sure to call DestroyScriptStruct later
 		LoadUsingStruct->InitializeStruct(RowData);
@@ -198,6 +222,28 @@ void UDataTable::HandleDataTableChanged(FName ChangedRowName)
 		return;
 	}
 
+	if (bPackRows)
+	{
+		PackRows();
+	}
+	else if (RowIndexSlots.Num() > 0)
+	{
+		ResetRowIndex();
+	}
+
+#if WITH_EDITOR
+	// The editor changes row values in place, which the secondary indices can't track
+	if (GIsEditor && SecondaryIndices.Num() > 0)
+	{
+		ResetSecondaryIndices();
+	}
+#endif
+
+	if (!bSecondaryIndicesValid)
+	{
+		BuildSecondaryIndices();
+	}
+
 	// Do the row fixup before global callback
 	if (RowStruct)
 	{
@@ -285,6 +331,12 @@ void UDataTable::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
 	Super::GetResourceSizeEx(CumulativeResourceSize);
 
 	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(RowMap.GetAllocatedSize());
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(IndexedRowNames.GetAllocatedSize() + IndexedRowData.GetAllocatedSize() + RowIndexSlots.GetAllocatedSize());
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(SecondaryIndices.GetAllocatedSize());
+	for (const FDataTableSecondaryIndex& SecondaryIndex : SecondaryIndices)
+	{
+		CumulativeResourceSize.AddDedicatedSystemMemoryBytes(SecondaryIndex.Entries.GetAllocatedSize());
+	}
 	if (RowStruct)
 	{
 		CumulativeResourceSize.AddDedicatedSystemMemoryBytes(RowMap.Num() * RowStruct->GetStructureSize());
@@ -368,13 +420,18 @@ void UDataTable::EmptyTable()
 	// Iterate over all rows in table and free mem
 	for (auto RowIt = RowMap.CreateIterator(); RowIt; ++RowIt)
 	{
-		uint8* RowData = RowIt.Value();
-		EmptyUsingStruct.DestroyStruct(RowData);
-		FMemory::Free(RowData);
+		FreeRowData(EmptyUsingStruct, RowIt.Value());
 	}
 
 	// Finally empty the map
 	RowMap.Empty();
+
+	ResetRowIndex();
+	ResetSecondaryIndices();
+	FMemory::Free(PackedRows);
+	PackedRows = nullptr;
+	PackedRowsSize = 0;
+	PackedRowsUsedSize = 0;
 }
 
 void UDataTable::RemoveRow(FName RowName)
@@ -388,8 +445,15 @@ void UDataTable::RemoveRow(FName RowName)
 		
 	if (RowData)
 	{
-		EmptyUsingStruct.DestroyStruct(RowData);
-		FMemory::Free(RowData);
+		ResetRowIndex();
+		if (bSecondaryIndicesValid)
+		{
+			for (FDataTableSecondaryIndex& SecondaryIndex : SecondaryIndices)
+			{
+				SecondaryIndex.RemoveRow(RowData);
+			}
+		}
+		FreeRowData(EmptyUsingStruct, RowData);
 	}
 }
 
@@ -408,13 +472,342 @@ void UDataTable::AddRow(FName RowName, const FTableRowBase& RowData)
 
 	// Add to map
 	AddRowInternal(RowName, NewRawRowData);
+
+	// A packed table without room for the row moves every row when the change ends, and rebuilds its indices then
+	if (bPackRows && PackedRowsUsedSize + GetPackedRowStride(EmptyUsingStruct) > PackedRowsSize)
+	{
+		ResetSecondaryIndices();
+	}
+
+	if (bSecondaryIndicesValid)
+	{
+		for (FDataTableSecondaryIndex& SecondaryIndex : SecondaryIndices)
+		{
+			SecondaryIndex.AddRow(RowName, NewRawRowData);
+		}
+	}
 }
 
 void UDataTable::AddRowInternal(FName RowName, uint8* RowData)
 {
+	ResetRowIndex();
 	RowMap.Add(RowName, RowData);
 }
 
+void UDataTable::FindRowsUnchecked(TArrayView<const FName> RowNames, TArrayView<uint8*> OutRowData) const
+{
+	check(RowNames.Num() == OutRowData.Num());
+
+	if (RowStruct == nullptr)
+	{
+		for (uint8*& RowData : OutRowData)
+		{
+			RowData = nullptr;
+		}
+		return;
+	}
+
+	if (RowIndexSlots.Num() == 0)
+	{
+		for (int32 NameIndex = 0; NameIndex < RowNames.Num(); ++NameIndex)
+		{
+			OutRowData[NameIndex] = FindRowData(RowNames[NameIndex]);
+		}
+		return;
+	}
+
+	// Prefetch the slots of the lookups a few names ahead so that their cache misses overlap
+	const int32 PrefetchDistance = 8;
+	for (int32 NameIndex = 0; NameIndex < RowNames.Num(); ++NameIndex)
+	{
+		if (NameIndex + PrefetchDistance < RowNames.Num())
+		{
+			FPlatformMisc::Prefetch(RowIndexSlots.GetData() + HashRowName(RowNames[NameIndex + PrefetchDistance]));
+		}
+
+		const int32 RowIndex = FindRowIndex(RowNames[NameIndex]);
+		OutRowData[NameIndex] = RowIndex != INDEX_NONE ? IndexedRowData[RowIndex] : nullptr;
+	}
+}
+
+void UDataTable::PackRows()
+{
+	UScriptStruct& EmptyUsingStruct = GetEmptyUsingStruct();
+	const int32 PackedRowStride = GetPackedRowStride(EmptyUsingStruct);
+
+	// Rows added since the table was loaded or last packed live in their own allocation
+	int32 NumUnpackedRows = 0;
+	for (const TPair<FName, uint8*>& TableRowPair : RowMap)
+	{
+		if (!IsPackedRowData(TableRowPair.Value))
+		{
+			++NumUnpackedRows;
+		}
+	}
+
+	if (NumUnpackedRows > 0 && PackedRowsUsedSize + (SIZE_T)NumUnpackedRows * PackedRowStride <= PackedRowsSize)
+	{
+		// They fit after the packed rows, which stay where they are
+		for (TPair<FName, uint8*>& TableRowPair : RowMap)
+		{
+			if (!IsPackedRowData(TableRowPair.Value))
+			{
+				uint8* NewRowData = PackedRows + PackedRowsUsedSize;
+				EmptyUsingStruct.InitializeStruct(NewRowData);
+				EmptyUsingStruct.CopyScriptStruct(NewRowData, TableRowPair.Value);
+
+				if (bSecondaryIndicesValid)
+				{
+					for (FDataTableSecondaryIndex& SecondaryIndex : SecondaryIndices)
+					{
+						SecondaryIndex.ReplaceRowData(TableRowPair.Value, NewRowData);
+					}
+				}
+
+				FreeRowData(EmptyUsingStruct, TableRowPair.Value);
+				TableRowPair.Value = NewRowData;
+				PackedRowsUsedSize += PackedRowStride;
+			}
+		}
+	}
+	else if (NumUnpackedRows > 0)
+	{
+		// Copy every row to a new allocation, leaving room for half as many rows again so that a table built row by row is only copied a logarithmic number of times
+		const SIZE_T NewPackedRowsSize = (SIZE_T)(RowMap.Num() + RowMap.Num() / 2) * PackedRowStride;
+		uint8* NewPackedRows = (uint8*)FMemory::Malloc(NewPackedRowsSize, EmptyUsingStruct.GetMinAlignment());
+
+		uint8* NewRowData = NewPackedRows;
+		for (TPair<FName, uint8*>& TableRowPair : RowMap)
+		{
+			EmptyUsingStruct.InitializeStruct(NewRowData);
+			EmptyUsingStruct.CopyScriptStruct(NewRowData, TableRowPair.Value);
+			FreeRowData(EmptyUsingStruct, TableRowPair.Value);
+
+			TableRowPair.Value = NewRowData;
+			NewRowData += PackedRowStride;
+		}
+
+		FMemory::Free(PackedRows);
+		PackedRows = NewPackedRows;
+		PackedRowsSize = NewPackedRowsSize;
+		PackedRowsUsedSize = (SIZE_T)RowMap.Num() * PackedRowStride;
+
+		// The secondary indices point to the rows that were moved
+		ResetSecondaryIndices();
+	}
+
+	BuildRowIndex();
+}
+
+void UDataTable::UnpackRows()
+{
+	ResetRowIndex();
+	ResetSecondaryIndices();
+
+	if (PackedRows == nullptr)
+	{
+		return;
+	}
+
+	UScriptStruct& EmptyUsingStruct = GetEmptyUsingStruct();
+	for (TPair<FName, uint8*>& TableRowPair : RowMap)
+	{
+		if (IsPackedRowData(TableRowPair.Value))
+		{
+			uint8* RowData = (uint8*)FMemory::Malloc(EmptyUsingStruct.GetStructureSize());
+			EmptyUsingStruct.InitializeStruct(RowData);
+			EmptyUsingStruct.CopyScriptStruct(RowData, TableRowPair.Value);
+			EmptyUsingStruct.DestroyStruct(TableRowPair.Value);
+
+			TableRowPair.Value = RowData;
+		}
+	}
+
+	FMemory::Free(PackedRows);
+	PackedRows = nullptr;
+	PackedRowsSize = 0;
+	PackedRowsUsedSize = 0;
+}
+
+void UDataTable::BuildRowIndex()
+{
+	IndexedRowNames.Reset(RowMap.Num());
+	IndexedRowData.Reset(RowMap.Num());
+	for (const TPair<FName, uint8*>& TableRowPair : RowMap)
+	{
+		IndexedRowNames.Add(TableRowPair.Key);
+		IndexedRowData.Add(TableRowPair.Value);
+	}
+
+	// Keep at most half the slots used so that probe sequences stay short
+	const uint32 NumSlots = FMath::RoundUpToPowerOfTwo(FMath::Max(RowMap.Num() * 2, 2));
+	RowIndexHashShift = 32 - FMath::FloorLog2(NumSlots);
+	RowIndexSlots.Init(INDEX_NONE, NumSlots);
+
+	const uint32 SlotMask = NumSlots - 1;
+	for (int32 RowIndex = 0; RowIndex < IndexedRowNames.Num(); ++RowIndex)
+	{
+		uint32 Slot = HashRowName(IndexedRowNames[RowIndex]);
+		while (RowIndexSlots[Slot] != INDEX_NONE)
+		{
+			Slot = (Slot + 1) & SlotMask;
+		}
+		RowIndexSlots[Slot] = RowIndex;
+	}
+
+	++RowIndexSerial;
+}
+
+void UDataTable::ResetRowIndex()
+{
+	IndexedRowNames.Empty();
+	IndexedRowData.Empty();
+	RowIndexSlots.Empty();
+	++RowIndexSerial;
+}
+
+void UDataTable::FreeRowData(UScriptStruct& UsingStruct, uint8* RowData)
+{
+	UsingStruct.DestroyStruct(RowData);
+	if (!IsPackedRowData(RowData))
+	{
+		FMemory::Free(RowData);
+	}
+}
+
+int32 UDataTable::GetPackedRowStride(const UScriptStruct& UsingStruct)
+{
+	return Align(UsingStruct.GetStructureSize(), UsingStruct.GetMinAlignment());
+}
+
+const FDataTableSecondaryIndex* UDataTable::FindSecondaryIndex(FName PropertyName) const
+{
+	return SecondaryIndices.FindByPredicate([PropertyName](const FDataTableSecondaryIndex& SecondaryIndex) { return SecondaryIndex.PropertyName == PropertyName; });
+}
+
+void UDataTable::GetSecondaryIndexPropertyNames(TArray<FName>& OutPropertyNames) const
+{
+	for (const FName& PropertyName : IndexedProperties)
+	{
+		OutPropertyNames.AddUnique(PropertyName);
+	}
+}
+
+void UDataTable::BuildSecondaryIndices()
+{
+	SecondaryIndices.Reset();
+	bSecondaryIndicesValid = true;
+
+	if (RowStruct == nullptr)
+	{
+		return;
+	}
+
+	TArray<FName> PropertyNames;
+	GetSecondaryIndexPropertyNames(PropertyNames);
+
+	for (const FName& PropertyName : PropertyNames)
+	{
+		const FProperty* Property = FindTableProperty(PropertyName);
+		if (!FDataTableSecondaryIndex::CanIndexProperty(Property))
+		{
+			UE_LOG(LogDataTable, Warning, TEXT("Column '%s' of DataTable '%s' can't be indexed, only numeric, enum, bool and name columns can."), *PropertyName.ToString(), *GetPathName());
+			continue;
+		}
+
+		FDataTableSecondaryIndex& SecondaryIndex = SecondaryIndices.AddDefaulted_GetRef();
+		SecondaryIndex.PropertyName = PropertyName;
+		SecondaryIndex.Property = Property;
+		SecondaryIndex.Entries.Reserve(RowMap.Num());
+		for (const TPair<FName, uint8*>& TableRowPair : RowMap)
+		{
+			SecondaryIndex.Entries.Add({ SecondaryIndex.GetKey(TableRowPair.Value), TableRowPair.Key, TableRowPair.Value });
+		}
+		SecondaryIndex.Entries.Sort([](const FDataTableSecondaryIndex::FEntry& A, const FDataTableSecondaryIndex::FEntry& B) { return A.Key < B.Key; });
+	}
+}
+
+void UDataTable::ResetSecondaryIndices()
+{
+	SecondaryIndices.Empty();
+	bSecondaryIndicesValid = false;
+}
+
+TArrayView<const FDataTableSecondaryIndex::FEntry> FDataTableSecondaryIndex::GetEntriesInRange(const FDataTableIndexKey& Min, const FDataTableIndexKey& Max) const
+{
+	const int32 First = Algo::LowerBoundBy(Entries, Min, &FEntry::Key);
+	const int32 Last = Algo::UpperBoundBy(Entries, Max, &FEntry::Key);
+	return First < Last ? TArrayView<const FEntry>(Entries.GetData() + First, Last - First) : TArrayView<const FEntry>();
+}
+
+FDataTableIndexKey FDataTableSecondaryIndex::GetKey(const uint8* RowData) const
+{
+	const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(RowData);
+
+	if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		return FDataTableIndexKey((double)EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr));
+	}
+	if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	{
+		return FDataTableIndexKey(NumericProperty->IsFloatingPoint() ? NumericProperty->GetFloatingPointPropertyValue(ValuePtr) : (double)NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+	}
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		return FDataTableIndexKey(BoolProperty->GetPropertyValue(ValuePtr) ? 1.0 : 0.0);
+	}
+	if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	{
+		return FDataTableIndexKey(NameProperty->GetPropertyValue(ValuePtr));
+	}
+
+	return FDataTableIndexKey();
+}
+
+void FDataTableSecondaryIndex::AddRow(FName RowName, uint8* RowData)
+{
+	FEntry Entry = { GetKey(RowData), RowName, RowData };
+	const int32 EntryIndex = Algo::UpperBoundBy(Entries, Entry.Key, &FEntry::Key);
+	Entries.Insert(MoveTemp(Entry), EntryIndex);
+}
+
+int32 FDataTableSecondaryIndex::FindEntryIndex(const uint8* RowData, const FDataTableIndexKey& Key) const
+{
+	for (int32 EntryIndex = Algo::LowerBoundBy(Entries, Key, &FEntry::Key); EntryIndex < Entries.Num() && !(Key < Entries[EntryIndex].Key); ++EntryIndex)
+	{
+		if (Entries[EntryIndex].RowData == RowData)
+		{
+			return EntryIndex;
+		}
+	}
+
+	// The row was changed in place since it was indexed, so it's no longer sorted under its current key
+	return Entries.IndexOfByPredicate([RowData](const FEntry& Entry) { return Entry.RowData == RowData; });
+}
+
+void FDataTableSecondaryIndex::RemoveRow(uint8* RowData)
+{
+	const int32 EntryIndex = FindEntryIndex(RowData, GetKey(RowData));
+	if (EntryIndex != INDEX_NONE)
+	{
+		Entries.RemoveAt(EntryIndex);
+	}
+}
+
+void FDataTableSecondaryIndex::ReplaceRowData(const uint8* OldRowData, uint8* NewRowData)
+{
+	const int32 EntryIndex = FindEntryIndex(OldRowData, GetKey(NewRowData));
+	if (EntryIndex != INDEX_NONE)
+	{
+		Entries[EntryIndex].RowData = NewRowData;
+	}
+}
+
+bool FDataTableSecondaryIndex::CanIndexProperty(const FProperty* Property)
+{
+	return Property && (Property->IsA<FEnumProperty>() || Property->IsA<FNumericProperty>() || Property->IsA<FBoolProperty>() || Property->IsA<FNameProperty>());
+}
+
 /** Returns the column property where PropertyName matches the name of the column property. Returns NULL if no match is found or the match is not a supported table property */
 FProperty* UDataTable::FindTableProperty(const FName& PropertyName) const
 {
@@ -779,6 +1172,8 @@ TArray<FString> UDataTable::CreateTableFromOtherTable(const UDataTable* InTable)
 	TMap<FName, uint8*> InRowMapCopy = InTable->GetRowMap();
 
 	UScriptStruct& EmptyUsingStruct = GetEmptyUsingStruct();
+	ResetRowIndex();
+	ResetSecondaryIndices();
 	for (TMap<FName, uint8*>::TConstIterator RowMapIter(InRowMapCopy.CreateConstIterator()); RowMapIter; ++RowMapIter)
 	{
 		uint8* NewRawRowData = (uint8*)FMemory::Malloc(EmptyUsingStruct.GetStructureSize());
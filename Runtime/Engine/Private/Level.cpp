@@ -51,6 +51,7 @@ Level.cpp: Level-related functions
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Algo/AnyOf.h"
+#include "Interfaces/ITargetPlatform.h"
 #endif
 #include "Engine/LevelStreaming.h"
 #include "LevelUtils.h"
@@ -73,6 +74,14 @@ static FAutoConsoleVariableRef CVarActorClusteringEnabled(
 	ECVF_Default
 );
 
+int32 GLevelPreInitializedActorsEnabled = 1;
+static FAutoConsoleVariableRef CVarLevelPreInitializedActorsEnabled(
+	TEXT("s.LevelPreInitializedActors"),
+	GLevelPreInitializedActorsEnabled,
+	TEXT("Whether RouteActorInitialize skips initialization routing for actors a cooked streamed level recorded as pre-initialized."),
+	ECVF_Default
+);
+
 #if WITH_EDITOR
 FLevelPartitionOperationScope::FLevelPartitionOperationScope(ULevel* InLevel)
 {
@@ -665,6 +674,19 @@ void ULevel::PreSave(const class ITargetPlatform* TargetPlatform)
 				Actor->ClearCrossLevelReferences();
 			}
 		}
+
+		// Record actors whose initialization routing is a no-op, only in cooked packages since editor worlds rerun construction scripts on load
+		PreInitializedActors.Reset();
+		if (TargetPlatform && TargetPlatform->RequiresCookedData())
+		{
+			for (AActor* Actor : Actors)
+			{
+				if (Actor && !Actor->IsPendingKill() && Actor->CanSkipInitializationWhenStreamed())
+				{
+					PreInitializedActors.Add(Actor);
+				}
+			}
+		}
 	}
 #endif // WITH_EDITOR
 }
@@ -1984,6 +2006,22 @@ void ULevel::RouteActorInitialize()
 {
 	TRACE_OBJECT_EVENT(this, RouteActorInitialize);
 
+	// Flag actors of streamed levels recorded as pre-initialized at cook time so the routing below skips them; they still begin play in level order.
+	// The persistent level is initialized with the world where gameplay code may rely on the full routing, so it always routes it.
+	TSet<AActor*> ActorsPreInitialized;
+	if (GLevelPreInitializedActorsEnabled && PreInitializedActors.Num() > 0 && !IsPersistentLevel())
+	{
+		ActorsPreInitialized.Reserve(PreInitializedActors.Num());
+		for (AActor* Actor : PreInitializedActors)
+		{
+			if (Actor && !Actor->IsActorInitialized() && !Actor->IsPendingKill() && Actor->GetLevel() == this)
+			{
+				FSetActorPreInitialized SetActorPreInitialized(Actor);
+				ActorsPreInitialized.Add(Actor);
+			}
+		}
+	}
+
 	// Send PreInitializeComponents and collect volumes.
 	for( int32 Index = 0; Index < Actors.Num(); ++Index )
 	{
@@ -2019,6 +2057,10 @@ void ULevel::RouteActorInitialize()
 					ActorsToBeginPlay.Add(Actor);
 				}
 			}
+			else if (bCallBeginPlay && ActorsPreInitialized.Contains(Actor))
+			{
+				ActorsToBeginPlay.Add(Actor);
+			}
 		}
 	}
 
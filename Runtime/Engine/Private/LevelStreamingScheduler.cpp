@@ -0,0 +1,228 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LevelStreamingScheduler.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/LevelBounds.h"
+#include "Engine/WorldComposition.h"
+#include "Engine/CoreSettings.h"
+#include "ContentStreaming.h"
+#include "Algo/StableSort.h"
+
+#if !UE_BUILD_SHIPPING
+
+static int32 GLevelStreamingTimelineSize = 256;
+static FAutoConsoleVariableRef CVarLevelStreamingTimelineSize(
+	TEXT("s.LevelStreamingTimelineSize"),
+	GLevelStreamingTimelineSize,
+	TEXT("Number of level streaming decisions kept for s.DumpLevelStreamingTimeline. Set to zero to disable the timeline."),
+	ECVF_Default
+);
+
+static float GLevelStreamingTimelineMinTimeMs = 1.0f;
+static FAutoConsoleVariableRef CVarLevelStreamingTimelineMinTimeMs(
+	TEXT("s.LevelStreamingTimelineMinTimeMs"),
+	GLevelStreamingTimelineMinTimeMs,
+	TEXT("Streaming level updates that don't change state are only recorded in the timeline if they took at least this long (ms)."),
+	ECVF_Default
+);
+
+namespace LevelStreamingTimeline
+{
+	struct FEntry
+	{
+		uint64 Frame;
+		double Time;
+		FName PackageName;
+		ULevelStreaming::ECurrentState PreviousState;
+		ULevelStreaming::ECurrentState NewState;
+		float ViewDistance;
+		float TimeSpentMs;
+	};
+
+	/** Ring buffer of the most recent decisions, NextEntry is where the next one is written */
+	static TArray<FEntry> Entries;
+	static int32 NextEntry = 0;
+	static int32 Capacity = 0;
+
+	static void Add(const FEntry& Entry)
+	{
+		if (Capacity != GLevelStreamingTimelineSize)
+		{
+			Entries.Reset();
+			NextEntry = 0;
+			Capacity = GLevelStreamingTimelineSize;
+		}
+
+		if (GLevelStreamingTimelineSize <= 0)
+		{
+			return;
+		}
+
+		if (Entries.Num() < GLevelStreamingTimelineSize)
+		{
+			Entries.Add(Entry);
+		}
+		else
+		{
+			Entries[NextEntry] = Entry;
+		}
+		NextEntry = (NextEntry + 1) % GLevelStreamingTimelineSize;
+	}
+
+	static void Dump()
+	{
+		UE_LOG(LogStreaming, Display, TEXT("Level streaming timeline (%d entries, oldest first):"), Entries.Num());
+		const int32 FirstEntry = Entries.Num() < GLevelStreamingTimelineSize ? 0 : NextEntry;
+		for (int32 Offset = 0; Offset < Entries.Num(); ++Offset)
+		{
+			const FEntry& Entry = Entries[(FirstEntry + Offset) % Entries.Num()];
+			UE_LOG(LogStreaming, Display, TEXT("  Frame %llu (%.3fs) %s: %s -> %s, view distance %.0f, %.2f ms"),
+				Entry.Frame,
+				Entry.Time,
+				*Entry.PackageName.ToString(),
+				ULevelStreaming::EnumToString(Entry.PreviousState),
+				ULevelStreaming::EnumToString(Entry.NewState),
+				Entry.ViewDistance,
+				Entry.TimeSpentMs);
+		}
+	}
+}
+
+static FAutoConsoleCommand CmdDumpLevelStreamingTimeline(
+	TEXT("s.DumpLevelStreamingTimeline"),
+	TEXT("Logs the most recent level streaming decisions: state changes and slow updates of each streaming level, with their view distance and game thread time."),
+	FConsoleCommandDelegate::CreateStatic(&LevelStreamingTimeline::Dump)
+);
+
+#endif // !UE_BUILD_SHIPPING
+
+void FLevelStreamingScheduler::GetUpdateOrder(UWorld* World, const TArray<ULevelStreaming*>& StreamingLevels, TArray<int32>& OutOrder, TArray<float>& OutViewDistances)
+{
+	// StreamingLevels is sorted by ascending priority, so walking it backwards updates the highest priority levels first
+	OutOrder.Reset(StreamingLevels.Num());
+	for (int32 Index = StreamingLevels.Num() - 1; Index >= 0; --Index)
+	{
+		OutOrder.Add(Index);
+	}
+
+	OutViewDistances.Reset(StreamingLevels.Num());
+	OutViewDistances.AddUninitialized(StreamingLevels.Num());
+
+	if (!GLevelStreamingOrderByViewDistance || StreamingLevels.Num() < 2 || IStreamingManager::Get().GetNumViews() == 0)
+	{
+		for (float& ViewDistance : OutViewDistances)
+		{
+			ViewDistance = -1.0f;
+		}
+		return;
+	}
+
+	struct FSortKey
+	{
+		int32 Index;
+		int32 Priority;
+		bool bStreamingOut;
+		float ViewDistance;
+	};
+
+	TArray<FSortKey, TInlineAllocator<64>> SortKeys;
+	SortKeys.Reserve(OutOrder.Num());
+	for (const int32 Index : OutOrder)
+	{
+		ULevelStreaming* StreamingLevel = StreamingLevels[Index];
+		if (StreamingLevel)
+		{
+			SortKeys.Add({ Index, StreamingLevel->GetPriority(), FStreamingLevelPrivateAccessor::IsStreamingOut(StreamingLevel), GetViewDistance(World, StreamingLevel) });
+		}
+		else
+		{
+			SortKeys.Add({ Index, MIN_int32, false, -1.0f });
+		}
+	}
+
+	// Stable so that levels with the same key keep the previous order. Levels without bounds sort as if they were on top of the
+	// views, so they keep going first among the levels streaming in and last among the levels streaming out.
+	Algo::StableSort(SortKeys, [](const FSortKey& A, const FSortKey& B)
+	{
+		if (A.Priority != B.Priority)
+		{
+			return A.Priority > B.Priority;
+		}
+		if (A.bStreamingOut != B.bStreamingOut)
+		{
+			return !A.bStreamingOut;
+		}
+
+		const float DistanceA = FMath::Max(A.ViewDistance, 0.0f);
+		const float DistanceB = FMath::Max(B.ViewDistance, 0.0f);
+		return A.bStreamingOut ? DistanceA > DistanceB : DistanceA < DistanceB;
+	});
+
+	for (int32 Position = 0; Position < SortKeys.Num(); ++Position)
+	{
+		OutOrder[Position] = SortKeys[Position].Index;
+		OutViewDistances[Position] = SortKeys[Position].ViewDistance;
+	}
+}
+
+float FLevelStreamingScheduler::GetViewDistance(UWorld* World, ULevelStreaming* StreamingLevel)
+{
+	FBox Bounds(ForceInit);
+	if (ULevel* LoadedLevel = StreamingLevel->GetLoadedLevel())
+	{
+		if (World->WorldComposition)
+		{
+			Bounds = World->WorldComposition->GetLevelBounds(LoadedLevel);
+		}
+		else if (ALevelBounds* LevelBoundsActor = LoadedLevel->LevelBoundsActor.Get())
+		{
+			Bounds = LevelBoundsActor->GetComponentsBoundingBox(true);
+			if (!LoadedLevel->bAlreadyMovedActors)
+			{
+				// The level transform is only applied to the actors once the level starts being made visible
+				Bounds = Bounds.TransformBy(StreamingLevel->LevelTransform);
+			}
+		}
+	}
+
+	if (!Bounds.IsValid && World->WorldComposition)
+	{
+		Bounds = World->WorldComposition->GetTileBounds(StreamingLevel->GetWorldAssetPackageFName());
+	}
+
+	if (!Bounds.IsValid)
+	{
+		Bounds = StreamingLevel->GetStreamingVolumeBounds();
+	}
+
+	if (!Bounds.IsValid)
+	{
+		return -1.0f;
+	}
+
+	const IStreamingManager& StreamingManager = IStreamingManager::Get();
+	float MinDistanceSquared = MAX_flt;
+	for (int32 ViewIndex = 0; ViewIndex < StreamingManager.GetNumViews(); ++ViewIndex)
+	{
+		const FStreamingViewInfo& ViewInfo = StreamingManager.GetViewInformation(ViewIndex);
+
+		// Boost factors below one (e.g. predicted views) make a view count as farther away
+		const float BoostFactor = FMath::Max(ViewInfo.BoostFactor, KINDA_SMALL_NUMBER);
+		MinDistanceSquared = FMath::Min(MinDistanceSquared, Bounds.ComputeSquaredDistanceToPoint(ViewInfo.ViewOrigin) / FMath::Square(BoostFactor));
+	}
+
+	return FMath::Sqrt(MinDistanceSquared);
+}
+
+void FLevelStreamingScheduler::RecordUpdate(const ULevelStreaming* StreamingLevel, ULevelStreaming::ECurrentState PreviousState, float ViewDistance, double TimeSpent)
+{
+#if !UE_BUILD_SHIPPING
+	const float TimeSpentMs = (float)(TimeSpent * 1000.0);
+	if (GLevelStreamingTimelineSize > 0 && (StreamingLevel->GetCurrentState() != PreviousState || TimeSpentMs >= GLevelStreamingTimelineMinTimeMs))
+	{
+		LevelStreamingTimeline::Add({ GFrameCounter, FPlatformTime::Seconds(), StreamingLevel->GetWorldAssetPackageFName(), PreviousState, StreamingLevel->GetCurrentState(), ViewDistance, TimeSpentMs });
+	}
+#endif
+}
@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/LevelStreaming.h"
+
+class UWorld;
+
+/**
+ * World level scheduling of streaming level updates.
+ * UWorld::UpdateLevelStreaming asks it in which order to update the streaming levels being considered, so that with
+ * a limited number of concurrent load requests and a single level made visible at a time the most needed levels go first.
+ * It also keeps a timeline of the streaming decisions for debugging hitches (see s.DumpLevelStreamingTimeline).
+ */
+struct FLevelStreamingScheduler
+{
+	/**
+	 * Fills OutOrder with indices into StreamingLevels in the order they should be updated this frame.
+	 * Levels are ordered by priority first. With s.LevelStreamingOrderByViewDistance, levels of equal priority streaming in are then
+	 * ordered nearest first and levels streaming out farthest first, using the streaming views including the predicted ones.
+	 * OutViewDistances receives the distance of the level at each position of OutOrder, negative if unknown.
+	 */
+	static void GetUpdateOrder(UWorld* World, const TArray<ULevelStreaming*>& StreamingLevels, TArray<int32>& OutOrder, TArray<float>& OutViewDistances);
+
+	/** Records the update of a streaming level in the decision timeline if it changed state or took long enough to matter. */
+	static void RecordUpdate(const ULevelStreaming* StreamingLevel, ULevelStreaming::ECurrentState PreviousState, float ViewDistance, double TimeSpent);
+
+private:
+	/** Returns the distance from the streaming level to the closest streaming view scaled by the view boost, negative if the level has no known bounds. */
+	static float GetViewDistance(UWorld* World, ULevelStreaming* StreamingLevel);
+};
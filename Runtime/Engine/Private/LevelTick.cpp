@@ -34,6 +34,7 @@
 #include "UnrealEngine.h"
 #include "Engine/LevelStreamingVolume.h"
 #include "Engine/WorldComposition.h"
+#include "Components/SceneComponent.h"
 #include "Collision.h"
 #include "PhysicsPublic.h"
 #include "Tickable.h"
@@ -780,6 +781,9 @@ void UWorld::RunTickGroup(ETickingGroup Group, bool bBlockTillComplete = true)
 	check(TickGroup == Group); // this should already be at the correct value, but we want to make sure things are happening in the right order
 	FTickTaskManagerInterface::Get().RunTickGroup(Group, bBlockTillComplete);
 	TickGroup = ETickingGroup(TickGroup + 1); // new actors go into the next tick group because this one is already gone
+
+	// Resolve attachment hierarchies whose updates were deferred while this group ticked, so the next group sees up to date transforms.
+	USceneComponent::FlushDeferredChildTransformUpdates();
 }
 
 static TAutoConsoleVariable<int32> CVarAllowAsyncRenderThreadUpdates(
@@ -1013,6 +1017,9 @@ void UWorld::SendAllEndOfFrameUpdates()
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(EndOfFrameUpdates);
 	CSV_SCOPED_SET_WAIT_STAT(EndOfFrameUpdates);
 
+	// Child transform updates deferred outside of tick groups mark render state dirty, so resolve them before sending.
+	USceneComponent::FlushDeferredChildTransformUpdates();
+
 	if (!HasEndOfFrameUpdates())
 	{
 		return;
@@ -351,6 +351,13 @@ public:
 		// If we are the default material, must not try to fall back to the default material in an error state as that will be infinite recursion
 		check(!Material->IsDefaultMaterial());
 
+#if WITH_EDITOR
+		if (MaterialResource && GShaderCompilingManager)
+		{
+			GShaderCompilingManager->NotifyMaterialNeededForRendering(MaterialResource);
+		}
+#endif
+
 		OutFallbackMaterialRenderProxy = &GetFallbackRenderProxy();
 		return OutFallbackMaterialRenderProxy->GetMaterialWithFallback(InFeatureLevel, OutFallbackMaterialRenderProxy);
 	}
@@ -40,12 +40,16 @@
 #include "Misc/ScopedSlowTask.h"
 #include "Materials/MaterialStaticParameterValueResolver.h"
 #include "ShaderPlatformQualitySettings.h"
+#include "ShaderCompiler.h"
 #include "MaterialShaderQualitySettings.h"
 
 DECLARE_CYCLE_STAT(TEXT("MaterialInstance CopyMatInstParams"), STAT_MaterialInstance_CopyMatInstParams, STATGROUP_Shaders);
 DECLARE_CYCLE_STAT(TEXT("MaterialInstance Serialize"), STAT_MaterialInstance_Serialize, STATGROUP_Shaders);
 DECLARE_CYCLE_STAT(TEXT("MaterialInstance CopyUniformParamsInternal"), STAT_MaterialInstance_CopyUniformParamsInternal, STATGROUP_Shaders);
 
+DEFINE_STAT(STAT_MaterialInstanceParameterUpdates);
+DEFINE_STAT(STAT_MaterialInstanceRenderThreadUpdates);
+
 /**
  * Cache uniform expressions for the given material.
  * @param MaterialInstance - The material instance for which to cache uniform expressions.
@@ -130,6 +134,12 @@ const FMaterial& FMaterialInstanceResource::GetMaterialWithFallback(ERHIFeatureL
 				}
 				else
 				{
+#if WITH_EDITOR
+					if (GShaderCompilingManager)
+					{
+						GShaderCompilingManager->NotifyMaterialNeededForRendering(StaticPermutationResource);
+					}
+#endif
 					EMaterialDomain Domain = (EMaterialDomain)StaticPermutationResource->GetMaterialDomain();
 					UMaterial* FallbackMaterial = UMaterial::GetDefaultMaterial(Domain);
 					//there was an error, use the default material's resource
@@ -341,17 +351,42 @@ void FMaterialInstanceResource::InitMIParameters(FMaterialInstanceParameterSet&
 	Swap(RuntimeVirtualTextureParameterArray, ParameterSet.RuntimeVirtualTextureParameters);
 }
 
+void FMaterialInstanceResource::RenderThread_UpdateParameters(const FMaterialInstanceParameterSet& ParameterSet)
+{
+	LLM_SCOPE(ELLMTag::MaterialInstance);
+
+	InvalidateUniformExpressionCache(false);
+	for (const TNamedParameter<float>& Parameter : ParameterSet.ScalarParameters)
+	{
+		SetParameterValue(Parameter.Info, Parameter.Value);
+	}
+	for (const TNamedParameter<FLinearColor>& Parameter : ParameterSet.VectorParameters)
+	{
+		SetParameterValue(Parameter.Info, Parameter.Value);
+	}
+	for (const TNamedParameter<const UTexture*>& Parameter : ParameterSet.TextureParameters)
+	{
+		SetParameterValue(Parameter.Info, Parameter.Value);
+	}
+	for (const TNamedParameter<const URuntimeVirtualTexture*>& Parameter : ParameterSet.RuntimeVirtualTextureParameters)
+	{
+		SetParameterValue(Parameter.Info, Parameter.Value);
+	}
+}
+
 /**
 * Updates a parameter on the material instance from the game thread.
 */
 template <typename ParameterType>
 void GameThread_UpdateMIParameter(const UMaterialInstance* Instance, const ParameterType& Parameter)
 {
+	INC_DWORD_STAT(STAT_MaterialInstanceParameterUpdates);
 	if (FApp::CanEverRender())
 	{
 		FMaterialInstanceResource* Resource = Instance->Resource;
 		const FMaterialParameterInfo& ParameterInfo = Parameter.ParameterInfo;
 		typename ParameterType::ValueType Value = ParameterType::GetValue(Parameter);
+		INC_DWORD_STAT(STAT_MaterialInstanceRenderThreadUpdates);
 		ENQUEUE_RENDER_COMMAND(SetMIParameterValue)(
 			[Resource, ParameterInfo, Value](FRHICommandListImmediate& RHICmdList)
 			{
@@ -1694,6 +1729,7 @@ void UMaterialInstanceDynamic::CopyScalarAndVectorParameters(const UMaterialInte
 	{
 		// first, clear out all the parameter values
 		ClearParameterValuesInternal(false);
+		InvalidateParameterIndexMaps();
 
 		// scalar
 		{
@@ -19,6 +19,172 @@ UMaterialInstanceDynamic::UMaterialInstanceDynamic(const FObjectInitializer& Obj
 {
 }
 
+/**
+ * Finds the index of a parameter in a MID parameter value array through its index map.
+ * The arrays are also changed without going through the MID (loading, clearing or copying parameters), in which case the map is rebuilt.
+ */
+template <typename ParameterType>
+static int32 GameThread_FindParameterIndexHashed(const TArray<ParameterType>& Parameters, FMaterialInstanceParameterIndexMap& IndexMap, const FHashedMaterialParameterInfo& ParameterInfo)
+{
+	auto RebuildIndexMap = [&Parameters, &IndexMap]()
+	{
+		IndexMap.Indices.Reset();
+		for (int32 ParameterIndex = 0; ParameterIndex < Parameters.Num(); ++ParameterIndex)
+		{
+			// Keep the first of duplicated parameters, as the linear search does
+			const FHashedMaterialParameterInfo Info(Parameters[ParameterIndex].ParameterInfo);
+			if (!IndexMap.Indices.Contains(Info))
+			{
+				IndexMap.Indices.Add(Info, ParameterIndex);
+			}
+		}
+		IndexMap.NumParameters = Parameters.Num();
+	};
+
+	if (IndexMap.NumParameters != Parameters.Num())
+	{
+		RebuildIndexMap();
+	}
+
+	const int32* Index = IndexMap.Indices.Find(ParameterInfo);
+	if (Index && Parameters.IsValidIndex(*Index) && Parameters[*Index].ParameterInfo == ParameterInfo)
+	{
+		return *Index;
+	}
+
+	// The array was replaced by one of the same size, check the parameter is really missing before reporting it as such
+	const int32 FoundIndex = GameThread_FindParameterIndexByName(Parameters, ParameterInfo);
+	if (Index || FoundIndex != INDEX_NONE)
+	{
+		RebuildIndexMap();
+	}
+	return FoundIndex;
+}
+
+/** Records a parameter that was just added at the end of a MID parameter value array in its index map. */
+template <typename ParameterType>
+static void GameThread_AddParameterIndex(const TArray<ParameterType>& Parameters, FMaterialInstanceParameterIndexMap& IndexMap)
+{
+	if (IndexMap.NumParameters == Parameters.Num() - 1)
+	{
+		IndexMap.Indices.Add(FHashedMaterialParameterInfo(Parameters.Last().ParameterInfo), Parameters.Num() - 1);
+		IndexMap.NumParameters = Parameters.Num();
+	}
+}
+
+void UMaterialInstanceDynamic::SetScalarParameterValueHashed(const FMaterialParameterInfo& ParameterInfo, float Value)
+{
+	const int32 ParameterIndex = GameThread_FindParameterIndexHashed(ScalarParameterValues, ScalarParameterIndexMap, ParameterInfo);
+	if (ParameterIndex != INDEX_NONE)
+	{
+		SetScalarParameterByIndexInternal(ParameterIndex, Value);
+	}
+	else
+	{
+		SetScalarParameterValueInternal(ParameterInfo, Value);
+		GameThread_AddParameterIndex(ScalarParameterValues, ScalarParameterIndexMap);
+	}
+}
+
+void UMaterialInstanceDynamic::SetVectorParameterValueHashed(const FMaterialParameterInfo& ParameterInfo, const FLinearColor& Value)
+{
+	const int32 ParameterIndex = GameThread_FindParameterIndexHashed(VectorParameterValues, VectorParameterIndexMap, ParameterInfo);
+	if (ParameterIndex != INDEX_NONE)
+	{
+		SetVectorParameterByIndexInternal(ParameterIndex, Value);
+	}
+	else
+	{
+		SetVectorParameterValueInternal(ParameterInfo, Value);
+		GameThread_AddParameterIndex(VectorParameterValues, VectorParameterIndexMap);
+	}
+}
+
+void UMaterialInstanceDynamic::SetParameterValues(TArrayView<const FMaterialParameterInfo> ScalarParameterInfos, TArrayView<const float> ScalarValues, TArrayView<const FMaterialParameterInfo> VectorParameterInfos, TArrayView<const FLinearColor> VectorValues)
+{
+	LLM_SCOPE(ELLMTag::MaterialInstance);
+
+	check(ScalarParameterInfos.Num() == ScalarValues.Num());
+	check(VectorParameterInfos.Num() == VectorValues.Num());
+
+	// Only the parameters which changed are sent to the rendering thread
+	FMaterialInstanceParameterSet ChangedParameters;
+
+	for (int32 Index = 0; Index < ScalarParameterInfos.Num(); ++Index)
+	{
+		const FMaterialParameterInfo& ParameterInfo = ScalarParameterInfos[Index];
+		const float Value = ScalarValues[Index];
+
+		const int32 ParameterIndex = GameThread_FindParameterIndexHashed(ScalarParameterValues, ScalarParameterIndexMap, ParameterInfo);
+		FScalarParameterValue* ParameterValue = nullptr;
+		if (ParameterIndex == INDEX_NONE)
+		{
+			// If there's no element for the named parameter in array yet, add one.
+			ParameterValue = new(ScalarParameterValues) FScalarParameterValue;
+			ParameterValue->ParameterInfo = ParameterInfo;
+			ParameterValue->ExpressionGUID.Invalidate();
+			GameThread_AddParameterIndex(ScalarParameterValues, ScalarParameterIndexMap);
+		}
+		else if (ScalarParameterValues[ParameterIndex].ParameterValue != Value)
+		{
+			ParameterValue = &ScalarParameterValues[ParameterIndex];
+		}
+
+		if (ParameterValue)
+		{
+			ParameterValue->ParameterValue = Value;
+			FMaterialInstanceResource::TNamedParameter<float>& ChangedParameter = ChangedParameters.ScalarParameters.AddDefaulted_GetRef();
+			ChangedParameter.Info = ParameterInfo;
+			ChangedParameter.Value = Value;
+		}
+	}
+
+	for (int32 Index = 0; Index < VectorParameterInfos.Num(); ++Index)
+	{
+		const FMaterialParameterInfo& ParameterInfo = VectorParameterInfos[Index];
+		const FLinearColor& Value = VectorValues[Index];
+
+		const int32 ParameterIndex = GameThread_FindParameterIndexHashed(VectorParameterValues, VectorParameterIndexMap, ParameterInfo);
+		FVectorParameterValue* ParameterValue = nullptr;
+		if (ParameterIndex == INDEX_NONE)
+		{
+			// If there's no element for the named parameter in array yet, add one.
+			ParameterValue = new(VectorParameterValues) FVectorParameterValue;
+			ParameterValue->ParameterInfo = ParameterInfo;
+			ParameterValue->ExpressionGUID.Invalidate();
+			GameThread_AddParameterIndex(VectorParameterValues, VectorParameterIndexMap);
+		}
+		else if (VectorParameterValues[ParameterIndex].ParameterValue != Value)
+		{
+			ParameterValue = &VectorParameterValues[ParameterIndex];
+		}
+
+		if (ParameterValue)
+		{
+			ParameterValue->ParameterValue = Value;
+			FMaterialInstanceResource::TNamedParameter<FLinearColor>& ChangedParameter = ChangedParameters.VectorParameters.AddDefaulted_GetRef();
+			ChangedParameter.Info = ParameterInfo;
+			ChangedParameter.Value = Value;
+		}
+	}
+
+	const int32 NumChangedParameters = ChangedParameters.ScalarParameters.Num() + ChangedParameters.VectorParameters.Num();
+	INC_DWORD_STAT_BY(STAT_MaterialInstanceParameterUpdates, NumChangedParameters);
+
+	// Update the material instance data in the rendering thread.
+	if (NumChangedParameters > 0 && FApp::CanEverRender())
+	{
+		INC_DWORD_STAT(STAT_MaterialInstanceRenderThreadUpdates);
+		FMaterialInstanceResource* InstanceResource = Resource;
+		ENQUEUE_RENDER_COMMAND(SetMIParameterValues)(
+			[InstanceResource, ChangedParameters = MoveTemp(ChangedParameters)](FRHICommandListImmediate& RHICmdList)
+			{
+				InstanceResource->RenderThread_UpdateParameters(ChangedParameters);
+				InstanceResource->CacheUniformExpressions(false);
+			});
+	}
+}
+
 UMaterialInstanceDynamic* UMaterialInstanceDynamic::Create(UMaterialInterface* ParentMaterial, UObject* InOuter)
 {
 	LLM_SCOPE(ELLMTag::MaterialInstance);
@@ -78,12 +244,12 @@ UMaterialInstanceDynamic* UMaterialInstanceDynamic::Create(UMaterialInterface* P
 void UMaterialInstanceDynamic::SetVectorParameterValue(FName ParameterName, FLinearColor Value)
 {
 	FMaterialParameterInfo ParameterInfo(ParameterName);
-	SetVectorParameterValueInternal(ParameterInfo,Value);
+	SetVectorParameterValueHashed(ParameterInfo, Value);
 }
 
 void UMaterialInstanceDynamic::SetVectorParameterValueByInfo(const FMaterialParameterInfo& ParameterInfo, FLinearColor Value)
 {
-	SetVectorParameterValueInternal(ParameterInfo, Value);
+	SetVectorParameterValueHashed(ParameterInfo, Value);
 }
 
 FLinearColor UMaterialInstanceDynamic::K2_GetVectorParameterValue(FName ParameterName)
@@ -104,12 +270,12 @@ FLinearColor UMaterialInstanceDynamic::K2_GetVectorParameterValueByInfo(const FM
 void UMaterialInstanceDynamic::SetScalarParameterValue(FName ParameterName, float Value)
 {
 	FMaterialParameterInfo ParameterInfo(ParameterName);
-	SetScalarParameterValueInternal(ParameterInfo,Value);
+	SetScalarParameterValueHashed(ParameterInfo, Value);
 }
 
 void UMaterialInstanceDynamic::SetScalarParameterValueByInfo(const FMaterialParameterInfo& ParameterInfo, float Value)
 {
-	SetScalarParameterValueInternal(ParameterInfo, Value);
+	SetScalarParameterValueHashed(ParameterInfo, Value);
 }
 
 bool UMaterialInstanceDynamic::InitializeScalarParameterAndGetIndex(const FName& ParameterName, float Value, int32& OutParameterIndex)
@@ -117,9 +283,9 @@ bool UMaterialInstanceDynamic::InitializeScalarParameterAndGetIndex(const FName&
 	OutParameterIndex = INDEX_NONE;
 
 	FMaterialParameterInfo ParameterInfo(ParameterName); // @TODO: This will only work for non-layered parameters
-	SetScalarParameterValueInternal(ParameterInfo, Value);
+	SetScalarParameterValueHashed(ParameterInfo, Value);
 
-	OutParameterIndex = GameThread_FindParameterIndexByName(ScalarParameterValues, ParameterInfo);
+	OutParameterIndex = GameThread_FindParameterIndexHashed(ScalarParameterValues, ScalarParameterIndexMap, ParameterInfo);
 
 	return (OutParameterIndex != INDEX_NONE);
 }
@@ -134,9 +300,9 @@ bool UMaterialInstanceDynamic::InitializeVectorParameterAndGetIndex(const FName&
 	OutParameterIndex = INDEX_NONE;
 
 	FMaterialParameterInfo ParameterInfo(ParameterName);
-	SetVectorParameterValueInternal(ParameterInfo, Value);
+	SetVectorParameterValueHashed(ParameterInfo, Value);
 
-	OutParameterIndex = GameThread_FindParameterIndexByName(VectorParameterValues, ParameterInfo);
+	OutParameterIndex = GameThread_FindParameterIndexHashed(VectorParameterValues, VectorParameterIndexMap, ParameterInfo);
 
 	return (OutParameterIndex != INDEX_NONE);
 }
@@ -214,6 +380,7 @@ void UMaterialInstanceDynamic::SetFontParameterValue(const FMaterialParameterInf
 void UMaterialInstanceDynamic::ClearParameterValues()
 {
 	ClearParameterValuesInternal();
+	InvalidateParameterIndexMaps();
 }
 
 
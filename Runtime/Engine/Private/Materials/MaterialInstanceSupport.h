@@ -14,6 +14,9 @@
 
 class UTexture;
 
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("MI Parameter Updates"), STAT_MaterialInstanceParameterUpdates, STATGROUP_Shaders, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("MI Render Thread Updates"), STAT_MaterialInstanceRenderThreadUpdates, STATGROUP_Shaders, );
+
 /**
  * Cache uniform expressions for the given material instance.
  * @param MaterialInstance - The material instance for which to cache uniform expressions.
@@ -127,23 +130,14 @@ public:
 		LLM_SCOPE(ELLMTag::MaterialInstance);
 
 		InvalidateUniformExpressionCache(false);
-		TArray<TNamedParameter<ValueType> >& ValueArray = GetValueArray<ValueType>();
-		const int32 ParameterCount = ValueArray.Num();
-		for (int32 ParameterIndex = 0; ParameterIndex < ParameterCount; ++ParameterIndex)
-		{
-			TNamedParameter<ValueType>& Parameter = ValueArray[ParameterIndex];
-			if (Parameter.Info == ParameterInfo)
-			{
-				Parameter.Value = Value;
-				return;
-			}
-		}
-		TNamedParameter<ValueType> NewParameter;
-		NewParameter.Info = ParameterInfo;
-		NewParameter.Value = Value;
-		ValueArray.Add(NewParameter);
+		SetParameterValue(ParameterInfo, Value);
 	}
 
+	/**
+	 * Updates many named parameters on the render thread, invalidating the uniform expression cache once for all of them.
+	 */
+	void RenderThread_UpdateParameters(const struct FMaterialInstanceParameterSet& ParameterSet);
+
 	/**
 	 * Retrieves a parameter by name.
 	 */
@@ -164,6 +158,29 @@ public:
 	}
 	
 private:
+	/**
+	 * Sets the value of a named parameter, adding it if needed.
+	 */
+	template <typename ValueType>
+	void SetParameterValue(const FHashedMaterialParameterInfo& ParameterInfo, const ValueType& Value)
+	{
+		TArray<TNamedParameter<ValueType> >& ValueArray = GetValueArray<ValueType>();
+		const int32 ParameterCount = ValueArray.Num();
+		for (int32 ParameterIndex = 0; ParameterIndex < ParameterCount; ++ParameterIndex)
+		{
+			TNamedParameter<ValueType>& Parameter = ValueArray[ParameterIndex];
+			if (Parameter.Info == ParameterInfo)
+			{
+				Parameter.Value = Value;
+				return;
+			}
+		}
+		TNamedParameter<ValueType> NewParameter;
+		NewParameter.Info = ParameterInfo;
+		NewParameter.Value = Value;
+		ValueArray.Add(NewParameter);
+	}
+
 	/**
 	 * Retrieves the array of values for a given type.
 	 */
@@ -608,6 +608,13 @@ namespace
 			, NumNames(InContext.NumNames)
 		{}
 
+		explicit FPreshaderDataContext(const FPreshaderDataContext& InContext, const uint8* InPtr, const uint8* InEndPtr)
+			: Ptr(InPtr)
+			, EndPtr(InEndPtr)
+			, Names(InContext.Names)
+			, NumNames(InContext.NumNames)
+		{}
+
 		const uint8* RESTRICT Ptr;
 		const uint8* RESTRICT EndPtr;
 		const FScriptName* RESTRICT Names;
@@ -727,6 +734,26 @@ static void GetScalarParameter(const FUniformExpressionSet& UniformExpressionSet
 
 using FPreshaderStack = TArray<FLinearColor, TInlineAllocator<64u>>;
 
+/**
+ * Parameter values looked up while filling a uniform buffer.
+ * Parameters are often shared by several preshaders of a material, this only looks each of them up once through the render proxy.
+ */
+struct FPreshaderParameterCache
+{
+	FPreshaderParameterCache(int32 NumScalarParameters, int32 NumVectorParameters)
+	{
+		ScalarValues.SetNumUninitialized(NumScalarParameters);
+		VectorValues.SetNumUninitialized(NumVectorParameters);
+		bScalarValid.Init(false, NumScalarParameters);
+		bVectorValid.Init(false, NumVectorParameters);
+	}
+
+	TArray<FLinearColor, TInlineAllocator<32u>> ScalarValues;
+	TArray<FLinearColor, TInlineAllocator<32u>> VectorValues;
+	TBitArray<TInlineAllocator<1u>> bScalarValid;
+	TBitArray<TInlineAllocator<1u>> bVectorValid;
+};
+
 template<typename Operation>
 static inline void EvaluateUnaryOp(FPreshaderStack& Stack, const Operation& Op)
 {
@@ -742,6 +769,15 @@ static inline void EvaluateBinaryOp(FPreshaderStack& Stack, const Operation& Op)
 	Stack.Add(FLinearColor(Op(Value0.R, Value1.R), Op(Value0.G, Value1.G), Op(Value0.B, Value1.B), Op(Value0.A, Value1.A)));
 }
 
+/** Componentwise binary op on all four components at once, for the operations which have an exact vector equivalent. */
+template<typename Operation>
+static inline void EvaluateVectorBinaryOp(FPreshaderStack& Stack, const Operation& Op)
+{
+	const FLinearColor Value1 = Stack.Pop(false);
+	FLinearColor& Value0 = Stack.Last();
+	VectorStore(Op(VectorLoad(&Value0.R), VectorLoad(&Value1.R)), &Value0.R);
+}
+
 template<typename Operation>
 static inline void EvaluateTernaryOp(FPreshaderStack& Stack, const Operation& Op)
 {
@@ -953,9 +989,61 @@ FORCENOINLINE static float DivideComponent(float A, float B)
 	return A / GetSafeDivisor(B);
 }
 
-static void EvaluatePreshader(const FUniformExpressionSet* UniformExpressionSet, const FMaterialRenderContext& Context, FPreshaderStack& Stack, FPreshaderDataContext& RESTRICT Data, FLinearColor& OutValue)
+/**
+ * Evaluates the opcodes which only depend on their operands and the values on the stack.
+ * @return false for the opcodes which read parameters, textures or other data from the render context
+ */
+static FORCEINLINE bool EvaluateFoldableOpcode(EMaterialPreshaderOpcode Opcode, FPreshaderStack& Stack, FPreshaderDataContext& RESTRICT Data)
 {
 	static const float LogToLog10 = 1.0f / FMath::Loge(10.f);
+
+	switch (Opcode)
+	{
+	case EMaterialPreshaderOpcode::ConstantZero:
+		Stack.Add(FLinearColor(0.0f, 0.0f, 0.0f, 0.0f));
+		break;
+	case EMaterialPreshaderOpcode::Constant:
+		Stack.Add(ReadPreshaderValue<FLinearColor>(Data));
+		break;
+	case EMaterialPreshaderOpcode::Add: EvaluateVectorBinaryOp(Stack, [](VectorRegister Lhs, VectorRegister Rhs) { return VectorAdd(Lhs, Rhs); }); break;
+	case EMaterialPreshaderOpcode::Sub: EvaluateVectorBinaryOp(Stack, [](VectorRegister Lhs, VectorRegister Rhs) { return VectorSubtract(Lhs, Rhs); }); break;
+	case EMaterialPreshaderOpcode::Mul: EvaluateVectorBinaryOp(Stack, [](VectorRegister Lhs, VectorRegister Rhs) { return VectorMultiply(Lhs, Rhs); }); break;
+	case EMaterialPreshaderOpcode::Div: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return DivideComponent(Lhs, Rhs); }); break;
+	case EMaterialPreshaderOpcode::Fmod: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return FMath::Fmod(Lhs, Rhs); }); break;
+	case EMaterialPreshaderOpcode::Min: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return FMath::Min(Lhs, Rhs); }); break;
+	case EMaterialPreshaderOpcode::Max: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return FMath::Max(Lhs, Rhs); }); break;
+	case EMaterialPreshaderOpcode::Clamp: EvaluateTernaryOp(Stack, [](float A, float B, float C) { return FMath::Clamp(A, B, C); }); break;
+	case EMaterialPreshaderOpcode::Dot: EvaluateDot(Stack, Data); break;
+	case EMaterialPreshaderOpcode::Cross: EvaluateCross(Stack, Data); break;
+	case EMaterialPreshaderOpcode::Sqrt: EvaluateUnaryOp(Stack, [](float V) { return FMath::Sqrt(V); }); break;
+	case EMaterialPreshaderOpcode::Sin: EvaluateUnaryOp(Stack, [](float V) { return FMath::Sin(V); }); break;
+	case EMaterialPreshaderOpcode::Cos: EvaluateUnaryOp(Stack, [](float V) { return FMath::Cos(V); }); break;
+	case EMaterialPreshaderOpcode::Tan: EvaluateUnaryOp(Stack, [](float V) { return FMath::Tan(V); }); break;
+	case EMaterialPreshaderOpcode::Asin: EvaluateUnaryOp(Stack, [](float V) { return FMath::Asin(V); }); break;
+	case EMaterialPreshaderOpcode::Acos: EvaluateUnaryOp(Stack, [](float V) { return FMath::Acos(V); }); break;
+	case EMaterialPreshaderOpcode::Atan: EvaluateUnaryOp(Stack, [](float V) { return FMath::Atan(V); }); break;
+	case EMaterialPreshaderOpcode::Atan2: EvaluateBinaryOp(Stack, [](float A, float B) { return FMath::Atan2(A, B); }); break;
+	case EMaterialPreshaderOpcode::Abs: EvaluateUnaryOp(Stack, [](float V) { return FMath::Abs(V); }); break;
+	case EMaterialPreshaderOpcode::Saturate: EvaluateUnaryOp(Stack, [](float V) { return FMath::Clamp(V, 0.0f, 1.0f); }); break;
+	case EMaterialPreshaderOpcode::Floor: EvaluateUnaryOp(Stack, [](float V) { return FMath::FloorToFloat(V); }); break;
+	case EMaterialPreshaderOpcode::Ceil: EvaluateUnaryOp(Stack, [](float V) { return FMath::CeilToFloat(V); }); break;
+	case EMaterialPreshaderOpcode::Round: EvaluateUnaryOp(Stack, [](float V) { return FMath::RoundToFloat(V); }); break;
+	case EMaterialPreshaderOpcode::Trunc: EvaluateUnaryOp(Stack, [](float V) { return FMath::TruncToFloat(V); }); break;
+	case EMaterialPreshaderOpcode::Sign: EvaluateUnaryOp(Stack, [](float V) { return FMath::Sign(V); }); break;
+	case EMaterialPreshaderOpcode::Frac: EvaluateUnaryOp(Stack, [](float V) { return FMath::Frac(V); }); break;
+	case EMaterialPreshaderOpcode::Fractional: EvaluateUnaryOp(Stack, [](float V) { return FMath::Fractional(V); }); break;
+	case EMaterialPreshaderOpcode::Log2: EvaluateUnaryOp(Stack, [](float V) { return FMath::Log2(V); }); break;
+	case EMaterialPreshaderOpcode::Log10: EvaluateUnaryOp(Stack, [](float V) { return FMath::Loge(V) * LogToLog10; }); break;
+	case EMaterialPreshaderOpcode::ComponentSwizzle: EvaluateComponentSwizzle(Stack, Data); break;
+	case EMaterialPreshaderOpcode::AppendVector: EvaluateAppenedVector(Stack, Data); break;
+	default:
+		return false;
+	}
+	return true;
+}
+
+static void EvaluatePreshader(const FUniformExpressionSet* UniformExpressionSet, const FMaterialRenderContext& Context, FPreshaderStack& Stack, FPreshaderDataContext& RESTRICT Data, FPreshaderParameterCache* ParameterCache, FLinearColor& OutValue)
+{
 	uint8 const* const DataEnd = Data.EndPtr;
 
 	Stack.Reset();
@@ -964,58 +1052,54 @@ static void EvaluatePreshader(const FUniformExpressionSet* UniformExpressionSet,
 		const EMaterialPreshaderOpcode Opcode = (EMaterialPreshaderOpcode)ReadPreshaderValue<uint8>(Data);
 		switch (Opcode)
 		{
-		case EMaterialPreshaderOpcode::ConstantZero:
-			Stack.Add(FLinearColor(0.0f, 0.0f, 0.0f, 0.0f));
-			break;
-		case EMaterialPreshaderOpcode::Constant:
-			Stack.Add(ReadPreshaderValue<FLinearColor>(Data));
-			break;
 		case EMaterialPreshaderOpcode::VectorParameter:
+		{
 			check(UniformExpressionSet);
-			GetVectorParameter(*UniformExpressionSet, ReadPreshaderValue<uint16>(Data), Context, Stack.AddDefaulted_GetRef());
+			const uint16 ParameterIndex = ReadPreshaderValue<uint16>(Data);
+			if (!ParameterCache)
+			{
+				GetVectorParameter(*UniformExpressionSet, ParameterIndex, Context, Stack.AddDefaulted_GetRef());
+			}
+			else
+			{
+				if (!ParameterCache->bVectorValid[ParameterIndex])
+				{
+					GetVectorParameter(*UniformExpressionSet, ParameterIndex, Context, ParameterCache->VectorValues[ParameterIndex]);
+					ParameterCache->bVectorValid[ParameterIndex] = true;
+				}
+				Stack.Add(ParameterCache->VectorValues[ParameterIndex]);
+			}
 			break;
+		}
 		case EMaterialPreshaderOpcode::ScalarParameter:
+		{
 			check(UniformExpressionSet);
-			GetScalarParameter(*UniformExpressionSet, ReadPreshaderValue<uint16>(Data), Context, Stack.AddDefaulted_GetRef());
+			const uint16 ParameterIndex = ReadPreshaderValue<uint16>(Data);
+			if (!ParameterCache)
+			{
+				GetScalarParameter(*UniformExpressionSet, ParameterIndex, Context, Stack.AddDefaulted_GetRef());
+			}
+			else
+			{
+				if (!ParameterCache->bScalarValid[ParameterIndex])
+				{
+					GetScalarParameter(*UniformExpressionSet, ParameterIndex, Context, ParameterCache->ScalarValues[ParameterIndex]);
+					ParameterCache->bScalarValid[ParameterIndex] = true;
+				}
+				Stack.Add(ParameterCache->ScalarValues[ParameterIndex]);
+			}
 			break;
-		case EMaterialPreshaderOpcode::Add: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return Lhs + Rhs; }); break;
-		case EMaterialPreshaderOpcode::Sub: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return Lhs - Rhs; }); break;
-		case EMaterialPreshaderOpcode::Mul: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return Lhs * Rhs; }); break;
-		case EMaterialPreshaderOpcode::Div: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return DivideComponent(Lhs, Rhs); }); break;
-		case EMaterialPreshaderOpcode::Fmod: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return FMath::Fmod(Lhs, Rhs); }); break;
-		case EMaterialPreshaderOpcode::Min: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return FMath::Min(Lhs, Rhs); }); break;
-		case EMaterialPreshaderOpcode::Max: EvaluateBinaryOp(Stack, [](float Lhs, float Rhs) { return FMath::Max(Lhs, Rhs); }); break;
-		case EMaterialPreshaderOpcode::Clamp: EvaluateTernaryOp(Stack, [](float A, float B, float C) { return FMath::Clamp(A, B, C); }); break;
-		case EMaterialPreshaderOpcode::Dot: EvaluateDot(Stack, Data); break;
-		case EMaterialPreshaderOpcode::Cross: EvaluateCross(Stack, Data); break;
-		case EMaterialPreshaderOpcode::Sqrt: EvaluateUnaryOp(Stack, [](float V) { return FMath::Sqrt(V); }); break;
-		case EMaterialPreshaderOpcode::Sin: EvaluateUnaryOp(Stack, [](float V) { return FMath::Sin(V); }); break;
-		case EMaterialPreshaderOpcode::Cos: EvaluateUnaryOp(Stack, [](float V) { return FMath::Cos(V); }); break;
-		case EMaterialPreshaderOpcode::Tan: EvaluateUnaryOp(Stack, [](float V) { return FMath::Tan(V); }); break;
-		case EMaterialPreshaderOpcode::Asin: EvaluateUnaryOp(Stack, [](float V) { return FMath::Asin(V); }); break;
-		case EMaterialPreshaderOpcode::Acos: EvaluateUnaryOp(Stack, [](float V) { return FMath::Acos(V); }); break;
-		case EMaterialPreshaderOpcode::Atan: EvaluateUnaryOp(Stack, [](float V) { return FMath::Atan(V); }); break;
-		case EMaterialPreshaderOpcode::Atan2: EvaluateBinaryOp(Stack, [](float A, float B) { return FMath::Atan2(A, B); }); break;
-		case EMaterialPreshaderOpcode::Abs: EvaluateUnaryOp(Stack, [](float V) { return FMath::Abs(V); }); break;
-		case EMaterialPreshaderOpcode::Saturate: EvaluateUnaryOp(Stack, [](float V) { return FMath::Clamp(V, 0.0f, 1.0f); }); break;
-		case EMaterialPreshaderOpcode::Floor: EvaluateUnaryOp(Stack, [](float V) { return FMath::FloorToFloat(V); }); break;
-		case EMaterialPreshaderOpcode::Ceil: EvaluateUnaryOp(Stack, [](float V) { return FMath::CeilToFloat(V); }); break;
-		case EMaterialPreshaderOpcode::Round: EvaluateUnaryOp(Stack, [](float V) { return FMath::RoundToFloat(V); }); break;
-		case EMaterialPreshaderOpcode::Trunc: EvaluateUnaryOp(Stack, [](float V) { return FMath::TruncToFloat(V); }); break;
-		case EMaterialPreshaderOpcode::Sign: EvaluateUnaryOp(Stack, [](float V) { return FMath::Sign(V); }); break;
-		case EMaterialPreshaderOpcode::Frac: EvaluateUnaryOp(Stack, [](float V) { return FMath::Frac(V); }); break;
-		case EMaterialPreshaderOpcode::Fractional: EvaluateUnaryOp(Stack, [](float V) { return FMath::Fractional(V); }); break;
-		case EMaterialPreshaderOpcode::Log2: EvaluateUnaryOp(Stack, [](float V) { return FMath::Log2(V); }); break;
-		case EMaterialPreshaderOpcode::Log10: EvaluateUnaryOp(Stack, [](float V) { return FMath::Loge(V) * LogToLog10; }); break;
-		case EMaterialPreshaderOpcode::ComponentSwizzle: EvaluateComponentSwizzle(Stack, Data); break;
-		case EMaterialPreshaderOpcode::AppendVector: EvaluateAppenedVector(Stack, Data); break;
+		}
 		case EMaterialPreshaderOpcode::TextureSize: EvaluateTextureSize(Context, Stack, Data); break;
 		case EMaterialPreshaderOpcode::TexelSize: EvaluateTexelSize(Context, Stack, Data); break;
 		case EMaterialPreshaderOpcode::ExternalTextureCoordinateScaleRotation: EvaluateExternalTextureCoordinateScaleRotation(Context, Stack, Data); break;
 		case EMaterialPreshaderOpcode::ExternalTextureCoordinateOffset: EvaluateExternalTextureCoordinateOffset(Context, Stack, Data); break;
 		case EMaterialPreshaderOpcode::RuntimeVirtualTextureUniform: EvaluateRuntimeVirtualTextureUniform(Context, Stack, Data); break;
 		default:
-			UE_LOG(LogMaterial, Fatal, TEXT("Unknown preshader opcode %d"), (uint8)Opcode);
+			if (!EvaluateFoldableOpcode(Opcode, Stack, Data))
+			{
+				UE_LOG(LogMaterial, Fatal, TEXT("Unknown preshader opcode %d"), (uint8)Opcode);
+			}
 			break;
 		}
 	}
@@ -1028,6 +1112,282 @@ static void EvaluatePreshader(const FUniformExpressionSet* UniformExpressionSet,
 	}
 }
 
+void EvaluateMaterialPreshader(const FUniformExpressionSet* UniformExpressionSet, const FMaterialRenderContext& Context, const FMaterialPreshaderData& Data, const FMaterialUniformPreshaderHeader& Header, FLinearColor& OutValue)
+{
+	FPreshaderStack Stack;
+	FPreshaderDataContext PreshaderBaseContext(Data);
+	FPreshaderDataContext PreshaderContext(PreshaderBaseContext, Header);
+	EvaluatePreshader(UniformExpressionSet, Context, Stack, PreshaderContext, nullptr, OutValue);
+}
+
+/** Number of values an opcode pops from the stack, INDEX_NONE for opcodes the optimizer doesn't know about. Every opcode but Nop pushes a single value. */
+static int32 GetPreshaderOpcodeNumInputs(EMaterialPreshaderOpcode Opcode)
+{
+	switch (Opcode)
+	{
+	case EMaterialPreshaderOpcode::Nop:
+	case EMaterialPreshaderOpcode::ConstantZero:
+	case EMaterialPreshaderOpcode::Constant:
+	case EMaterialPreshaderOpcode::ScalarParameter:
+	case EMaterialPreshaderOpcode::VectorParameter:
+	case EMaterialPreshaderOpcode::TextureSize:
+	case EMaterialPreshaderOpcode::TexelSize:
+	case EMaterialPreshaderOpcode::ExternalTextureCoordinateScaleRotation:
+	case EMaterialPreshaderOpcode::ExternalTextureCoordinateOffset:
+	case EMaterialPreshaderOpcode::RuntimeVirtualTextureUniform:
+		return 0;
+	case EMaterialPreshaderOpcode::Sin:
+	case EMaterialPreshaderOpcode::Cos:
+	case EMaterialPreshaderOpcode::Tan:
+	case EMaterialPreshaderOpcode::Asin:
+	case EMaterialPreshaderOpcode::Acos:
+	case EMaterialPreshaderOpcode::Atan:
+	case EMaterialPreshaderOpcode::Sqrt:
+	case EMaterialPreshaderOpcode::Length:
+	case EMaterialPreshaderOpcode::Saturate:
+	case EMaterialPreshaderOpcode::Abs:
+	case EMaterialPreshaderOpcode::Floor:
+	case EMaterialPreshaderOpcode::Ceil:
+	case EMaterialPreshaderOpcode::Round:
+	case EMaterialPreshaderOpcode::Trunc:
+	case EMaterialPreshaderOpcode::Sign:
+	case EMaterialPreshaderOpcode::Frac:
+	case EMaterialPreshaderOpcode::Fractional:
+	case EMaterialPreshaderOpcode::Log2:
+	case EMaterialPreshaderOpcode::Log10:
+	case EMaterialPreshaderOpcode::ComponentSwizzle:
+		return 1;
+	case EMaterialPreshaderOpcode::Add:
+	case EMaterialPreshaderOpcode::Sub:
+	case EMaterialPreshaderOpcode::Mul:
+	case EMaterialPreshaderOpcode::Div:
+	case EMaterialPreshaderOpcode::Fmod:
+	case EMaterialPreshaderOpcode::Min:
+	case EMaterialPreshaderOpcode::Max:
+	case EMaterialPreshaderOpcode::Atan2:
+	case EMaterialPreshaderOpcode::Dot:
+	case EMaterialPreshaderOpcode::Cross:
+	case EMaterialPreshaderOpcode::AppendVector:
+		return 2;
+	case EMaterialPreshaderOpcode::Clamp:
+		return 3;
+	default:
+		return INDEX_NONE;
+	}
+}
+
+/** Size in bytes of the operands written after an opcode, must match what WriteNumberOpcodes writes and the evaluation reads. */
+static int32 GetPreshaderOpcodeOperandSize(EMaterialPreshaderOpcode Opcode)
+{
+	// Name index, index and association, see FMaterialPreshaderData::Write<FHashedMaterialParameterInfo>
+	const int32 ParameterInfoSize = sizeof(uint16) + sizeof(int32) + sizeof(TEnumAsByte<EMaterialParameterAssociation>);
+
+	switch (Opcode)
+	{
+	case EMaterialPreshaderOpcode::Constant: return sizeof(FLinearColor);
+	case EMaterialPreshaderOpcode::ScalarParameter:
+	case EMaterialPreshaderOpcode::VectorParameter: return sizeof(uint16);
+	case EMaterialPreshaderOpcode::Dot:
+	case EMaterialPreshaderOpcode::Cross:
+	case EMaterialPreshaderOpcode::Length:
+	case EMaterialPreshaderOpcode::AppendVector: return sizeof(uint8);
+	case EMaterialPreshaderOpcode::ComponentSwizzle: return 5 * sizeof(uint8);
+	case EMaterialPreshaderOpcode::TextureSize:
+	case EMaterialPreshaderOpcode::TexelSize: return ParameterInfoSize + sizeof(int32);
+	case EMaterialPreshaderOpcode::ExternalTextureCoordinateScaleRotation:
+	case EMaterialPreshaderOpcode::ExternalTextureCoordinateOffset: return sizeof(uint16) + sizeof(FGuid) + sizeof(int32);
+	case EMaterialPreshaderOpcode::RuntimeVirtualTextureUniform: return ParameterInfoSize + 2 * sizeof(int32);
+	default: return 0;
+	}
+}
+
+bool OptimizeMaterialPreshader(const FMaterialPreshaderData& Data, const FMaterialUniformPreshaderHeader& Header, TArray<uint8>& OutOpcodes)
+{
+	struct FStackValue
+	{
+		/** Offset in OutOpcodes of the first opcode contributing to this value */
+		int32 OpcodeOffset;
+		bool bConstant;
+		FLinearColor Value;
+	};
+
+	TArray<FStackValue, TInlineAllocator<64u>> Stack;
+	FPreshaderStack EvaluationStack;
+	const FPreshaderDataContext BaseContext(Data);
+	const uint8* Ptr = Data.Data.GetData() + Header.OpcodeOffset;
+	const uint8* const EndPtr = Ptr + Header.OpcodeSize;
+
+	OutOpcodes.Reset();
+	while (Ptr < EndPtr)
+	{
+		const EMaterialPreshaderOpcode Opcode = (EMaterialPreshaderOpcode)*Ptr;
+		const int32 NumInputs = GetPreshaderOpcodeNumInputs(Opcode);
+		const uint8* const OperandPtr = Ptr + 1;
+		const uint8* const NextPtr = OperandPtr + GetPreshaderOpcodeOperandSize(Opcode);
+		if (NumInputs == INDEX_NONE || NumInputs > Stack.Num() || NextPtr > EndPtr)
+		{
+			return false;
+		}
+
+		if (Opcode != EMaterialPreshaderOpcode::Nop)
+		{
+			const int32 FirstInput = Stack.Num() - NumInputs;
+			const int32 OpcodeOffset = NumInputs > 0 ? Stack[FirstInput].OpcodeOffset : OutOpcodes.Num();
+
+			// Evaluate opcodes whose inputs are all constant right away, this also decodes constants themselves
+			bool bConstant = true;
+			EvaluationStack.Reset();
+			for (int32 InputIndex = FirstInput; InputIndex < Stack.Num(); ++InputIndex)
+			{
+				bConstant &= Stack[InputIndex].bConstant;
+				EvaluationStack.Add(Stack[InputIndex].Value);
+			}
+			if (bConstant)
+			{
+				FPreshaderDataContext OperandContext(BaseContext, OperandPtr, NextPtr);
+				bConstant = EvaluateFoldableOpcode(Opcode, EvaluationStack, OperandContext) && EvaluationStack.Num() == 1;
+			}
+
+			FStackValue Result;
+			Result.OpcodeOffset = OpcodeOffset;
+			Result.bConstant = bConstant;
+			Result.Value = bConstant ? EvaluationStack.Last() : FLinearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+			Stack.SetNum(FirstInput, false);
+			if (bConstant)
+			{
+				// Replace the opcodes of the inputs by the folded value
+				OutOpcodes.SetNum(OpcodeOffset, false);
+
+				// Compare bits rather than values, so that negative zeros stay what they are
+				static const FLinearColor Zero(0.0f, 0.0f, 0.0f, 0.0f);
+				if (FMemory::Memcmp(&Result.Value, &Zero, sizeof(FLinearColor)) == 0)
+				{
+					OutOpcodes.Add((uint8)EMaterialPreshaderOpcode::ConstantZero);
+				}
+				else
+				{
+					OutOpcodes.Add((uint8)EMaterialPreshaderOpcode::Constant);
+					OutOpcodes.Append((const uint8*)&Result.Value, sizeof(FLinearColor));
+				}
+			}
+			else
+			{
+				OutOpcodes.Append(Ptr, NextPtr - Ptr);
+			}
+			Stack.Add(Result);
+		}
+
+		Ptr = NextPtr;
+	}
+	return true;
+}
+
+void OptimizeMaterialPreshaders(FMaterialPreshaderData& Data, TArrayView<FMaterialUniformPreshaderHeader* const> Preshaders)
+{
+	TArray<uint8> OptimizedData;
+	TArray<uint8> PreshaderOpcodes;
+	TMultiMap<uint32, int32> PreshaderOffsetsByHash;
+	OptimizedData.Reserve(Data.Num());
+
+	for (FMaterialUniformPreshaderHeader* Preshader : Preshaders)
+	{
+		if (!OptimizeMaterialPreshader(Data, *Preshader, PreshaderOpcodes))
+		{
+			PreshaderOpcodes.Reset();
+			PreshaderOpcodes.Append(Data.Data.GetData() + Preshader->OpcodeOffset, Preshader->OpcodeSize);
+		}
+
+		// Identical preshaders share their opcodes
+		const uint32 Hash = FCrc::MemCrc32(PreshaderOpcodes.GetData(), PreshaderOpcodes.Num());
+		int32 OpcodeOffset = INDEX_NONE;
+		for (TMultiMap<uint32, int32>::TConstKeyIterator It(PreshaderOffsetsByHash, Hash); It; ++It)
+		{
+			const int32 CandidateOffset = It.Value();
+			if (CandidateOffset + PreshaderOpcodes.Num() <= OptimizedData.Num() && FMemory::Memcmp(OptimizedData.GetData() + CandidateOffset, PreshaderOpcodes.GetData(), PreshaderOpcodes.Num()) == 0)
+			{
+				OpcodeOffset = CandidateOffset;
+				break;
+			}
+		}
+		if (OpcodeOffset == INDEX_NONE)
+		{
+			OpcodeOffset = OptimizedData.Num();
+			OptimizedData.Append(PreshaderOpcodes);
+			PreshaderOffsetsByHash.Add(Hash, OpcodeOffset);
+		}
+
+		Preshader->OpcodeOffset = OpcodeOffset;
+		Preshader->OpcodeSize = PreshaderOpcodes.Num();
+	}
+
+	Data.Data.Empty(OptimizedData.Num());
+	Data.Data.Append(OptimizedData.GetData(), OptimizedData.Num());
+}
+
+int32 FUniformExpressionSet::FindOrAddScalarParameter(const FHashedMaterialParameterInfo& ParameterInfo, float DefaultValue)
+{
+	for (int32 ParameterIndex = 0; ParameterIndex < UniformScalarParameters.Num(); ++ParameterIndex)
+	{
+		if (UniformScalarParameters[ParameterIndex].ParameterInfo == ParameterInfo)
+		{
+			return ParameterIndex;
+		}
+	}
+
+	FMaterialScalarParameterInfo& Parameter = UniformScalarParameters.AddDefaulted_GetRef();
+	Parameter.ParameterInfo = ParameterInfo;
+	Parameter.DefaultValue = DefaultValue;
+	return UniformScalarParameters.Num() - 1;
+}
+
+int32 FUniformExpressionSet::FindOrAddVectorParameter(const FHashedMaterialParameterInfo& ParameterInfo, const FLinearColor& DefaultValue)
+{
+	for (int32 ParameterIndex = 0; ParameterIndex < UniformVectorParameters.Num(); ++ParameterIndex)
+	{
+		if (UniformVectorParameters[ParameterIndex].ParameterInfo == ParameterInfo)
+		{
+			return ParameterIndex;
+		}
+	}
+
+	FMaterialVectorParameterInfo& Parameter = UniformVectorParameters.AddDefaulted_GetRef();
+	Parameter.ParameterInfo = ParameterInfo;
+	Parameter.DefaultValue = DefaultValue;
+	return UniformVectorParameters.Num() - 1;
+}
+
+void FUniformExpressionSet::AddScalarPreshader(const FMaterialUniformExpression& Expression)
+{
+	FMaterialUniformPreshaderHeader& Preshader = UniformScalarPreshaders.AddDefaulted_GetRef();
+	Preshader.OpcodeOffset = UniformPreshaderData.Num();
+	Expression.WriteNumberOpcodes(UniformPreshaderData);
+	Preshader.OpcodeSize = UniformPreshaderData.Num() - Preshader.OpcodeOffset;
+}
+
+void FUniformExpressionSet::AddVectorPreshader(const FMaterialUniformExpression& Expression)
+{
+	FMaterialUniformPreshaderHeader& Preshader = UniformVectorPreshaders.AddDefaulted_GetRef();
+	Preshader.OpcodeOffset = UniformPreshaderData.Num();
+	Expression.WriteNumberOpcodes(UniformPreshaderData);
+	Preshader.OpcodeSize = UniformPreshaderData.Num() - Preshader.OpcodeOffset;
+}
+
+void FUniformExpressionSet::OptimizePreshaders()
+{
+	TArray<FMaterialUniformPreshaderHeader*> Preshaders;
+	Preshaders.Reserve(UniformScalarPreshaders.Num() + UniformVectorPreshaders.Num());
+	for (FMaterialUniformPreshaderHeader& Preshader : UniformScalarPreshaders)
+	{
+		Preshaders.Add(&Preshader);
+	}
+	for (FMaterialUniformPreshaderHeader& Preshader : UniformVectorPreshaders)
+	{
+		Preshaders.Add(&Preshader);
+	}
+	OptimizeMaterialPreshaders(UniformPreshaderData, Preshaders);
+}
+
 void FMaterialUniformExpression::GetNumberValue(const struct FMaterialRenderContext& Context, FLinearColor& OutValue) const
 {
 	FMaterialPreshaderData PreshaderData;
@@ -1035,7 +1395,7 @@ void FMaterialUniformExpression::GetNumberValue(const struct FMaterialRenderCont
 
 	FPreshaderStack Stack;
 	FPreshaderDataContext PreshaderContext(PreshaderData);
-	EvaluatePreshader(nullptr, Context, Stack, PreshaderContext, OutValue);
+	EvaluatePreshader(nullptr, Context, Stack, PreshaderContext, nullptr, OutValue);
 }
 
 const FMaterialVectorParameterInfo* FUniformExpressionSet::FindVectorParameter(const FHashedMaterialParameterInfo& ParameterInfo) const
@@ -1113,6 +1473,32 @@ void FUniformExpressionSet::GetTextureValue(int32 Index, const FMaterialRenderCo
 	}
 }
 
+void FUniformExpressionSet::EvaluatePreshaders(const FMaterialRenderContext& MaterialRenderContext, TArrayView<FLinearColor> OutVectorValues, TArrayView<float> OutScalarValues, bool bCacheParameters) const
+{
+	check(OutVectorValues.Num() == UniformVectorPreshaders.Num() && OutScalarValues.Num() == UniformScalarPreshaders.Num());
+
+	FPreshaderStack PreshaderStack;
+	FPreshaderParameterCache PreshaderParameterCache(bCacheParameters ? UniformScalarParameters.Num() : 0, bCacheParameters ? UniformVectorParameters.Num() : 0);
+	FPreshaderParameterCache* ParameterCache = bCacheParameters ? &PreshaderParameterCache : nullptr;
+	FPreshaderDataContext PreshaderBaseContext(UniformPreshaderData);
+
+	for (int32 VectorIndex = 0; VectorIndex < UniformVectorPreshaders.Num(); ++VectorIndex)
+	{
+		FLinearColor VectorValue(0, 0, 0, 0);
+		FPreshaderDataContext PreshaderContext(PreshaderBaseContext, UniformVectorPreshaders[VectorIndex]);
+		EvaluatePreshader(this, MaterialRenderContext, PreshaderStack, PreshaderContext, ParameterCache, VectorValue);
+		OutVectorValues[VectorIndex] = VectorValue;
+	}
+
+	for (int32 ScalarIndex = 0; ScalarIndex < UniformScalarPreshaders.Num(); ++ScalarIndex)
+	{
+		FLinearColor VectorValue(0, 0, 0, 0);
+		FPreshaderDataContext PreshaderContext(PreshaderBaseContext, UniformScalarPreshaders[ScalarIndex]);
+		EvaluatePreshader(this, MaterialRenderContext, PreshaderStack, PreshaderContext, ParameterCache, VectorValue);
+		OutScalarValues[ScalarIndex] = VectorValue.R;
+	}
+}
+
 void FUniformExpressionSet::FillUniformBuffer(const FMaterialRenderContext& MaterialRenderContext, const FUniformExpressionCache& UniformExpressionCache, uint8* TempBuffer, int TempBufferSize) const
 {
 	check(IsInParallelRenderingThread());
@@ -1185,37 +1571,12 @@ void FUniformExpressionSet::FillUniformBuffer(const FMaterialRenderContext& Mate
 			}
 		}
 
-		// Dump vector expression into the buffer.
-		FPreshaderStack PreshaderStack;
-		FPreshaderDataContext PreshaderBaseContext(UniformPreshaderData);
-		for(int32 VectorIndex = 0;VectorIndex < UniformVectorPreshaders.Num();++VectorIndex)
-		{
-			FLinearColor VectorValue(0, 0, 0, 0);
-
-			const FMaterialUniformPreshaderHeader& Preshader = UniformVectorPreshaders[VectorIndex];
-			FPreshaderDataContext PreshaderContext(PreshaderBaseContext, Preshader);
-			EvaluatePreshader(this, MaterialRenderContext, PreshaderStack, PreshaderContext, VectorValue);
-	
-			FLinearColor* DestAddress = (FLinearColor*)BufferCursor;
-			*DestAddress = VectorValue;
-			BufferCursor = DestAddress + 1;
-			check(BufferCursor <= TempBuffer + TempBufferSize);
-		}
-
-		// Dump scalar expression into the buffer.
-		for(int32 ScalarIndex = 0;ScalarIndex < UniformScalarPreshaders.Num();++ScalarIndex)
-		{
-			FLinearColor VectorValue(0,0,0,0);
-
-			const FMaterialUniformPreshaderHeader& Preshader = UniformScalarPreshaders[ScalarIndex];
-			FPreshaderDataContext PreshaderContext(PreshaderBaseContext, Preshader);
-			EvaluatePreshader(this, MaterialRenderContext, PreshaderStack, PreshaderContext, VectorValue);
-
-			float* DestAddress = (float*)BufferCursor;
-			*DestAddress = VectorValue.R;
-			BufferCursor = DestAddress + 1;
-			check(BufferCursor <= TempBuffer + TempBufferSize);
-		}
+		// Dump vector and scalar expressions into the buffer.
+		FLinearColor* VectorDestAddress = (FLinearColor*)BufferCursor;
+		float* ScalarDestAddress = (float*)(VectorDestAddress + UniformVectorPreshaders.Num());
+		BufferCursor = ScalarDestAddress + UniformScalarPreshaders.Num();
+		check(BufferCursor <= TempBuffer + TempBufferSize);
+		EvaluatePreshaders(MaterialRenderContext, MakeArrayView(VectorDestAddress, UniformVectorPreshaders.Num()), MakeArrayView(ScalarDestAddress, UniformScalarPreshaders.Num()));
 
 		// Offsets the cursor to next first resource.
 		BufferCursor = ((float*)BufferCursor) + ((4 - UniformScalarPreshaders.Num() % 4) % 4);
@@ -1486,3 +1486,18 @@ protected:
 	/** Index of the uniform vector to fetch from the URuntimeVirtualTexture. */
 	int32 VectorIndex;
 };
+
+/** Evaluates a single preshader of Data, reading parameters through UniformExpressionSet and the render context. */
+void EvaluateMaterialPreshader(const FUniformExpressionSet* UniformExpressionSet, const FMaterialRenderContext& Context, const FMaterialPreshaderData& Data, const FMaterialUniformPreshaderHeader& Header, FLinearColor& OutValue);
+
+/**
+ * Folds the parts of a preshader which don't depend on the render context into constants.
+ * @return false if the preshader contains opcodes the optimizer doesn't know about, in which case it must be kept as is
+ */
+bool OptimizeMaterialPreshader(const FMaterialPreshaderData& Data, const FMaterialUniformPreshaderHeader& Header, TArray<uint8>& OutOpcodes);
+
+/**
+ * Optimizes all the preshaders of Data and lets identical preshaders share their opcodes, updating their headers.
+ * Only whole preshaders are shared, subexpressions common to several preshaders are still evaluated by each of them.
+ */
+void OptimizeMaterialPreshaders(FMaterialPreshaderData& Data, TArrayView<FMaterialUniformPreshaderHeader* const> Preshaders);
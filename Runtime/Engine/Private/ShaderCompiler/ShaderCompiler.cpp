@@ -17,6 +17,8 @@
 #include "Misc/Guid.h"
 #include "Serialization/MemoryWriter.h"
 #include "Serialization/MemoryReader.h"
+#include "Serialization/LargeMemoryReader.h"
+#include "Async/MappedFileHandle.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/FeedbackContext.h"
 #include "Misc/ScopedSlowTask.h"
@@ -324,6 +326,43 @@ static TAutoConsoleVariable<int32> CVarShadersValidation(
 	TEXT("Enabled shader compiler validation warnings and errors."),
 	ECVF_ReadOnly);
 
+static int32 GShaderCompileJobDeduplication = 1;
+static FAutoConsoleVariableRef CVarShaderCompileJobDeduplication(
+	TEXT("r.ShaderCompiler.JobDeduplication"),
+	GShaderCompileJobDeduplication,
+	TEXT("When set to 1, jobs with the same input as a job already being compiled by the local workers wait for that job and copy its output instead of being compiled again.")
+);
+
+static int32 GShaderCompileLocalJobCache = 1;
+static FAutoConsoleVariableRef CVarShaderCompileLocalJobCache(
+	TEXT("r.ShaderCompiler.LocalJobCache"),
+	GShaderCompileLocalJobCache,
+	TEXT("When set to 1, the output of jobs compiled by the local workers is stored in Saved/ShaderJobCache keyed by a hash of the job input,\n")
+	TEXT("and jobs with the same input read it back instead of being compiled, including in later sessions that miss the DDC.")
+);
+
+static int32 GShaderCompileLocalJobCacheMaxSizeMB = 1024;
+static FAutoConsoleVariableRef CVarShaderCompileLocalJobCacheMaxSizeMB(
+	TEXT("r.ShaderCompiler.LocalJobCacheMaxSizeMB"),
+	GShaderCompileLocalJobCacheMaxSizeMB,
+	TEXT("Size in megabytes above which the least recently used entries of Saved/ShaderJobCache are deleted.\n")
+	TEXT("The cache is checked on the first write of a session and every time an eighth of this size has been written since. 0 disables the limit.")
+);
+
+static int32 GShaderCompileMapWorkerOutput = 1;
+static FAutoConsoleVariableRef CVarShaderCompileMapWorkerOutput(
+	TEXT("r.ShaderCompiler.MapWorkerOutput"),
+	GShaderCompileMapWorkerOutput,
+	TEXT("When set to 1, the output files of the local shader compile workers are mapped in memory and deserialized in place instead of being read through a file archive.")
+);
+
+static int32 GShaderCompilePrioritizeRenderedMaterials = 1;
+static FAutoConsoleVariableRef CVarShaderCompilePrioritizeRenderedMaterials(
+	TEXT("r.ShaderCompiler.PrioritizeRenderedMaterials"),
+	GShaderCompilePrioritizeRenderedMaterials,
+	TEXT("When set to 1, the queued jobs of materials the renderer draws with a fallback while they compile are compiled before the other queued jobs.")
+);
+
 extern bool CompileShaderPipeline(const IShaderFormat* Compiler, FName Format, FShaderPipelineCompileJob* PipelineJob, const FString& Dir);
 
 #if ENABLE_COOK_STATS
@@ -992,6 +1031,46 @@ void FShaderCompileUtilities::DoReadTaskResults(const TArray<TSharedRef<FShaderC
 	}
 }
 
+int64 FShaderCompileUtilities::ReadTaskResultsFile(const TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>& QueuedJobs, const FString& OutputFileName)
+{
+	if (GShaderCompileMapWorkerOutput)
+	{
+		IMappedFileHandle* MappedHandle = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*OutputFileName);
+		if (MappedHandle)
+		{
+			// Empty files can't be mapped, read them through the archive which reports the error
+			IMappedFileRegion* MappedRegion = MappedHandle->GetFileSize() > 0 ? MappedHandle->MapRegion() : nullptr;
+			if (MappedRegion)
+			{
+				const int64 MappedSize = MappedRegion->GetMappedSize();
+				{
+					FLargeMemoryReader OutputFile(MappedRegion->GetMappedPtr(), MappedSize, ELargeMemoryReaderFlags::Persistent, FName(*OutputFileName));
+					DoReadTaskResults(QueuedJobs, OutputFile);
+				}
+
+				// The file can only be deleted once unmapped
+				delete MappedRegion;
+				delete MappedHandle;
+				return MappedSize;
+			}
+			delete MappedHandle;
+		}
+	}
+
+	FArchive* OutputFilePtr = IFileManager::Get().CreateFileReader(*OutputFileName, FILEREAD_Silent);
+	if (!OutputFilePtr)
+	{
+		return INDEX_NONE;
+	}
+
+	const int64 FileSize = OutputFilePtr->TotalSize();
+	DoReadTaskResults(QueuedJobs, *OutputFilePtr);
+
+	// Close the output file.
+	delete OutputFilePtr;
+	return FileSize;
+}
+
 static bool CheckSingleJob(FShaderCompileJob* SingleJob, const TArray<FMaterial*>& Materials, TArray<FString>& Errors)
 {
 	if (SingleJob->bSucceeded)
@@ -1088,6 +1167,324 @@ static void AddErrorsForFailedJob(FShaderCompileJob& CurrentJob, TArray<EShaderP
 	}
 }
 
+static const uint32 ShaderJobCacheMagic = 0x534A4348; // 'SJCH'
+
+static FName GetShaderJobFormat(const FShaderCompileJob& Job)
+{
+	return Job.Input.ShaderFormat != NAME_None ? Job.Input.ShaderFormat : LegacyShaderPlatformToShaderFormat(EShaderPlatform(Job.Input.Target.Platform));
+}
+
+/** Adds the hashes of the shader files included by generated shader source, returns false if one of them can't be loaded. */
+static bool HashGeneratedSourceIncludes(const FString& Source, EShaderPlatform Platform, FSHA1& HashState)
+{
+	static const TCHAR IncludeDirective[] = TEXT("#include");
+	const int32 IncludeDirectiveLen = UE_ARRAY_COUNT(IncludeDirective) - 1;
+
+	for (int32 SearchIndex = Source.Find(IncludeDirective, ESearchCase::CaseSensitive); SearchIndex != INDEX_NONE; SearchIndex = Source.Find(IncludeDirective, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchIndex + IncludeDirectiveLen))
+	{
+		int32 PathStart = SearchIndex + IncludeDirectiveLen;
+		while (PathStart < Source.Len() && (Source[PathStart] == TEXT(' ') || Source[PathStart] == TEXT('\t')))
+		{
+			PathStart++;
+		}
+		if (PathStart >= Source.Len() || Source[PathStart] != TEXT('"'))
+		{
+			continue;
+		}
+
+		const int32 PathEnd = Source.Find(TEXT("\""), ESearchCase::CaseSensitive, ESearchDir::FromStart, PathStart + 1);
+		if (PathEnd == INDEX_NONE)
+		{
+			return false;
+		}
+
+		// Generated files are hashed with the rest of the job input
+		const FString IncludePath = Source.Mid(PathStart + 1, PathEnd - PathStart - 1);
+		if (IncludePath.StartsWith(TEXT("/Engine/Generated/")))
+		{
+			continue;
+		}
+
+		FString IncludeSource;
+		if (!IncludePath.StartsWith(TEXT("/")) || !LoadShaderSourceFile(*IncludePath, Platform, &IncludeSource, nullptr))
+		{
+			return false;
+		}
+		HashState.Update(GetShaderFileHash(*IncludePath, Platform).Hash, sizeof(FSHAHash::Hash));
+	}
+
+	return true;
+}
+
+/**
+ * Hashes the shader files on disk a job includes, either directly or through generated source such as the material template.
+ * Must be called on the game thread, returns false if the job can't be stored in the local job cache.
+ */
+static bool GetShaderJobSourceHash(const FShaderCompileJob& Job, TMap<const FShaderCompilerEnvironment*, FSHAHash>& SharedEnvironmentHashes, FSHAHash& OutHash)
+{
+	const EShaderPlatform Platform = EShaderPlatform(Job.Input.Target.Platform);
+
+	FSHA1 HashState;
+	HashState.Update(GetShaderFileHash(*Job.Input.VirtualSourceFilePath, Platform).Hash, sizeof(FSHAHash::Hash));
+
+	for (const TPair<FString, FString>& Include : Job.Input.Environment.IncludeVirtualPathToContentsMap)
+	{
+		if (!HashGeneratedSourceIncludes(Include.Value, Platform, HashState))
+		{
+			return false;
+		}
+	}
+
+	if (IsValidRef(Job.Input.SharedEnvironment))
+	{
+		// Shared environments hold the generated material source and are shared by all the jobs of a material, only scan them once
+		const FShaderCompilerEnvironment* SharedEnvironment = Job.Input.SharedEnvironment.GetReference();
+		const FSHAHash* SharedEnvironmentHash = SharedEnvironmentHashes.Find(SharedEnvironment);
+		if (!SharedEnvironmentHash)
+		{
+			FSHA1 SharedHashState;
+			bool bSharedIncludesHashed = true;
+			for (const TPair<FString, FString>& Include : SharedEnvironment->IncludeVirtualPathToContentsMap)
+			{
+				bSharedIncludesHashed = bSharedIncludesHashed && HashGeneratedSourceIncludes(Include.Value, Platform, SharedHashState);
+			}
+			SharedHashState.Final();
+
+			FSHAHash NewSharedEnvironmentHash;
+			if (bSharedIncludesHashed)
+			{
+				SharedHashState.GetHash(NewSharedEnvironmentHash.Hash);
+			}
+			SharedEnvironmentHash = &SharedEnvironmentHashes.Add(SharedEnvironment, NewSharedEnvironmentHash);
+		}
+
+		if (*SharedEnvironmentHash == FSHAHash())
+		{
+			return false;
+		}
+		HashState.Update(SharedEnvironmentHash->Hash, sizeof(FSHAHash::Hash));
+	}
+
+	HashState.Final();
+	HashState.GetHash(OutHash.Hash);
+	return true;
+}
+
+/** Hashes everything the output of a single job depends on, returns false if the job has to be compiled on its own. */
+static bool GetShaderJobInputHash(const FShaderCompileJob& Job, FSHAHash& OutHash)
+{
+	// Jobs dumping debug info have to run to write it out
+	if (Job.Input.DumpDebugInfoPath.Len() > 0)
+	{
+		return false;
+	}
+
+	static ITargetPlatformManagerModule& TPM = GetTargetPlatformManagerRef();
+	const FName Format = GetShaderJobFormat(Job);
+	const IShaderFormat* Compiler = TPM.FindShaderFormat(Format);
+	if (!Compiler)
+	{
+		return false;
+	}
+
+	FShaderCompilerInput Input = Job.Input;
+	if (IsValidRef(Input.SharedEnvironment))
+	{
+		Input.Environment.Merge(*Input.SharedEnvironment);
+		Input.SharedEnvironment = nullptr;
+	}
+
+	// Debug names don't change the output, leave them out so that the same shader compiled for different materials is only compiled once
+	Input.DumpDebugInfoRootPath.Empty();
+	Input.DebugGroupName.Empty();
+	Input.DebugDescription.Empty();
+	Input.DebugExtension.Empty();
+
+	TArray<uint8> InputData;
+	FMemoryWriter Ar(InputData);
+
+	uint32 FormatVersion = Compiler->GetVersion(Format);
+	int32 OutputVersion = ShaderCompileWorkerOutputVersion;
+	FSHAHash SourceHash = Job.SourceHash;
+	Ar << FormatVersion;
+	Ar << OutputVersion;
+	Ar << SourceHash;
+	Ar << Input;
+
+	// External includes are not serialized with the input
+	for (const TPair<FString, FThreadSafeSharedStringPtr>& Include : Input.Environment.IncludeVirtualPathToExternalContentsMap)
+	{
+		FString IncludePath = Include.Key;
+		FString IncludeContents = Include.Value.IsValid() ? *Include.Value : FString();
+		Ar << IncludePath;
+		Ar << IncludeContents;
+	}
+
+	FSHA1::HashBuffer(InputData.GetData(), InputData.Num(), OutHash.Hash);
+	return true;
+}
+
+static const FString& GetShaderJobCacheDirectory()
+{
+	static const FString CacheDirectory = FPaths::ProjectSavedDir() / TEXT("ShaderJobCache");
+	return CacheDirectory;
+}
+
+static FString GetShaderJobCacheFilename(const FSHAHash& InputHash)
+{
+	const FString HashString = InputHash.ToString();
+	return GetShaderJobCacheDirectory() / HashString.Left(2) / HashString + TEXT(".bin");
+}
+
+/** Bytes written to the local job cache since it was last trimmed, starts saturated so that the first write of a session trims it. Only accessed by the compile thread. */
+static int64 GShaderJobCacheBytesWrittenSinceTrim = MAX_int64 / 2;
+
+/**
+ * Deletes the least recently used entries of the local job cache until it fits in three quarters of r.ShaderCompiler.LocalJobCacheMaxSizeMB,
+ * leaving room for a few writes before it needs to be trimmed again. Reading an entry refreshes its timestamp.
+ */
+static void TrimShaderJobCache(int64 MaxSize)
+{
+	struct FCacheEntry
+	{
+		FString Filename;
+		FDateTime Timestamp;
+		int64 Size;
+	};
+
+	TArray<FCacheEntry> Entries;
+	int64 TotalSize = 0;
+	IFileManager::Get().IterateDirectoryStatRecursively(*GetShaderJobCacheDirectory(), [&Entries, &TotalSize](const TCHAR* Filename, const FFileStatData& StatData)
+	{
+		if (!StatData.bIsDirectory && FPaths::GetExtension(Filename) == TEXT("bin"))
+		{
+			Entries.Add({ Filename, StatData.ModificationTime, StatData.FileSize });
+			TotalSize += StatData.FileSize;
+		}
+		return true;
+	});
+
+	if (TotalSize <= MaxSize)
+	{
+		return;
+	}
+
+	Entries.Sort([](const FCacheEntry& A, const FCacheEntry& B) { return A.Timestamp < B.Timestamp; });
+
+	const int64 TargetSize = MaxSize - MaxSize / 4;
+	int32 NumDeleted = 0;
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num() && TotalSize > TargetSize; EntryIndex++)
+	{
+		// Entries are replaced atomically, a failed delete means another editor is using it
+		if (IFileManager::Get().Delete(*Entries[EntryIndex].Filename, false, false, true))
+		{
+			TotalSize -= Entries[EntryIndex].Size;
+			NumDeleted++;
+		}
+	}
+
+	UE_LOG(LogShaderCompilers, Log, TEXT("Deleted %d least recently used shader job cache entries, %.1f MB remain in '%s'."), NumDeleted, TotalSize / (1024.0 * 1024.0), *GetShaderJobCacheDirectory());
+}
+
+/** Serializes the output of a compiled job along with a hash to validate it when reading it back. */
+static void SerializeShaderJobCacheEntry(const FShaderCompileJob& Job, TArray<uint8>& OutData)
+{
+	TArray<uint8> OutputData;
+	FMemoryWriter OutputAr(OutputData);
+	FShaderCompilerOutput Output = Job.Output;
+	OutputAr << Output;
+
+	FSHAHash OutputDataHash;
+	FSHA1::HashBuffer(OutputData.GetData(), OutputData.Num(), OutputDataHash.Hash);
+
+	FMemoryWriter Ar(OutData);
+	uint32 Magic = ShaderJobCacheMagic;
+	int32 OutputDataSize = OutputData.Num();
+	Ar << Magic;
+	Ar << OutputDataHash;
+	Ar << OutputDataSize;
+	Ar.Serialize(OutputData.GetData(), OutputData.Num());
+}
+
+static void WriteShaderJobCacheEntry(const FSHAHash& InputHash, const TArray<uint8>& Data)
+{
+	const FString Filename = GetShaderJobCacheFilename(InputHash);
+
+	// Write to a temporary file first so that other editors sharing the cache never read a partial entry
+	FGuid Guid;
+	FPlatformMisc::CreateGuid(Guid);
+	const FString TempFilename = Filename + TEXT(".") + Guid.ToString() + TEXT(".tmp");
+
+	if (!FFileHelper::SaveArrayToFile(Data, *TempFilename) || !IFileManager::Get().Move(*Filename, *TempFilename, true, true, false, true))
+	{
+		UE_LOG(LogShaderCompilers, Verbose, TEXT("Could not write the shader job cache entry '%s'."), *Filename);
+		IFileManager::Get().Delete(*TempFilename, false, true, true);
+		return;
+	}
+
+	const int64 MaxSize = (int64)GShaderCompileLocalJobCacheMaxSizeMB * 1024 * 1024;
+	GShaderJobCacheBytesWrittenSinceTrim += Data.Num();
+	if (MaxSize > 0 && GShaderJobCacheBytesWrittenSinceTrim >= MaxSize / 8)
+	{
+		GShaderJobCacheBytesWrittenSinceTrim = 0;
+		TrimShaderJobCache(MaxSize);
+	}
+}
+
+/** Completes the job with the output stored in the local job cache for its input hash, returns false if there is no valid entry. */
+static bool ReadShaderJobCacheEntry(FShaderCompileJob& Job)
+{
+	const FString Filename = GetShaderJobCacheFilename(Job.InputHash);
+	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*Filename))
+	{
+		return false;
+	}
+
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Filename, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Ar(Data);
+	uint32 Magic = 0;
+	FSHAHash OutputDataHash;
+	int32 OutputDataSize = 0;
+	Ar << Magic;
+	Ar << OutputDataHash;
+	Ar << OutputDataSize;
+	if (Ar.IsError() || Magic != ShaderJobCacheMagic || OutputDataSize != Ar.TotalSize() - Ar.Tell())
+	{
+		return false;
+	}
+
+	// Validate before deserializing, the entry may have been truncated or written by a different version of the output
+	FSHAHash DataHash;
+	FSHA1::HashBuffer(Data.GetData() + Ar.Tell(), OutputDataSize, DataHash.Hash);
+	if (DataHash != OutputDataHash)
+	{
+		UE_LOG(LogShaderCompilers, Warning, TEXT("Ignoring corrupted shader job cache entry '%s'."), *Filename);
+		return false;
+	}
+
+	FShaderCompilerOutput Output;
+	Ar << Output;
+	if (Ar.IsError() || !Output.bSucceeded)
+	{
+		return false;
+	}
+
+	// Mark the entry as recently used so that trimming the cache keeps it
+	IFileManager::Get().SetTimeStamp(*Filename, FDateTime::UtcNow());
+
+	check(!Job.bFinalized);
+	Job.bFinalized = true;
+	Job.Output = MoveTemp(Output);
+	Job.Output.GenerateOutputHash();
+	Job.bSucceeded = true;
+	return true;
+}
+
 /** Information tracked for each shader compile worker process instance. */
 struct FShaderCompileWorkerInfo
 {
@@ -1103,6 +1500,9 @@ struct FShaderCompileWorkerInfo
 	/** Tracks whether all tasks issued to the worker have been received. */
 	bool bComplete;
 
+	/** Tracks whether the queued jobs have been checked for duplicate and cached jobs. */
+	bool bResolvedDuplicateAndCachedJobs;
+
 	/** Time at which the worker started the most recent batch of tasks. */
 	double StartTime;
 
@@ -1113,6 +1513,7 @@ struct FShaderCompileWorkerInfo
 		bIssuedTasksToWorker(false),		
 		bLaunchedWorker(false),
 		bComplete(false),
+		bResolvedDuplicateAndCachedJobs(false),
 		StartTime(0)
 	{
 	}
@@ -1276,6 +1677,7 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 					// don't reset worker app ID, because the shadercompileworkers don't shutdown immediately after finishing a single job queue.
 					CurrentWorkerInfo.bIssuedTasksToWorker = false;					
 					CurrentWorkerInfo.bLaunchedWorker = false;
+					CurrentWorkerInfo.bResolvedDuplicateAndCachedJobs = false;
 					CurrentWorkerInfo.StartTime = FPlatformTime::Seconds();
 					NumActiveThreads++;
 					Manager->CompileQueue.RemoveAt(0, JobIndex);
@@ -1296,6 +1698,32 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 						FShaderMapCompileResults& ShaderMapResults = Manager->ShaderMapJobs.FindChecked(CurrentWorkerInfo.QueuedJobs[JobIndex]->Id);
 						ShaderMapResults.FinishedJobs.Add(CurrentWorkerInfo.QueuedJobs[JobIndex]);
 						ShaderMapResults.bAllJobsSucceeded = ShaderMapResults.bAllJobsSucceeded && CurrentWorkerInfo.QueuedJobs[JobIndex]->bSucceeded;
+						AddJobLatency(*CurrentWorkerInfo.QueuedJobs[JobIndex]);
+
+						// Complete the jobs that were waiting on this one, and keep the output to write it to the local job cache
+						const FShaderCompileJob* SingleJob = CurrentWorkerInfo.QueuedJobs[JobIndex]->GetSingleShaderJob();
+						const FInFlightJob* InFlightJob = SingleJob ? InFlightJobs.Find(SingleJob->InputHash) : nullptr;
+						if (InFlightJob && InFlightJob->Job == SingleJob)
+						{
+							for (const TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>& DuplicateJob : InFlightJob->DuplicateJobs)
+							{
+								FShaderCompileJob* DuplicateSingleJob = DuplicateJob->GetSingleShaderJob();
+								check(!DuplicateSingleJob->bFinalized);
+								DuplicateSingleJob->bFinalized = true;
+								DuplicateSingleJob->bSucceeded = SingleJob->bSucceeded;
+								DuplicateSingleJob->Output = SingleJob->Output;
+								ResolvedJobs.Add(DuplicateJob);
+							}
+
+							if (GShaderCompileLocalJobCache && SingleJob->bSucceeded && SingleJob->SourceHash != FSHAHash())
+							{
+								TPair<FSHAHash, TArray<uint8>>& JobCacheWrite = JobCacheWrites.AddDefaulted_GetRef();
+								JobCacheWrite.Key = SingleJob->InputHash;
+								SerializeShaderJobCacheEntry(*SingleJob, JobCacheWrite.Value);
+							}
+
+							InFlightJobs.Remove(SingleJob->InputHash);
+						}
 					}
 
 					const float ElapsedTime = FPlatformTime::Seconds() - CurrentWorkerInfo.StartTime;
@@ -1341,10 +1769,86 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 				}
 			}
 		}
+
+		// Add jobs completed from the local job cache or from a duplicate to the output queue
+		for (const TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>& ResolvedJob : ResolvedJobs)
+		{
+			FShaderMapCompileResults& ShaderMapResults = Manager->ShaderMapJobs.FindChecked(ResolvedJob->Id);
+			ShaderMapResults.FinishedJobs.Add(ResolvedJob);
+			ShaderMapResults.bAllJobsSucceeded = ShaderMapResults.bAllJobsSucceeded && ResolvedJob->bSucceeded;
+			AddJobLatency(*ResolvedJob);
+		}
+		FPlatformAtomics::InterlockedAdd(&Manager->NumOutstandingJobs, -ResolvedJobs.Num());
+		ResolvedJobs.Reset();
 	}
 	return NumActiveThreads;
 }
 
+void FShaderCompileThreadRunnable::AddJobLatency(const FShaderCommonCompileJob& Job)
+{
+	const double JobLatency = FPlatformTime::Seconds() - Job.QueuedTime;
+	WorkerStats.NumJobs++;
+	WorkerStats.TotalJobLatency += JobLatency;
+	WorkerStats.MaxJobLatency = FMath::Max(WorkerStats.MaxJobLatency, JobLatency);
+}
+
+void FShaderCompileThreadRunnable::ResolveDuplicateAndCachedJobs()
+{
+	// Done outside of the CompileQueueSection lock, the jobs are only referenced by this thread until they are added to Manager->ShaderMapJobs
+	for (const TPair<FSHAHash, TArray<uint8>>& JobCacheWrite : JobCacheWrites)
+	{
+		WriteShaderJobCacheEntry(JobCacheWrite.Key, JobCacheWrite.Value);
+	}
+	JobCacheWrites.Reset();
+
+	if (!GShaderCompileJobDeduplication && !GShaderCompileLocalJobCache)
+	{
+		return;
+	}
+
+	for (int32 WorkerIndex = 0; WorkerIndex < WorkerInfos.Num(); WorkerIndex++)
+	{
+		FShaderCompileWorkerInfo& CurrentWorkerInfo = *WorkerInfos[WorkerIndex];
+
+		// Only look at jobs just pulled from the queue
+		if (CurrentWorkerInfo.bResolvedDuplicateAndCachedJobs || CurrentWorkerInfo.bIssuedTasksToWorker || CurrentWorkerInfo.bComplete)
+		{
+			continue;
+		}
+		CurrentWorkerInfo.bResolvedDuplicateAndCachedJobs = true;
+
+		// Pipelines are compiled together with their stages and always go to the worker
+		for (int32 JobIndex = 0; JobIndex < CurrentWorkerInfo.QueuedJobs.Num();)
+		{
+			FShaderCompileJob* SingleJob = CurrentWorkerInfo.QueuedJobs[JobIndex]->GetSingleShaderJob();
+			if (SingleJob && GetShaderJobInputHash(*SingleJob, SingleJob->InputHash))
+			{
+				FInFlightJob* InFlightJob = InFlightJobs.Find(SingleJob->InputHash);
+				if (InFlightJob && GShaderCompileJobDeduplication)
+				{
+					InFlightJob->DuplicateJobs.Add(CurrentWorkerInfo.QueuedJobs[JobIndex]);
+					CurrentWorkerInfo.QueuedJobs.RemoveAt(JobIndex);
+					continue;
+				}
+
+				if (GShaderCompileLocalJobCache && SingleJob->SourceHash != FSHAHash() && ReadShaderJobCacheEntry(*SingleJob))
+				{
+					ResolvedJobs.Add(CurrentWorkerInfo.QueuedJobs[JobIndex]);
+					CurrentWorkerInfo.QueuedJobs.RemoveAt(JobIndex);
+					continue;
+				}
+
+				if (!InFlightJob)
+				{
+					FInFlightJob& NewInFlightJob = InFlightJobs.Add(SingleJob->InputHash);
+					NewInFlightJob.Job = SingleJob;
+				}
+			}
+			JobIndex++;
+		}
+	}
+}
+
 void FShaderCompileThreadRunnable::WriteNewTasks()
 {
 	for (int32 WorkerIndex = 0; WorkerIndex < WorkerInfos.Num(); WorkerIndex++)
@@ -1356,6 +1860,12 @@ void FShaderCompileThreadRunnable::WriteNewTasks()
 		{
 			CurrentWorkerInfo.bIssuedTasksToWorker = true;
 
+			// Serialize the tasks in memory first and write them with a single call, rather than through many small writes to the file
+			const double WriteStartTime = FPlatformTime::Seconds();
+			TArray<uint8> TransferData;
+			FMemoryWriter TransferWriter(TransferData, true);
+			const bool bSerializedTasks = FShaderCompileUtilities::DoWriteTasks(CurrentWorkerInfo.QueuedJobs, TransferWriter);
+
 			const FString WorkingDirectory = Manager->AbsoluteShaderBaseWorkingDirectory + FString::FromInt(WorkerIndex);
 
 			// To make sure that the process waiting for input file won't try to read it until it's ready
@@ -1395,7 +1905,8 @@ void FShaderCompileThreadRunnable::WriteNewTasks()
 			}
 			check(TransferFile);
 
-			if (!FShaderCompileUtilities::DoWriteTasks(CurrentWorkerInfo.QueuedJobs, *TransferFile))
+			TransferFile->Serialize(TransferData.GetData(), TransferData.Num());
+			if (!TransferFile->Close() || !bSerializedTasks)
 			{
 				uint64 TotalDiskSpace = 0;
 				uint64 FreeDiskSpace = 0;
@@ -1413,6 +1924,9 @@ void FShaderCompileThreadRunnable::WriteNewTasks()
 				FPlatformMisc::GetDiskTotalAndFreeSpace(TransferFileName, TotalDiskSpace, FreeDiskSpace);
 				UE_LOG(LogShaderCompilers, Error, TEXT("Could not rename the shader compiler transfer filename to '%s' from '%s' (Free Disk Space: %llu)."), *ProperTransferFileName, *TransferFileName, FreeDiskSpace);
 			}
+
+			WorkerStats.BytesWritten += TransferData.Num();
+			WorkerStats.WriteTime += FPlatformTime::Seconds() - WriteStartTime;
 		}
 	}
 }
@@ -1513,16 +2027,14 @@ void FShaderCompileThreadRunnable::ReadAvailableResults()
 			// This is only a win if FileExists is faster than CreateFileReader, which it is on Windows
 			if (FPlatformFileManager::Get().GetPlatformFile().FileExists(*OutputFileNameAndPath))
 			{
-				FArchive* OutputFilePtr = IFileManager::Get().CreateFileReader(*OutputFileNameAndPath, FILEREAD_Silent);
+				check(!CurrentWorkerInfo.bComplete);
+				const double ReadStartTime = FPlatformTime::Seconds();
+				const int64 OutputFileSize = FShaderCompileUtilities::ReadTaskResultsFile(CurrentWorkerInfo.QueuedJobs, OutputFileNameAndPath);
 
-				if (OutputFilePtr)
+				if (OutputFileSize != INDEX_NONE)
 				{
-					FArchive& OutputFile = *OutputFilePtr;
-					check(!CurrentWorkerInfo.bComplete);
-					FShaderCompileUtilities::DoReadTaskResults(CurrentWorkerInfo.QueuedJobs, OutputFile);
-
-					// Close the output file.
-					delete OutputFilePtr;
+					WorkerStats.BytesRead += OutputFileSize;
+					WorkerStats.ReadTime += FPlatformTime::Seconds() - ReadStartTime;
 
 					// Delete the output file now that we have consumed it, to avoid reading stale data on the next compile loop.
 					bool bDeletedOutput = IFileManager::Get().Delete(*OutputFileNameAndPath, true, true);
@@ -1641,6 +2153,19 @@ int32 FShaderCompileThreadRunnable::CompilingLoop()
 	// Grab more shader compile jobs from the input queue, and move completed jobs to Manager->ShaderMapJobs
 	const int32 NumActiveThreads = PullTasksFromQueue();
 
+	if (NumActiveThreads == 0 && WorkerStats.NumJobs > 0)
+	{
+		UE_LOG(LogShaderCompilers, Display, TEXT("Completed %d jobs, latency average %.3fs max %.3fs; wrote %.2f MB of worker input in %.3fs, read %.2f MB of worker output in %.3fs"),
+			WorkerStats.NumJobs,
+			WorkerStats.TotalJobLatency / WorkerStats.NumJobs,
+			WorkerStats.MaxJobLatency,
+			WorkerStats.BytesWritten / (1024.0 * 1024.0),
+			WorkerStats.WriteTime,
+			WorkerStats.BytesRead / (1024.0 * 1024.0),
+			WorkerStats.ReadTime);
+		WorkerStats = FWorkerStats();
+	}
+
 	if (NumActiveThreads == 0 && Manager->bAllowAsynchronousShaderCompiling)
 	{
 		// Yield while there's nothing to do
@@ -1649,6 +2174,9 @@ int32 FShaderCompileThreadRunnable::CompilingLoop()
 		FPlatformProcess::Sleep(.010f);
 	}
 
+	// Skip the jobs that are already being compiled or are in the local job cache
+	ResolveDuplicateAndCachedJobs();
+
 	if (Manager->bAllowCompilingThroughWorkers)
 	{
 		// Write out the files which are input to the shader compile workers
@@ -1947,6 +2475,7 @@ FShaderCompilingManager::FShaderCompilingManager() :
 	bCompilingDuringGame(false),
 	NumOutstandingJobs(0),
 	NumExternalJobs(0),
+	LastPrioritizeRenderingFallbackMaterialsTime(0.0),
 	NumSingleThreadedRunsBeforeRetry(GSingleThreadedRunsIdle),
 #if PLATFORM_MAC
 	ShaderCompileWorkerName(FPaths::EngineDir() / TEXT("Binaries/Mac/ShaderCompileWorker")),
@@ -2200,6 +2729,21 @@ bool FShaderCompilingManager::ShouldRecompileToDumpShaderDebugInfo(const FShader
 void FShaderCompilingManager::AddJobs(TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>& NewJobs, bool bOptimizeForLowLatency, bool bRecreateComponentRenderStateOnCompletion, const FString MaterialBasePath, const FString PermutationString, bool bSkipResultProcessing)
 {
 	check(!FPlatformProperties::RequiresCookedData());
+
+	if (GShaderCompileLocalJobCache && IsInGameThread())
+	{
+		// Shader file hashes can only be read on the game thread, the rest of the input is hashed by the compile thread
+		TMap<const FShaderCompilerEnvironment*, FSHAHash> SharedEnvironmentHashes;
+		for (int32 JobIndex = 0; JobIndex < NewJobs.Num(); JobIndex++)
+		{
+			FShaderCompileJob* SingleJob = NewJobs[JobIndex]->GetSingleShaderJob();
+			if (SingleJob && !GetShaderJobSourceHash(*SingleJob, SharedEnvironmentHashes, SingleJob->SourceHash))
+			{
+				SingleJob->SourceHash = FSHAHash();
+			}
+		}
+	}
+
 	// Lock CompileQueueSection so we can access the input and output queues
 	FScopeLock Lock(&CompileQueueSection);
 
@@ -2247,9 +2791,11 @@ void FShaderCompilingManager::AddJobs(TArray<TSharedRef<FShaderCommonCompileJob,
 	// Using atomics to update NumOutstandingJobs since it is read outside of the critical section
 	FPlatformAtomics::InterlockedAdd(&NumOutstandingJobs, NewJobs.Num());
 
+	const double QueuedTime = FPlatformTime::Seconds();
 	for (int32 JobIndex = 0; JobIndex < NewJobs.Num(); JobIndex++)
 	{
 		NewJobs[JobIndex]->bOptimizeForLowLatency = bOptimizeForLowLatency;
+		NewJobs[JobIndex]->QueuedTime = QueuedTime;
 		FShaderMapCompileResults& ShaderMapInfo = ShaderMapJobs.FindOrAdd(NewJobs[JobIndex]->Id);
 		ShaderMapInfo.bRecreateComponentRenderStateOnCompletion = bRecreateComponentRenderStateOnCompletion;
 		ShaderMapInfo.bSkipResultProcessing = bSkipResultProcessing;
@@ -3040,6 +3586,96 @@ bool FShaderCompilingManager::HandlePotentialRetryOnError(TMap<int32, FShaderMap
 	return bRetryCompile;
 }
 
+void FShaderCompilingManager::NotifyMaterialNeededForRendering(const FMaterial* Material)
+{
+	if (GShaderCompilePrioritizeRenderedMaterials)
+	{
+		// Fallbacks are drawn for every mesh batch using the material, only queue it the first time in a frame.
+		// The plain read avoids writing to the material's cache line once it has been reported.
+		const int32 FrameNumber = (int32)GFrameNumberRenderThread;
+		if (Material->LastFrameNeededForRendering != FrameNumber
+			&& FPlatformAtomics::InterlockedExchange(&Material->LastFrameNeededForRendering, FrameNumber) != FrameNumber)
+		{
+			RenderingFallbackMaterials.Push(Material);
+		}
+	}
+}
+
+void FShaderCompilingManager::PrioritizeRenderingFallbackMaterials()
+{
+	check(IsInGameThread());
+
+	// Drain on every call so the lock free list only ever holds a few frames worth of reports
+	TArray<const FMaterial*> ReportedMaterials;
+	RenderingFallbackMaterials.PopAll(ReportedMaterials);
+	PendingRenderingFallbackMaterials.Append(ReportedMaterials);
+
+	// The rendering thread keeps reporting the materials every frame until they are compiled, no need to reorder the queue that often
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime - LastPrioritizeRenderingFallbackMaterialsTime < 0.5)
+	{
+		return;
+	}
+	LastPrioritizeRenderingFallbackMaterialsTime = CurrentTime;
+
+	TSet<const FMaterial*> FallbackMaterials = MoveTemp(PendingRenderingFallbackMaterials);
+	PendingRenderingFallbackMaterials.Reset();
+
+	// Only compare the pointers, the materials may have been deleted since the rendering thread used them
+	TSet<int32> PrioritizedShaderMapIds;
+	if (FallbackMaterials.Num() > 0)
+	{
+		for (TMap<TRefCountPtr<FMaterialShaderMap>, TArray<FMaterial*> >::TConstIterator ShaderMapIt(FMaterialShaderMap::ShaderMapsBeingCompiled); ShaderMapIt; ++ShaderMapIt)
+		{
+			for (const FMaterial* Material : ShaderMapIt.Value())
+			{
+				if (FallbackMaterials.Contains(Material))
+				{
+					PrioritizedShaderMapIds.Add(ShaderMapIt.Key()->GetCompilingId());
+					break;
+				}
+			}
+		}
+	}
+
+	if (PrioritizedShaderMapIds.Num() == 0)
+	{
+		return;
+	}
+
+	// Lock CompileQueueSection so we can access the input queue
+	FScopeLock Lock(&CompileQueueSection);
+
+	// Keep the low latency jobs first, and the jobs of each shader map in order
+	int32 FirstNormalJobIndex = 0;
+	while (FirstNormalJobIndex < CompileQueue.Num() && CompileQueue[FirstNormalJobIndex]->bOptimizeForLowLatency)
+	{
+		FirstNormalJobIndex++;
+	}
+
+	TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>> PrioritizedJobs;
+	TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>> OtherJobs;
+	OtherJobs.Reserve(CompileQueue.Num() - FirstNormalJobIndex);
+	for (int32 JobIndex = FirstNormalJobIndex; JobIndex < CompileQueue.Num(); JobIndex++)
+	{
+		if (PrioritizedShaderMapIds.Contains(CompileQueue[JobIndex]->Id))
+		{
+			PrioritizedJobs.Add(CompileQueue[JobIndex]);
+		}
+		else
+		{
+			OtherJobs.Add(CompileQueue[JobIndex]);
+		}
+	}
+
+	if (PrioritizedJobs.Num() > 0 && OtherJobs.Num() > 0)
+	{
+		CompileQueue.RemoveAt(FirstNormalJobIndex, CompileQueue.Num() - FirstNormalJobIndex, false);
+		CompileQueue.Append(MoveTemp(PrioritizedJobs));
+		CompileQueue.Append(MoveTemp(OtherJobs));
+	}
+}
+
 void FShaderCompilingManager::CancelCompilation(const TCHAR* MaterialName, const TArray<int32>& ShaderMapIdsToCancel)
 {
 	check(IsInGameThread());
@@ -3197,6 +3833,9 @@ void FShaderCompilingManager::ProcessAsyncResults(bool bLimitExecutionTime, bool
 				BuildDistributionController->Tick(0.0f);
 			}
 			
+			// Compile the materials that are drawn with a fallback first
+			PrioritizeRenderingFallbackMaterials();
+
 			// Block on global shaders before checking for shader maps to finalize
 			// So if we block on global shaders for a long time, we will get a chance to finalize all the non-global shader maps completed during that time.
 			if (bBlockOnGlobalShaderCompletion)
@@ -11,4 +11,4 @@
 // In case of merge conflicts with DDC versions, you MUST generate a new GUID and set this new
 // guid as version
 #define GLOBALSHADERMAP_DERIVEDDATA_VER			TEXT("8C01E9655F2D469DB664C8E826EBA0BD")
-#define MATERIALSHADERMAP_DERIVEDDATA_VER		TEXT("01BF92A5B29A44BE8A839E4251DA49D7")
+#define MATERIALSHADERMAP_DERIVEDDATA_VER		TEXT("7E85092BBD6B429BB3F0F62D698345D5")
@@ -251,22 +251,6 @@ void FConcurrencyGroup::UpdateGeneration(FActiveSound* NewActiveSound)
 		{
 			switch(ScaleMode)
 			{
-				case EConcurrencyVolumeScaleMode::Distance:
-				{
-					float DistSqA = 0.0f;
-					float DistSqB = 0.0f;
-					A.AudioDevice->GetDistanceSquaredToNearestListener(A.LastLocation, DistSqA);
-					B.AudioDevice->GetDistanceSquaredToNearestListener(B.LastLocation, DistSqB);
-
-					// If sounds share the same distance, newer sounds will be sorted first to avoid volume ping-ponging 
-					if (FMath::IsNearlyEqual(DistSqA, DistSqB, KINDA_SMALL_NUMBER))
-					{
-						return A.GetPlayOrder() < B.GetPlayOrder();
-					}
-
-					return DistSqA > DistSqB;
-				}
-
 				case EConcurrencyVolumeScaleMode::Priority:
 				{
 					// Ensures sounds set to always play are sorted above those that aren't, but are sorted appropriately between one another
@@ -287,7 +271,44 @@ void FConcurrencyGroup::UpdateGeneration(FActiveSound* NewActiveSound)
 		}
 	};
 
-	ActiveSounds.Sort(FCompareActiveSounds(Settings.VolumeScaleMode));
+	// Distances are evaluated once per sound prior to sorting rather than per comparison,
+	// as finding the nearest listener requires testing the sound against every listener.
+	struct FCompareActiveSoundsByDistance
+	{
+		FORCEINLINE bool operator()(const TPair<float, FActiveSound*>& A, const TPair<float, FActiveSound*>& B) const
+		{
+			// If sounds share the same distance, newer sounds will be sorted first to avoid volume ping-ponging 
+			if (FMath::IsNearlyEqual(A.Key, B.Key, KINDA_SMALL_NUMBER))
+			{
+				return A.Value->GetPlayOrder() < B.Value->GetPlayOrder();
+			}
+
+			return A.Key > B.Key;
+		}
+	};
+
+	if (Settings.VolumeScaleMode == EConcurrencyVolumeScaleMode::Distance)
+	{
+		TArray<TPair<float, FActiveSound*>> SoundsByDistance;
+		SoundsByDistance.Reserve(ActiveSounds.Num());
+		for (FActiveSound* ActiveSound : ActiveSounds)
+		{
+			float DistSq = 0.0f;
+			ActiveSound->AudioDevice->GetDistanceSquaredToNearestListener(ActiveSound->LastLocation, DistSq);
+			SoundsByDistance.Emplace(DistSq, ActiveSound);
+		}
+
+		SoundsByDistance.Sort(FCompareActiveSoundsByDistance());
+
+		for (int32 i = 0; i < SoundsByDistance.Num(); ++i)
+		{
+			ActiveSounds[i] = SoundsByDistance[i].Value;
+		}
+	}
+	else
+	{
+		ActiveSounds.Sort(FCompareActiveSounds(Settings.VolumeScaleMode));
+	}
 
 	for (int32 i = 0; i < ActiveSounds.Num(); ++i)
 	{
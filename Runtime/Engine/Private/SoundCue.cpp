@@ -103,6 +103,22 @@ void USoundCue::CacheAggregateValues()
 	}
 }
 
+void USoundCue::CacheNodeLayout()
+{
+	check(IsInGameThread());
+
+	// Active sounds keep the layout they started with, so a new one is built rather than modifying the current one
+	NodeLayout.Reset();
+	if (FirstNode)
+	{
+		TSharedRef<FSoundCueNodeLayout, ESPMode::ThreadSafe> NewLayout = MakeShared<FSoundCueNodeLayout, ESPMode::ThreadSafe>();
+		if (RecursiveAddToNodeLayout(FirstNode, (UPTRINT)FirstNode, *NewLayout))
+		{
+			NodeLayout = NewLayout;
+		}
+	}
+}
+
 void USoundCue::PrimeSoundCue()
 {
 	if (FirstNode != nullptr)
@@ -231,6 +247,7 @@ void USoundCue::PostLoad()
 	}
 
 	CacheAggregateValues();
+	CacheNodeLayout();
 	
 	ESoundWaveLoadingBehavior SoundClassLoadingBehavior = ESoundWaveLoadingBehavior::Inherited;
 
@@ -403,6 +420,7 @@ void USoundCue::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyCha
 	}
 
 	CacheAggregateValues();
+	CacheNodeLayout();
 }
 #endif // WITH_EDITOR
 
@@ -450,6 +468,32 @@ bool USoundCue::RecursiveFindPathToNode(USoundNode* CurrentNode, const UPTRINT C
 	return false;
 }
 
+bool USoundCue::RecursiveAddToNodeLayout(USoundNode* CurrentNode, const UPTRINT CurrentHash, FSoundCueNodeLayout& OutLayout) const
+{
+	// Nodes shared by several parents are laid out once per path, give up on graphs where that explodes and let their active sounds use the offset map
+	static const int32 MaxNodeLayoutSize = 4096;
+	if (OutLayout.NodeWaveInstanceHashes.Num() >= MaxNodeLayoutSize)
+	{
+		return false;
+	}
+
+	if (!OutLayout.NodeIndices.Contains(CurrentHash))
+	{
+		OutLayout.NodeIndices.Add(CurrentHash, OutLayout.NodeWaveInstanceHashes.Add(CurrentHash));
+	}
+
+	for (int32 ChildIndex = 0; ChildIndex < CurrentNode->ChildNodes.Num(); ++ChildIndex)
+	{
+		USoundNode* ChildNode = CurrentNode->ChildNodes[ChildIndex];
+		if (ChildNode && !RecursiveAddToNodeLayout(ChildNode, USoundNode::GetNodeWaveInstanceHash(CurrentHash, ChildNode, ChildIndex), OutLayout))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool USoundCue::FindPathToNode(const UPTRINT NodeHashToFind, TArray<USoundNode*>& OutPath) const
 {
 	return RecursiveFindPathToNode(FirstNode, (UPTRINT)FirstNode, NodeHashToFind, OutPath);
@@ -623,6 +667,7 @@ void USoundCue::Parse(FAudioDevice* AudioDevice, const UPTRINT NodeWaveInstanceH
 {
 	if (FirstNode)
 	{
+		ActiveSound.BeginSoundNodeParse();
 		FirstNode->ParseNodes(AudioDevice, (UPTRINT)FirstNode, ActiveSound, ParseParams, WaveInstances);
 	}
 }
@@ -745,11 +790,13 @@ void USoundCue::LinkGraphNodesFromSoundNodes()
 {
 	USoundCue::GetSoundCueAudioEditor()->LinkGraphNodesFromSoundNodes(this);
 	CacheAggregateValues();
+	CacheNodeLayout();
 }
 
 void USoundCue::CompileSoundNodesFromGraphNodes()
 {
 	USoundCue::GetSoundCueAudioEditor()->CompileSoundNodesFromGraphNodes(this);
+	CacheNodeLayout();
 }
 
 void USoundCue::SetSoundCueAudioEditor(TSharedPtr<ISoundCueAudioEditor> InSoundCueAudioEditor)
@@ -20,6 +20,22 @@ static FAutoConsoleVariableRef CVarStreamableDelegateDelayFrames(
 	ECVF_Default
 );
 
+static float GStreamableDelegateTimeBudgetMs = 0.0f;
+static FAutoConsoleVariableRef CVarStreamableDelegateTimeBudgetMs(
+	TEXT("s.StreamableDelegateTimeBudgetMs"),
+	GStreamableDelegateTimeBudgetMs,
+	TEXT("Time in milliseconds delayed StreamableManager delegates may take each frame, the remaining ones are called on the next frames. 0 to call them all"),
+	ECVF_Default
+);
+
+DECLARE_STATS_GROUP(TEXT("Streamable Manager"), STATGROUP_StreamableManager, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Call Delayed Delegates"), STAT_StreamableCallDelegates, STATGROUP_StreamableManager);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Package Requests"), STAT_StreamablePendingPackageRequests, STATGROUP_StreamableManager);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Delegates"), STAT_StreamablePendingDelegates, STATGROUP_StreamableManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Delegates Called"), STAT_StreamableDelegatesCalled, STATGROUP_StreamableManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Handles Completed"), STAT_StreamableHandlesCompleted, STATGROUP_StreamableManager);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Completed Handles Latency (ms)"), STAT_StreamableHandlesLatency, STATGROUP_StreamableManager);
+
 /** Helper class that defers streamable manager delegates until the next frame */
 class FStreamableDelegateDelayHelper : public FTickableGameObject
 {
@@ -36,6 +52,8 @@ public:
 			FPendingDelegateList& DelegatesForHandle = PendingDelegatesByHandle.FindOrAdd(AssociatedHandle);
 			FPendingDelegateList::AddTail(PendingDelegate, PendingDelegates, DelegatesForHandle);
 		}
+
+		INC_DWORD_STAT(STAT_StreamablePendingDelegates);
 	}
 
 	/** Cancels delegate for handle, this will either delete the delegate or replace with the cancel delegate */
@@ -90,6 +108,7 @@ public:
 		{
 			FPendingDelegate* NextNodeToDelete = NodeToDelete->Next;
 			delete NodeToDelete;
+			DEC_DWORD_STAT(STAT_StreamablePendingDelegates);
 			NodeToDelete = NextNodeToDelete;
 		}
 	}
@@ -99,19 +118,51 @@ public:
 	{
 		while (PendingDelegates.Head)
 		{
-			Tick(0.0f);
+			CallDelegates(false);
 		}
 	}
 
 	// FTickableGameObject interface
 
 	void Tick(float DeltaTime) override
+	{
+		CallDelegates(true);
+	}
+
+	virtual ETickableTickType GetTickableTickType() const override
+	{
+		return ETickableTickType::Always;
+	}
+
+	virtual bool IsTickableWhenPaused() const override
+	{
+		return true;
+	}
+
+	virtual bool IsTickableInEditor() const
+	{
+		return true;
+	}
+
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FStreamableDelegateDelayHelper, STATGROUP_Tickables);
+	}
+
+private:
+
+	struct FPendingDelegate;
+
+	/** Calls the delegates whose delay is up, within the frame time budget if bUseTimeBudget */
+	void CallDelegates(bool bUseTimeBudget)
 	{
 		if (!PendingDelegates.Head)
 		{
 			return;
 		}
 
+		SCOPE_CYCLE_COUNTER(STAT_StreamableCallDelegates);
+
 		FPendingDelegateList DelegatesToCall;
 		{
 			FScopeLock Lock(&DataLock);
@@ -144,38 +195,46 @@ public:
 			}
 		}
 
+		const double EndTime = bUseTimeBudget && GStreamableDelegateTimeBudgetMs > 0.0f ? FPlatformTime::Seconds() + GStreamableDelegateTimeBudgetMs / 1000.0 : 0.0;
+
 		FPendingDelegate* DelegateToCall = DelegatesToCall.Head;
 		while (DelegateToCall)
 		{
 			FPendingDelegate* NextDelegateToCall = DelegateToCall->Next;
 			DelegateToCall->Delegate.ExecuteIfBound();
 			delete DelegateToCall;
+			DEC_DWORD_STAT(STAT_StreamablePendingDelegates);
+			INC_DWORD_STAT(STAT_StreamableDelegatesCalled);
 			DelegateToCall = NextDelegateToCall;
-		}
-	}
 
-	virtual ETickableTickType GetTickableTickType() const override
-	{
-		return ETickableTickType::Always;
+			if (DelegateToCall && EndTime > 0.0 && FPlatformTime::Seconds() > EndTime)
+			{
+				// Out of time, call the remaining ones first next frame
+				RequeueDelegates(DelegateToCall);
+				break;
+			}
+		}
 	}
 
-	virtual bool IsTickableWhenPaused() const override
+	/** Puts delegates that were due but not called back at the head of the pending list, in the same order */
+	void RequeueDelegates(FPendingDelegate* FirstDelegate)
 	{
-		return true;
-	}
+		TArray<FPendingDelegate*, TInlineAllocator<64>> DelegatesToRequeue;
+		for (FPendingDelegate* CurrentNode = FirstDelegate; CurrentNode; CurrentNode = CurrentNode->Next)
+		{
+			DelegatesToRequeue.Add(CurrentNode);
+		}
 
-	virtual bool IsTickableInEditor() const
-	{
-		return true;
-	}
+		FScopeLock Lock(&DataLock);
 
-	virtual TStatId GetStatId() const override
-	{
-		RETURN_QUICK_DECLARE_CYCLE_STAT(FStreamableDelegateDelayHelper, STATGROUP_Tickables);
+		for (int32 Index = DelegatesToRequeue.Num() - 1; Index >= 0; --Index)
+		{
+			FPendingDelegate* PendingDelegate = DelegatesToRequeue[Index];
+			FPendingDelegateList& DelegatesForHandle = PendingDelegatesByHandle.FindOrAdd(PendingDelegate->RelatedHandle);
+			FPendingDelegateList::AddHead(PendingDelegate, PendingDelegates, DelegatesForHandle);
+		}
 	}
 
-private:
-
 	struct FPendingDelegate
 	{
 		FPendingDelegate* Prev;
@@ -253,6 +312,33 @@ private:
 
 		}
 
+		static void AddHead(FPendingDelegate* PendingDelegate, FPendingDelegateList& PendingDelegates, FPendingDelegateList& PendingDelegatesByHandle)
+		{
+			PendingDelegate->Prev = nullptr;
+			PendingDelegate->Next = PendingDelegates.Head;
+			if (PendingDelegates.Head)
+			{
+				PendingDelegates.Head->Prev = PendingDelegate;
+			}
+			else
+			{
+				PendingDelegates.Tail = PendingDelegate;
+			}
+			PendingDelegates.Head = PendingDelegate;
+
+			PendingDelegate->PrevByHandle = nullptr;
+			PendingDelegate->NextByHandle = PendingDelegatesByHandle.Head;
+			if (PendingDelegatesByHandle.Head)
+			{
+				PendingDelegatesByHandle.Head->PrevByHandle = PendingDelegate;
+			}
+			else
+			{
+				PendingDelegatesByHandle.Tail = PendingDelegate;
+			}
+			PendingDelegatesByHandle.Head = PendingDelegate;
+		}
+
 		static void AddTail(FPendingDelegate* PendingDelegate, FPendingDelegateList& PendingDelegates, FPendingDelegateList& PendingDelegatesByHandle)
 		{
 			if (PendingDelegates.Tail)
@@ -650,6 +736,9 @@ FStreamableHandle::~FStreamableHandle()
 		
 		// The weak pointers in FStreamable will be nulled, but they're fixed on next GC, and actively canceling is not safe as we're halfway destroyed
 	}
+
+	// Package requests bound to this handle won't call back anymore
+	DEC_DWORD_STAT_BY(STAT_StreamablePendingPackageRequests, PendingPackageRequests);
 }
 
 void FStreamableHandle::CompleteLoad()
@@ -659,6 +748,12 @@ void FStreamableHandle::CompleteLoad()
 	{
 		bLoadCompleted = true;
 
+		if (RequestStartTime > 0.0)
+		{
+			INC_DWORD_STAT(STAT_StreamableHandlesCompleted);
+			INC_FLOAT_STAT_BY(STAT_StreamableHandlesLatency, (float)((FPlatformTime::Seconds() - RequestStartTime) * 1000.0));
+		}
+
 		ExecuteDelegate(CompleteDelegate, AsShared(), CancelDelegate);
 		UnbindDelegates();
 
@@ -797,14 +892,17 @@ void FStreamableHandle::UnbindDelegates()
 	CompleteDelegate.Unbind();
 }
 
-void FStreamableHandle::AsyncLoadCallbackWrapper(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result, FSoftObjectPath TargetName)
+void FStreamableHandle::AsyncLoadCallbackWrapper(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result, TArray<FSoftObjectPath> TargetNames)
 {
 	check(IsInGameThread());
 
+	--PendingPackageRequests;
+	DEC_DWORD_STAT(STAT_StreamablePendingPackageRequests);
+
 	// Needed so we can bind with a shared pointer for safety
 	if (OwningManager)
 	{
-		OwningManager->AsyncLoadCallback(TargetName);
+		OwningManager->AsyncLoadCallback(TargetNames);
 
 		if (!HasLoadCompleted())
 		{
@@ -1047,7 +1145,7 @@ FStreamable* FStreamableManager::FindStreamable(const FSoftObjectPath& Target) c
 	return Existing;
 }
 
-FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetName, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle)
+FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetName, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle, TPackagesToLoad& OutPackagesToLoad)
 {
 	check(IsInGameThread());
 	UE_LOG(LogStreamableManager, Verbose, TEXT("Asynchronous load %s"), *InTargetName.ToString());
@@ -1114,7 +1212,7 @@ FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetN
 		}
 		else
 		{
-			// We always queue a new request in case the existing one gets cancelled
+			// We always queue a new request in case the existing one gets cancelled, the caller issues a single one per package for all targets of the handle
 			FString Package = TargetName.ToString();
 			int32 FirstDot = Package.Find(TEXT("."), ESearchCase::CaseSensitive);
 			if (FirstDot != INDEX_NONE)
@@ -1124,7 +1222,7 @@ FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetN
 
 			Existing->bAsyncLoadRequestOutstanding = true;
 			Existing->bLoadFailed = false;
-			int32 RequestId = LoadPackageAsync(Package, FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadCallbackWrapper, TargetName), Priority);
+			OutPackagesToLoad.FindOrAdd(MoveTemp(Package)).Add(TargetName);
 		}
 	}
 	return Existing;
@@ -1281,12 +1379,15 @@ void FStreamableManager::StartHandleRequests(TSharedRef<FStreamableHandle> Handl
 {
 	TRACE_LOADTIME_REQUEST_GROUP_SCOPE(TEXT("StreamableManager - %s"), *Handle->GetDebugName());
 
+	Handle->RequestStartTime = FPlatformTime::Seconds();
+
 	TArray<FStreamable *> ExistingStreamables;
 	ExistingStreamables.Reserve(Handle->RequestedAssets.Num());
 
+	TPackagesToLoad PackagesToLoad;
 	for (int32 i = 0; i < Handle->RequestedAssets.Num(); i++)
 	{
-		FStreamable* Existing = StreamInternal(Handle->RequestedAssets[i], Handle->Priority, Handle);
+		FStreamable* Existing = StreamInternal(Handle->RequestedAssets[i], Handle->Priority, Handle, PackagesToLoad);
 		check(Existing);
 
 		ExistingStreamables.Add(Existing);
@@ -1294,6 +1395,7 @@ void FStreamableManager::StartHandleRequests(TSharedRef<FStreamableHandle> Handl
 	}
 
 	// Go through and complete loading anything that's already in memory, this may call the callback right away
+	FCompletedRequests CompletedRequests;
 	for (int32 i = 0; i < Handle->RequestedAssets.Num(); i++)
 	{
 		FStreamable* Existing = ExistingStreamables[i];
@@ -1302,9 +1404,18 @@ void FStreamableManager::StartHandleRequests(TSharedRef<FStreamableHandle> Handl
 		{
 			Existing->bAsyncLoadRequestOutstanding = false;
 
-			CheckCompletedRequests(Handle->RequestedAssets[i], Existing);
+			CheckCompletedRequests(Handle->RequestedAssets[i], Existing, CompletedRequests);
 		}
 	}
+	CompleteRequests(CompletedRequests);
+
+	// Request each package once, its callback checks all the targets of the handle in that package
+	for (TPair<FString, TArray<FSoftObjectPath>>& PackageToLoad : PackagesToLoad)
+	{
+		++Handle->PendingPackageRequests;
+		INC_DWORD_STAT(STAT_StreamablePendingPackageRequests);
+		LoadPackageAsync(PackageToLoad.Key, FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadCallbackWrapper, MoveTemp(PackageToLoad.Value)), Handle->Priority);
+	}
 }
 
 UObject* FStreamableManager::LoadSynchronous(const FSoftObjectPath& Target, bool bManageActiveHandle, TSharedPtr<FStreamableHandle>* RequestHandlePointer)
@@ -1358,58 +1469,55 @@ void FStreamableManager::FindInMemory( FSoftObjectPath& InOutTargetName, struct
 	}
 }
 
-void FStreamableManager::AsyncLoadCallback(FSoftObjectPath TargetName)
+void FStreamableManager::AsyncLoadCallback(const TArray<FSoftObjectPath>& Requests)
 {
 	check(IsInGameThread());
 
-	FStreamable* Existing = FindStreamable(TargetName);
-
-	UE_LOG(LogStreamableManager, Verbose, TEXT("Stream Complete callback %s"), *TargetName.ToString());
-	if (Existing)
+	// Check every target of the package before completing any handle, so that handles waiting on several of them complete once
+	FCompletedRequests CompletedRequests;
+	for (const FSoftObjectPath& TargetName : Requests)
 	{
-		if (Existing->bAsyncLoadRequestOutstanding)
+		FStreamable* Existing = FindStreamable(TargetName);
+
+		UE_LOG(LogStreamableManager, Verbose, TEXT("Stream Complete callback %s"), *TargetName.ToString());
+		if (Existing)
 		{
-			Existing->bAsyncLoadRequestOutstanding = false;
-			if (!Existing->Target)
+			if (Existing->bAsyncLoadRequestOutstanding)
 			{
-				FindInMemory(TargetName, Existing);
-			}
+				Existing->bAsyncLoadRequestOutstanding = false;
+				if (!Existing->Target)
+				{
+					FindInMemory(TargetName, Existing);
+				}
 
-			CheckCompletedRequests(TargetName, Existing);
-		}
-		else
-		{
-			UE_LOG(LogStreamableManager, Verbose, TEXT("AsyncLoadCallback called for %s when not waiting on a load request, was loaded early by sync load"), *TargetName.ToString());
-		}
-		if (Existing->Target)
-		{
-			UE_LOG(LogStreamableManager, Verbose, TEXT("    Found target %s"), *Existing->Target->GetFullName());
+				CheckCompletedRequests(TargetName, Existing, CompletedRequests);
+			}
+			else
+			{
+				UE_LOG(LogStreamableManager, Verbose, TEXT("AsyncLoadCallback called for %s when not waiting on a load request, was loaded early by sync load"), *TargetName.ToString());
+			}
+			if (Existing->Target)
+			{
+				UE_LOG(LogStreamableManager, Verbose, TEXT("    Found target %s"), *Existing->Target->GetFullName());
+			}
+			else
+			{
+				// Async load failed to find the object
+				Existing->bLoadFailed = true;
+				UE_LOG(LogStreamableManager, Verbose, TEXT("    Failed async load."), *TargetName.ToString());
+			}
 		}
 		else
 		{
-			// Async load failed to find the object
-			Existing->bLoadFailed = true;
-			UE_LOG(LogStreamableManager, Verbose, TEXT("    Failed async load."), *TargetName.ToString());
+			UE_LOG(LogStreamableManager, Error, TEXT("Can't find streamable for %s in AsyncLoadCallback!"), *TargetName.ToString());
 		}
 	}
-	else
-	{
-		UE_LOG(LogStreamableManager, Error, TEXT("Can't find streamable for %s in AsyncLoadCallback!"), *TargetName.ToString());
-	}
+
+	CompleteRequests(CompletedRequests);
 }
 
-void FStreamableManager::CheckCompletedRequests(const FSoftObjectPath& Target, struct FStreamable* Existing)
+void FStreamableManager::CheckCompletedRequests(const FSoftObjectPath& Target, struct FStreamable* Existing, FCompletedRequests& OutCompletedRequests)
 {
-	static int32 RecursiveCount = 0;
-
-	ensure(RecursiveCount == 0);
-
-	RecursiveCount++;
-
-	// Release these handles at end
-	TArray<TSharedRef<FStreamableHandle>> HandlesToComplete;
-	TArray<TSharedRef<FStreamableHandle>> HandlesToRelease;
-
 	for (TSharedRef<FStreamableHandle>& Handle : Existing->LoadingHandles)
 	{
 		ensure(Handle->WasCanceled() || Handle->OwningManager == this);
@@ -1420,25 +1528,34 @@ void FStreamableManager::CheckCompletedRequests(const FSoftObjectPath& Target, s
 		{
 			if (Handle->bReleaseWhenLoaded)
 			{
-				HandlesToRelease.Add(Handle);
+				OutCompletedRequests.HandlesToRelease.Add(Handle);
 			}
 
-			HandlesToComplete.Add(Handle);
+			OutCompletedRequests.HandlesToComplete.Add(Handle);
 		}		
 	}
 	Existing->LoadingHandles.Empty();
+}
+
+void FStreamableManager::CompleteRequests(FCompletedRequests& CompletedRequests)
+{
+	static int32 RecursiveCount = 0;
+
+	ensure(RecursiveCount == 0);
+
+	RecursiveCount++;
 
-	for (TSharedRef<FStreamableHandle>& Handle : HandlesToComplete)
+	for (TSharedRef<FStreamableHandle>& Handle : CompletedRequests.HandlesToComplete)
 	{
 		Handle->CompleteLoad();
 	}
 
-	for (TSharedRef<FStreamableHandle>& Handle : HandlesToRelease)
+	for (TSharedRef<FStreamableHandle>& Handle : CompletedRequests.HandlesToRelease)
 	{
 		Handle->ReleaseHandle();
 	}
 
-	// HandlesToRelease might get deleted when function ends
+	// HandlesToRelease might get deleted when CompletedRequests goes out of scope
 
 	RecursiveCount--;
 }
@@ -8,6 +8,10 @@ AsyncTextureStreaming.cpp: Definitions of classes used for texture streaming asy
 #include "Misc/App.h"
 #include "Streaming/StreamingManagerTexture.h"
 #include "Engine/World.h"
+#include "Async/ParallelFor.h"
+
+/** Number of streaming render assets processed by each task when the wanted and budgeted mips are computed in parallel. */
+static const int32 MipCalcRenderAssetsPerChunk = 512;
 
 void FAsyncRenderAssetStreamingData::Init(
 	TArray<FStreamingViewInfo> InViewInfos,
@@ -79,10 +83,21 @@ void FAsyncRenderAssetStreamingData::ComputeViewInfoExtras(const FRenderAssetStr
 
 void FAsyncRenderAssetStreamingData::UpdateBoundSizes_Async(const FRenderAssetStreamingSettings& Settings)
 {
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FAsyncRenderAssetStreamingData::UpdateBoundSizes_Async"), STAT_FAsyncRenderAssetStreamingData_UpdateBoundSizes, STATGROUP_StreamingDetails);
+
+		// Each level view only writes its own data, so they can all be updated at once. Large views are further split in UpdateBoundSizes_Async().
+		ParallelFor(StaticInstancesViews.Num(), [&](int32 StaticViewIndex)
+		{
+			StaticInstancesViews[StaticViewIndex].UpdateBoundSizes_Async(ViewInfos, ViewInfoExtras, LastUpdateTime, Settings);
+		}, !Settings.bParallelMipCalculation);
+
+		DynamicInstancesView.UpdateBoundSizes_Async(ViewInfos, ViewInfoExtras, LastUpdateTime, Settings);
+	}
+
 	for (int32 StaticViewIndex = 0; StaticViewIndex < StaticInstancesViews.Num(); ++StaticViewIndex)
 	{
-		FRenderAssetInstanceAsyncView& StaticInstancesView = StaticInstancesViews[StaticViewIndex];
-		StaticInstancesView.UpdateBoundSizes_Async(ViewInfos, ViewInfoExtras, LastUpdateTime, Settings);
+		const FRenderAssetInstanceAsyncView& StaticInstancesView = StaticInstancesViews[StaticViewIndex];
 
 		// Skip levels that can not contribute to resolution.
 		if (StaticInstancesView.GetMaxLevelRenderAssetScreenSize() > Settings.MinLevelRenderAssetScreenSize
@@ -101,8 +116,6 @@ void FAsyncRenderAssetStreamingData::UpdateBoundSizes_Async(const FRenderAssetSt
 	{
 		StaticInstancesViewIndices.Sort([&](int32 LHS, int32 RHS) { return StaticInstancesViews[LHS].GetMaxLevelRenderAssetScreenSize() > StaticInstancesViews[RHS].GetMaxLevelRenderAssetScreenSize(); });
 	}
-
-	DynamicInstancesView.UpdateBoundSizes_Async(ViewInfos, ViewInfoExtras, LastUpdateTime, Settings);
 }
 
 void FAsyncRenderAssetStreamingData::UpdatePerfectWantedMips_Async(FStreamingRenderAsset& StreamingRenderAsset, const FRenderAssetStreamingSettings& Settings, bool bOutputToLog) const
@@ -528,30 +541,62 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async(int64& MemoryUse
 	MemoryUsed = 0;
 	TempMemoryUsed = 0;
 
-	for (FStreamingRenderAsset& StreamingRenderAsset : StreamingRenderAssets)
+	// The retention priorities are computed per chunk, each chunk accumulating its own memory totals which are then summed.
+	struct FChunkMemoryTotals
 	{
-		if (IsAborted()) break;
+		int64 MemoryBudgeted = 0;
+		int64 MeshMemoryBudgeted = 0;
+		int64 MemoryUsed = 0;
+		int64 MemoryUsedByNonTextures = 0;
+		int64 TempMemoryUsed = 0;
+		int32 NumAssets = 0;
+		int32 NumMeshes = 0;
+	};
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(StreamingRenderAssets.Num(), MipCalcRenderAssetsPerChunk);
+	TArray<FChunkMemoryTotals, TInlineAllocator<64>> ChunkMemoryTotals;
+	ChunkMemoryTotals.AddDefaulted(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		FChunkMemoryTotals& Totals = ChunkMemoryTotals[ChunkIndex];
+		const int32 LastAssetIndex = FMath::Min((ChunkIndex + 1) * MipCalcRenderAssetsPerChunk, StreamingRenderAssets.Num());
+		for (int32 AssetIndex = ChunkIndex * MipCalcRenderAssetsPerChunk; AssetIndex < LastAssetIndex && !IsAborted(); ++AssetIndex)
+		{
+			FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
 
-		const int64 AssetMemBudgeted = StreamingRenderAsset.UpdateRetentionPriority_Async(Settings.bPrioritizeMeshLODRetention);
-		const int32 AssetMemUsed = StreamingRenderAsset.GetSize(StreamingRenderAsset.ResidentMips);
-		MemoryUsed += AssetMemUsed;
+			const int64 AssetMemBudgeted = StreamingRenderAsset.UpdateRetentionPriority_Async(Settings.bPrioritizeMeshLODRetention);
+			const int32 AssetMemUsed = StreamingRenderAsset.GetSize(StreamingRenderAsset.ResidentMips);
+			Totals.MemoryUsed += AssetMemUsed;
 
-		if (StreamingRenderAsset.IsTexture())
-		{
-			MemoryBudgeted += AssetMemBudgeted;
-			++NumAssets;
-		}
-		else
-		{
-			MeshMemoryBudgeted += AssetMemBudgeted;
-			MemoryUsedByNonTextures += AssetMemUsed;
-			++NumMeshes;
-		}
+			if (StreamingRenderAsset.IsTexture())
+			{
+				Totals.MemoryBudgeted += AssetMemBudgeted;
+				++Totals.NumAssets;
+			}
+			else
+			{
+				Totals.MeshMemoryBudgeted += AssetMemBudgeted;
+				Totals.MemoryUsedByNonTextures += AssetMemUsed;
+				++Totals.NumMeshes;
+			}
 
-		if (StreamingRenderAsset.ResidentMips != StreamingRenderAsset.RequestedMips)
-		{
-			TempMemoryUsed += StreamingRenderAsset.GetSize(StreamingRenderAsset.RequestedMips);
+			if (StreamingRenderAsset.ResidentMips != StreamingRenderAsset.RequestedMips)
+			{
+				Totals.TempMemoryUsed += StreamingRenderAsset.GetSize(StreamingRenderAsset.RequestedMips);
+			}
 		}
+	}, !Settings.bParallelMipCalculation);
+
+	for (const FChunkMemoryTotals& Totals : ChunkMemoryTotals)
+	{
+		MemoryBudgeted += Totals.MemoryBudgeted;
+		MeshMemoryBudgeted += Totals.MeshMemoryBudgeted;
+		MemoryUsed += Totals.MemoryUsed;
+		MemoryUsedByNonTextures += Totals.MemoryUsedByNonTextures;
+		TempMemoryUsed += Totals.TempMemoryUsed;
+		NumAssets += Totals.NumAssets;
+		NumMeshes += Totals.NumMeshes;
 	}
 
 	//*************************************
@@ -885,25 +930,44 @@ void FRenderAssetStreamingMipCalcTask::DoWork()
 	
 	ApplyPakStateChanges_Async();
 
-	for (FStreamingRenderAsset& StreamingRenderAsset : StreamingRenderAssets)
 	{
-		if (IsAborted()) break;
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRenderAssetStreamingMipCalcTask::UpdatePerfectWantedMips"), STAT_FRenderAssetStreamingMipCalcTask_UpdatePerfectWantedMips, STATGROUP_StreamingDetails);
+
+		// Each asset only writes its own state, and the views are read only once the bound sizes are computed.
+		const int32 NumAssets = StreamingRenderAssets.Num();
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumAssets, MipCalcRenderAssetsPerChunk);
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 LastAssetIndex = FMath::Min((ChunkIndex + 1) * MipCalcRenderAssetsPerChunk, NumAssets);
+			for (int32 AssetIndex = ChunkIndex * MipCalcRenderAssetsPerChunk; AssetIndex < LastAssetIndex && !IsAborted(); ++AssetIndex)
+			{
+				FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
+
+				StreamingRenderAsset.UpdateOptionalMipsState_Async();
 
-		StreamingRenderAsset.UpdateOptionalMipsState_Async();
-		
-		StreamingData.UpdatePerfectWantedMips_Async(StreamingRenderAsset, Settings);
-		StreamingRenderAsset.DynamicBoostFactor = 1.f; // Reset after every computation.
+				StreamingData.UpdatePerfectWantedMips_Async(StreamingRenderAsset, Settings);
+				StreamingRenderAsset.DynamicBoostFactor = 1.f; // Reset after every computation.
+			}
+		}, !Settings.bParallelMipCalculation);
 	}
 
 	int64 MemoryUsed, TempMemoryUsed;
-	// According to budget, make relevant sacrifices and keep possible unwanted mips
-	UpdateBudgetedMips_Async(MemoryUsed, TempMemoryUsed);
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips"), STAT_FRenderAssetStreamingMipCalcTask_UpdateBudgetedMips, STATGROUP_StreamingDetails);
 
-	// Update load requests.
-	UpdateLoadAndCancelationRequests_Async(MemoryUsed, TempMemoryUsed);
+		// According to budget, make relevant sacrifices and keep possible unwanted mips
+		UpdateBudgetedMips_Async(MemoryUsed, TempMemoryUsed);
+	}
+
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRenderAssetStreamingMipCalcTask::UpdateRequests"), STAT_FRenderAssetStreamingMipCalcTask_UpdateRequests, STATGROUP_StreamingDetails);
 
-	// Update bHasStreamingUpdatePending
-	UpdatePendingStreamingStatus_Async();
+		// Update load requests.
+		UpdateLoadAndCancelationRequests_Async(MemoryUsed, TempMemoryUsed);
+
+		// Update bHasStreamingUpdatePending
+		UpdatePendingStreamingStatus_Async();
+	}
 
 	StreamingData.OnTaskDone_Async();
 
@@ -30,6 +30,8 @@ CSV_DECLARE_CATEGORY_MODULE_EXTERN(CORE_API, Basic);
 
 CSV_DEFINE_CATEGORY(TextureStreaming, true);
 
+extern volatile int64 GStreamingWastedMipsSize;
+
 static TAutoConsoleVariable<int32> CVarStreamingOverlapAssetAndLevelTicks(
 	TEXT("r.Streaming.OverlapAssetAndLevelTicks"),
 	!WITH_EDITOR && (PLATFORM_PS4),
@@ -1484,6 +1486,9 @@ void FRenderAssetStreamingManager::UpdateResourceStreaming( float DeltaTime, boo
 	const bool bUseThreadingForPerf = FApp::ShouldUseThreadingForPerformance();
 
 	LogViewLocationChange();
+
+	// Only report what was wasted since the previous update, the streaming tasks keep adding to it in the background.
+	DisplayedStats.WastedMips = FPlatformAtomics::InterlockedExchange(&GStreamingWastedMipsSize, 0);
 	STAT(DisplayedStats.Apply();)
 
 	CSV_CUSTOM_STAT(TextureStreaming, StreamingPool, ((float)(DisplayedStats.RequiredPool + (GPoolSizeVRAMPercentage > 0 ? 0 : DisplayedStats.NonStreamingMips))) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
@@ -1491,6 +1496,7 @@ void FRenderAssetStreamingManager::UpdateResourceStreaming( float DeltaTime, boo
 	CSV_CUSTOM_STAT(TextureStreaming, TemporaryPool, ((float)DisplayedStats.TemporaryPool) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
 	CSV_CUSTOM_STAT(TextureStreaming, CachedMips, ((float)DisplayedStats.CachedMips) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
 	CSV_CUSTOM_STAT(TextureStreaming, WantedMips, ((float)DisplayedStats.WantedMips) / (1024.0f * 1024.0f), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(TextureStreaming, WastedMips, ((float)DisplayedStats.WastedMips) / (1024.0f * 1024.0f), ECsvCustomStatOp::Accumulate);
 
 	RenderAssetInstanceAsyncWork->EnsureCompletion();
 
@@ -12,12 +12,18 @@ StreamingTexture.cpp: Definitions of classes used for texture.
 #include "Engine/SkeletalMesh.h"
 #include "LandscapeComponent.h"
 
+/** Total size of the streamed mips that were dropped without having been rendered since they were loaded. Consumed and reset by each streaming update. */
+volatile int64 GStreamingWastedMipsSize = 0;
+
 FStreamingRenderAsset::FStreamingRenderAsset(
 	UStreamableRenderAsset* InRenderAsset,
 	const int32* NumStreamedMips,
 	int32 NumLODGroups,
 	const FRenderAssetStreamingSettings& Settings)
 	: RenderAsset(InRenderAsset)
+	, ResidentMips(0)
+	, UnseenMipsBase(INDEX_NONE)
+	, UnseenMipsTimestamp(0)
 	, RenderAssetType(InRenderAsset->GetRenderAssetType())
 {
 	UpdateStaticData(Settings);
@@ -232,12 +238,53 @@ FStreamableRenderResourceState FStreamingRenderAsset::UpdateStreamingStatus(bool
 		ResourceState = RenderAsset->GetStreamableResourceState();
 
 		// This must be updated after UpdateStreamingStatus
+		const int32 PreviousResidentMips = ResidentMips;
 		ResidentMips = ResourceState.NumResidentLODs;
 		RequestedMips = ResourceState.NumRequestedLODs;
+
+		UpdateUnseenMips_Internal(PreviousResidentMips);
 	}
 	return ResourceState;
 }
 
+void FStreamingRenderAsset::UpdateUnseenMips_Internal(int32 PreviousResidentMips)
+{
+	// Nothing is known about the mips that were resident before the first update.
+	if (PreviousResidentMips <= 0)
+	{
+		return;
+	}
+
+	// Once rendered, the streamed mips are considered useful, even if only partially used.
+	if (UnseenMipsBase != INDEX_NONE && RenderAsset->GetLastRenderTimeForStreaming() >= UnseenMipsTimestamp)
+	{
+		UnseenMipsBase = INDEX_NONE;
+	}
+
+	if (ResidentMips > PreviousResidentMips)
+	{
+		if (UnseenMipsBase == INDEX_NONE)
+		{
+			UnseenMipsBase = PreviousResidentMips;
+		}
+		UnseenMipsTimestamp = FApp::GetCurrentTime();
+	}
+	else if (ResidentMips < PreviousResidentMips && UnseenMipsBase != INDEX_NONE)
+	{
+		// Only the mips above the base were streamed in without being used.
+		const int32 KeptMips = FMath::Max(ResidentMips, UnseenMipsBase);
+		if (PreviousResidentMips > KeptMips)
+		{
+			FPlatformAtomics::InterlockedAdd(&GStreamingWastedMipsSize, (int64)GetSize(PreviousResidentMips) - (int64)GetSize(KeptMips));
+		}
+
+		if (ResidentMips <= UnseenMipsBase)
+		{
+			UnseenMipsBase = INDEX_NONE;
+		}
+	}
+}
+
 float FStreamingRenderAsset::GetExtraBoost(TextureGroup	LODGroup, const FRenderAssetStreamingSettings& Settings)
 {
 	const float DistanceScale = GetDefaultExtraBoost(Settings.bUseNewMetrics);
@@ -221,6 +221,10 @@ struct FStreamingRenderAsset
 	int32			MaxAllowedMips;
 	/** (2) How much game time has elapsed since the texture was bound for rendering. Based on FApp::GetCurrentTime(). */
 	float			LastRenderTime;
+	/** (2) Resident mips before the latest mips were streamed in, or INDEX_NONE once those mips have been rendered. Used to measure wasted streaming. */
+	int32			UnseenMipsBase;
+	/** (2) When the latest mips were streamed in. Based on FApp::GetCurrentTime(). */
+	double			UnseenMipsTimestamp;
 
 	/** (3) If non-zero, the most recent time an instance location was removed for this texture. */
 	double			InstanceRemovedTimestamp;
@@ -288,4 +292,6 @@ private:
 	FORCEINLINE_DEBUGGABLE void StreamWantedMips_Internal(FRenderAssetStreamingManager& Manager, bool bUseCachedData);
 
 	FORCEINLINE_DEBUGGABLE int32 ClampMaxResChange_Internal(int32 NumMipDropRequested) const;
+
+	void UpdateUnseenMips_Internal(int32 PreviousResidentMips);
 };
@@ -10,6 +10,10 @@
 #include "Streaming/TextureStreamingHelpers.h"
 #include "Components/PrimitiveComponent.h"
 #include "ContentStreaming.h"
+#include "Async/ParallelFor.h"
+
+/** Number of FBounds4 processed by each task when the bound sizes are computed in parallel. */
+static const int32 BoundSizesBounds4PerChunk = 1024;
 
 void FRenderAssetInstanceView::FBounds4::Set(int32 Index, const FBoxSphereBounds& Bounds, uint32 InPackedRelativeBox, float InLastRenderTime, const FVector& RangeOrigin, float InMinDistanceSq, float InMinRangeSq, float InMaxRangeSq)
 {
@@ -338,18 +342,60 @@ void FRenderAssetInstanceAsyncView::UpdateBoundSizes_Async(
 
 	if (!View.IsValid())  return;
 
-	const int32 NumViews = ViewInfos.Num();
 	const int32 NumBounds4 = View->NumBounds4();
 
-	const VectorRegister LastUpdateTime4 = VectorSet(LastUpdateTime, LastUpdateTime, LastUpdateTime, LastUpdateTime);
-
 	BoundsViewInfo.Empty(NumBounds4 * 4);
 	BoundsViewInfo.AddUninitialized(NumBounds4 * 4);
 
 	// Max normalized size from all elements
+	float ViewMaxNormalizedSize = 0;
+
+	// Each chunk writes its own range of BoundsViewInfo, only the view max needs to be reduced.
+	const int32 NumChunks = Settings.bParallelMipCalculation ? FMath::DivideAndRoundUp(NumBounds4, BoundSizesBounds4PerChunk) : 1;
+	if (NumChunks > 1)
+	{
+		TArray<float, TInlineAllocator<64>> ChunkMaxNormalizedSizes;
+		ChunkMaxNormalizedSizes.AddZeroed(NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 FirstBounds4Index = ChunkIndex * BoundSizesBounds4PerChunk;
+			const int32 LastBounds4Index = FMath::Min(FirstBounds4Index + BoundSizesBounds4PerChunk, NumBounds4);
+			ChunkMaxNormalizedSizes[ChunkIndex] = UpdateBoundSizesRange_Async(ViewInfos, ViewInfoExtras, LastUpdateTime, Settings, FirstBounds4Index, LastBounds4Index);
+		});
+
+		for (float ChunkMaxNormalizedSize : ChunkMaxNormalizedSizes)
+		{
+			ViewMaxNormalizedSize = FMath::Max(ViewMaxNormalizedSize, ChunkMaxNormalizedSize);
+		}
+	}
+	else
+	{
+		ViewMaxNormalizedSize = UpdateBoundSizesRange_Async(ViewInfos, ViewInfoExtras, LastUpdateTime, Settings, 0, NumBounds4);
+	}
+
+	if (Settings.MinLevelRenderAssetScreenSize > 0)
+	{
+		MaxLevelRenderAssetScreenSize = View->GetMaxTexelFactor() * ViewMaxNormalizedSize;
+	}
+}
+
+float FRenderAssetInstanceAsyncView::UpdateBoundSizesRange_Async(
+	const TArray<FStreamingViewInfo>& ViewInfos,
+	const FStreamingViewInfoExtraArray& ViewInfoExtras,
+	float LastUpdateTime,
+	const FRenderAssetStreamingSettings& Settings,
+	int32 FirstBounds4Index,
+	int32 LastBounds4Index)
+{
+	const int32 NumViews = ViewInfos.Num();
+
+	const VectorRegister LastUpdateTime4 = VectorSet(LastUpdateTime, LastUpdateTime, LastUpdateTime, LastUpdateTime);
+
+	// Max normalized size from all elements in the range
 	VectorRegister ViewMaxNormalizedSize = VectorZero();
 
-	for (int32 Bounds4Index = 0; Bounds4Index < NumBounds4; ++Bounds4Index)
+	for (int32 Bounds4Index = FirstBounds4Index; Bounds4Index < LastBounds4Index; ++Bounds4Index)
 	{
 		const FRenderAssetInstanceView::FBounds4& CurrentBounds4 = View->GetBounds4(Bounds4Index);
 
@@ -465,15 +511,12 @@ void FRenderAssetInstanceAsyncView::UpdateBoundSizes_Async(
 		}
 	}
 
-	if (Settings.MinLevelRenderAssetScreenSize > 0)
+	float ViewMaxNormalizedSizeResult = VectorGetComponent(ViewMaxNormalizedSize, 0);
+	for (int32 SubIndex = 1; SubIndex < 4; ++SubIndex)
 	{
-		float ViewMaxNormalizedSizeResult = VectorGetComponent(ViewMaxNormalizedSize, 0);
-		for (int32 SubIndex = 1; SubIndex < 4; ++SubIndex)
-		{
-			ViewMaxNormalizedSizeResult = FMath::Max(ViewMaxNormalizedSizeResult, VectorGetComponent(ViewMaxNormalizedSize, SubIndex));
-		}
-		MaxLevelRenderAssetScreenSize = View->GetMaxTexelFactor() * ViewMaxNormalizedSizeResult;
+		ViewMaxNormalizedSizeResult = FMath::Max(ViewMaxNormalizedSizeResult, VectorGetComponent(ViewMaxNormalizedSize, SubIndex));
 	}
+	return ViewMaxNormalizedSizeResult;
 }
 
 void FRenderAssetInstanceAsyncView::ProcessElement(
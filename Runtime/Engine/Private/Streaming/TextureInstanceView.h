@@ -310,6 +310,15 @@ private:
 	/** The max possible size (conservative) across all elements of this view. */
 	float MaxLevelRenderAssetScreenSize;
 
+	/** Computes BoundsViewInfo for the bounds in [FirstBounds4Index, LastBounds4Index) and returns the max normalized size of the valid bounds in that range. */
+	float UpdateBoundSizesRange_Async(
+		const TArray<FStreamingViewInfo>& ViewInfos,
+		const FStreamingViewInfoExtraArray& ViewInfoExtras,
+		float LastUpdateTime,
+		const FRenderAssetStreamingSettings& Settings,
+		int32 FirstBounds4Index,
+		int32 LastBounds4Index);
+
 	void ProcessElement(
 		EStreamableRenderAssetType AssetType,
 		const FBoundsViewInfo& BoundsVieWInfo,
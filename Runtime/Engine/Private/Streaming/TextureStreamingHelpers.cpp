@@ -8,6 +8,7 @@ TextureStreamingHelpers.cpp: Definitions of classes used for texture streaming.
 #include "UnrealEngine.h"
 #include "Engine/Texture2D.h"
 #include "GenericPlatform/GenericPlatformMemoryPoolStats.h"
+#include "Misc/App.h"
 
 /** Streaming stats */
 
@@ -32,6 +33,7 @@ DECLARE_CYCLE_STAT(TEXT("Update Streaming Data"), STAT_Streaming02_UpdateStreami
 DECLARE_CYCLE_STAT(TEXT("Streaming Render Assets"), STAT_Streaming03_StreamRenderAssets, STATGROUP_Streaming);
 DECLARE_CYCLE_STAT(TEXT("Notifications"), STAT_Streaming04_Notifications, STATGROUP_Streaming);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Pending 2D Update"), STAT_Streaming05_Pending2DUpdate, STATGROUP_Streaming);
+DECLARE_MEMORY_STAT(TEXT("Wasted Mips"), STAT_Streaming06_WastedMips, STATGROUP_Streaming);
 
 /** Streaming Overview stats */
 
@@ -258,6 +260,12 @@ ENGINE_API TAutoConsoleVariable<int32> CVarFramesForFullUpdate(
 	5,
 	TEXT("Texture streaming is time sliced per frame. This values gives the number of frames to visit all textures."));
 
+static TAutoConsoleVariable<int32> CVarStreamingParallelMipCalculation(
+	TEXT("r.Streaming.ParallelMipCalculation"),
+	1,
+	TEXT("If non-zero, the streaming async task splits the bound size, wanted mip and budget computations across worker threads."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<int32> CVarPrioritizeMeshLODRetention(
 	TEXT("r.Streaming.PrioritizeMeshLODRetention"),
 	1,
@@ -312,6 +320,7 @@ void FRenderAssetStreamingSettings::Update()
 	HiddenPrimitiveScale = bUseNewMetrics ? CVarStreamingHiddenPrimitiveScale.GetValueOnAnyThread() : 1.f;
 	bMipCalculationEnablePerLevelList = CVarStreamingMipCalculationEnablePerLevelList.GetValueOnAnyThread() != 0;
 	bPrioritizeMeshLODRetention = CVarPrioritizeMeshLODRetention.GetValueOnAnyThread() != 0;
+	bParallelMipCalculation = CVarStreamingParallelMipCalculation.GetValueOnAnyThread() != 0 && FApp::ShouldUseThreadingForPerformance();
 	VRAMPercentageClamp = CVarStreamingVRAMPercentageClamp.GetValueOnAnyThread();
 
 	MaterialQualityLevel = (int32)GetCachedScalabilityCVars().MaterialQualityLevel;
@@ -402,6 +411,7 @@ void FRenderAssetStreamingStats::Apply()
 	SET_CYCLE_COUNTER(STAT_Streaming03_StreamRenderAssets, StreamRenderAssetsCycles);
 	SET_CYCLE_COUNTER(STAT_Streaming04_Notifications, CallbacksCycles);
 	INC_DWORD_STAT_BY(STAT_Streaming05_Pending2DUpdate, GPending2DUpdateCount);
+	SET_MEMORY_STAT(STAT_Streaming06_WastedMips, WastedMips);
 
 	/** Streaming Overview stats */
 
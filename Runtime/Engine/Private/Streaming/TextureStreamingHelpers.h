@@ -98,6 +98,7 @@ struct FRenderAssetStreamingSettings
 	int32 FramesForFullUpdate;
 	bool bMipCalculationEnablePerLevelList;
 	bool bPrioritizeMeshLODRetention;
+	bool bParallelMipCalculation;
 	int32 VRAMPercentageClamp;
 
 	bool bStressTest;
@@ -158,6 +159,7 @@ struct FRenderAssetStreamingStats
 	int64 NewRequests;			// Estimated memory in bytes required by new requests (TODO)
 	int64 PendingRequests;		// Estimated memory in bytes waiting to be loaded for previous requests
 	int64 MipIOBandwidth;		// Estimated IO bandwidth in bytes/sec
+	int64 WastedMips;			// Memory in bytes of streamed mips dropped without having been rendered since the previous update
 
 	int64 OverBudget;			// RequiredPool - StreamingPool
 
@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "ADPCMAudioInfo.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ADPCMDecodeTest
+{
+	// Writes the 7 byte block preamble, then fills the nibble data with the given byte.
+	static void WriteBlock(uint8* OutBlock, int32 BlockSize, uint8 CoefficientIndex, int16 AdaptationDelta, int16 Sample1, int16 Sample2, uint8 NibblePair)
+	{
+		OutBlock[0] = CoefficientIndex;
+		OutBlock[1] = (uint8)(AdaptationDelta & 0xFF);
+		OutBlock[2] = (uint8)((AdaptationDelta >> 8) & 0xFF);
+		OutBlock[3] = (uint8)(Sample1 & 0xFF);
+		OutBlock[4] = (uint8)((Sample1 >> 8) & 0xFF);
+		OutBlock[5] = (uint8)(Sample2 & 0xFF);
+		OutBlock[6] = (uint8)((Sample2 >> 8) & 0xFF);
+		FMemory::Memset(OutBlock + 7, NibblePair, BlockSize - 7);
+	}
+
+	// Builds one block per channel whose preamble and nibbles differ per channel and per byte, so that any channel or sample mixup shows.
+	static void WriteChannelBlocks(TArray<uint8>& OutEncodedData, TArray<const uint8*>& OutChannelBlocks, int32 NumChannels, int32 BlockSize)
+	{
+		OutEncodedData.SetNumUninitialized(NumChannels * BlockSize);
+		OutChannelBlocks.SetNumUninitialized(NumChannels);
+		for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+		{
+			uint8* Block = OutEncodedData.GetData() + ChannelIndex * BlockSize;
+			WriteBlock(Block, BlockSize, ChannelIndex % NUM_ADAPTATION_COEFF, 16 + ChannelIndex * 40, 1000 * ChannelIndex - 3000, 500 - 700 * ChannelIndex, 0);
+			for (int32 ByteIndex = 7; ByteIndex < BlockSize; ++ByteIndex)
+			{
+				Block[ByteIndex] = (uint8)(ByteIndex * 37 + ChannelIndex * 11);
+			}
+			OutChannelBlocks[ChannelIndex] = Block;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FADPCMBlockDecodeTest, "System.Engine.Audio.ADPCM Block Decode", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FADPCMBlockDecodeTest::RunTest(const FString& Parameters)
+{
+	const int32 BlockSize = 36;
+	const int32 SamplesPerBlock = ADPCM::GetNumSamplesPerBlock(BlockSize);
+	TestEqual(TEXT("A 36 byte block holds 2 preamble samples and 2 samples per nibble byte"), SamplesPerBlock, 60);
+
+	// Coefficient pair 0 predicts the previous sample, so a block of zero nibbles holds its first sample and a block of +1 nibbles ramps by the minimum delta
+	{
+		uint8 Block[BlockSize];
+		TArray<int16> Decoded;
+		Decoded.SetNumZeroed(SamplesPerBlock);
+
+		ADPCMDecodeTest::WriteBlock(Block, BlockSize, 0, 16, 100, 50, 0x00);
+		ADPCM::DecodeBlock(Block, BlockSize, Decoded.GetData());
+		TestEqual(TEXT("Preamble Sample2 is output first"), Decoded[0], (int16)50);
+		TestEqual(TEXT("Preamble Sample1 is output second"), Decoded[1], (int16)100);
+		TestEqual(TEXT("Zero nibbles hold the last sample"), Decoded[SamplesPerBlock - 1], (int16)100);
+
+		ADPCMDecodeTest::WriteBlock(Block, BlockSize, 0, 16, 100, 50, 0x11);
+		ADPCM::DecodeBlock(Block, BlockSize, Decoded.GetData());
+		TestEqual(TEXT("First +1 nibble adds the adaptation delta"), Decoded[2], (int16)116);
+		TestEqual(TEXT("Adaptation delta does not drop below 16"), Decoded[SamplesPerBlock - 1], (int16)(100 + 16 * (SamplesPerBlock - 2)));
+	}
+
+	// Interleaved decoding must match decoding each channel on its own, including past MaxInterleavedDecodeChannels where channels are decoded one at a time
+	const int32 ChannelCounts[] = { 1, 2, 6, ADPCM::MaxInterleavedDecodeChannels + 2 };
+	const int32 BlockSizes[] = { BlockSize, 512 };
+	for (const int32 TestBlockSize : BlockSizes)
+	{
+		const int32 TestSamplesPerBlock = ADPCM::GetNumSamplesPerBlock(TestBlockSize);
+		for (const int32 NumChannels : ChannelCounts)
+		{
+			TArray<uint8> EncodedData;
+			TArray<const uint8*> ChannelBlocks;
+			ADPCMDecodeTest::WriteChannelBlocks(EncodedData, ChannelBlocks, NumChannels, TestBlockSize);
+
+			TArray<int16> ChannelData;
+			ChannelData.SetNumUninitialized(TestSamplesPerBlock);
+
+			TArray<int16> Interleaved;
+			Interleaved.SetNumUninitialized(NumChannels * TestSamplesPerBlock);
+			ADPCM::DecodeBlocksInterleaved(ChannelBlocks.GetData(), NumChannels, TestBlockSize, Interleaved.GetData());
+
+			int32 NumMismatches = 0;
+			for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+			{
+				ADPCM::DecodeBlock(ChannelBlocks[ChannelIndex], TestBlockSize, ChannelData.GetData());
+				for (int32 SampleIndex = 0; SampleIndex < TestSamplesPerBlock; ++SampleIndex)
+				{
+					NumMismatches += Interleaved[SampleIndex * NumChannels + ChannelIndex] != ChannelData[SampleIndex] ? 1 : 0;
+				}
+			}
+			TestEqual(FString::Printf(TEXT("Interleaved decode matches per channel decode (block size %d, %d channels)"), TestBlockSize, NumChannels), NumMismatches, 0);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FADPCMBlockDecodePerfTest, "System.Engine.Audio.ADPCM Block Decode Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FADPCMBlockDecodePerfTest::RunTest(const FString& Parameters)
+{
+	const int32 BlockSize = 512;
+	const int32 NumIterations = 200;
+	const int32 SamplesPerBlock = ADPCM::GetNumSamplesPerBlock(BlockSize);
+	const int32 ChannelCounts[] = { 2, 6 };
+
+	for (const int32 NumChannels : ChannelCounts)
+	{
+		TArray<uint8> EncodedData;
+		TArray<const uint8*> ChannelBlocks;
+		ADPCMDecodeTest::WriteChannelBlocks(EncodedData, ChannelBlocks, NumChannels, BlockSize);
+
+		TArray<int16> Decoded;
+		Decoded.SetNumUninitialized(NumChannels * SamplesPerBlock);
+
+		const uint64 PerChannelStartCycles = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+			{
+				ADPCM::DecodeBlock(ChannelBlocks[ChannelIndex], BlockSize, Decoded.GetData() + ChannelIndex * SamplesPerBlock);
+			}
+		}
+		const double PerChannelMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PerChannelStartCycles);
+
+		const uint64 InterleavedStartCycles = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			ADPCM::DecodeBlocksInterleaved(ChannelBlocks.GetData(), NumChannels, BlockSize, Decoded.GetData());
+		}
+		const double InterleavedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - InterleavedStartCycles);
+
+		AddInfo(FString::Printf(TEXT("%d channels, %d blocks of %d bytes: per channel %.3f ms, interleaved %.3f ms"), NumChannels, NumIterations, BlockSize, PerChannelMs, InterleavedMs));
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,177 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Curves/RichCurve.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace BakedRichCurveTest
+{
+	// Builds a wave shaped curve of NumKeys keys half a second apart with the given interpolation and extrapolation.
+	static void MakeCurve(FRichCurve& OutCurve, int32 NumKeys, ERichCurveInterpMode InterpMode, ERichCurveExtrapolation Extrapolation)
+	{
+		OutCurve.Reset();
+		OutCurve.PreInfinityExtrap = Extrapolation;
+		OutCurve.PostInfinityExtrap = Extrapolation;
+		for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+		{
+			const FKeyHandle KeyHandle = OutCurve.AddKey(KeyIndex * 0.5f, (KeyIndex % 2 ? 4.0f : -2.0f) + KeyIndex);
+			OutCurve.SetKeyInterpMode(KeyHandle, InterpMode, false);
+		}
+		OutCurve.AutoSetTangents();
+	}
+
+	// Returns the largest difference between the baked and exact evaluations over times covering the keys and both extrapolations.
+	static float GetLargestError(const FRichCurve& Curve, const FBakedRichCurve& BakedCurve)
+	{
+		float LargestError = 0.0f;
+		for (float Time = -4.0f; Time <= 8.0f; Time += 0.01f)
+		{
+			LargestError = FMath::Max(LargestError, FMath::Abs(BakedCurve.Eval(Time) - Curve.Eval(Time)));
+		}
+		return LargestError;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBakedRichCurveTest, "System.Engine.Curves.Baked Rich Curve", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBakedRichCurveTest::RunTest(const FString& Parameters)
+{
+	const float MaxError = 0.001f;
+
+	FBakedRichCurve BakedCurve;
+	TestFalse(TEXT("A curve without keys can't be baked"), BakedCurve.Bake(FRichCurve(), MaxError));
+	TestFalse(TEXT("A failed bake leaves the curve empty"), BakedCurve.IsBaked());
+
+	// Every interpolation and extrapolation mode. Baking only validates a few points per segment, so allow some slack between them.
+	const ERichCurveInterpMode InterpModes[] = { RCIM_Linear, RCIM_Cubic };
+	const ERichCurveExtrapolation Extrapolations[] = { RCCE_Constant, RCCE_Linear, RCCE_Cycle, RCCE_CycleWithOffset, RCCE_Oscillate, RCCE_None };
+	for (const ERichCurveInterpMode InterpMode : InterpModes)
+	{
+		for (const ERichCurveExtrapolation Extrapolation : Extrapolations)
+		{
+			FRichCurve Curve;
+			BakedRichCurveTest::MakeCurve(Curve, 5, InterpMode, Extrapolation);
+
+			const FString Description = FString::Printf(TEXT("interpolation %d, extrapolation %d"), (int32)InterpMode, (int32)Extrapolation);
+			if (TestTrue(FString::Printf(TEXT("Curve can be baked (%s)"), *Description), BakedCurve.Bake(Curve, MaxError)))
+			{
+				TestTrue(FString::Printf(TEXT("Error measured while baking is within the precision (%s)"), *Description), BakedCurve.GetMaxError() <= MaxError);
+
+				const float LargestError = BakedRichCurveTest::GetLargestError(Curve, BakedCurve);
+				TestTrue(FString::Printf(TEXT("Baked curve matches the exact evaluation (%s, largest error %f)"), *Description, LargestError), LargestError <= 4.0f * MaxError);
+			}
+		}
+	}
+
+	// A linear segment is baked exactly, including at the keys
+	FRichCurve LinearCurve;
+	LinearCurve.SetKeyInterpMode(LinearCurve.AddKey(0.0f, 0.0f), RCIM_Linear, false);
+	LinearCurve.SetKeyInterpMode(LinearCurve.AddKey(1.0f, 10.0f), RCIM_Linear, false);
+	if (TestTrue(TEXT("Linear curve can be baked"), BakedCurve.Bake(LinearCurve, MaxError)))
+	{
+		TestEqual(TEXT("Linear curve at the first key"), BakedCurve.Eval(0.0f), 0.0f, MaxError);
+		TestEqual(TEXT("Linear curve halfway"), BakedCurve.Eval(0.5f), 5.0f, MaxError);
+		TestEqual(TEXT("Linear curve at the last key"), BakedCurve.Eval(1.0f), 10.0f, MaxError);
+		TestEqual(TEXT("Constant extrapolation after the last key"), BakedCurve.Eval(3.0f), 10.0f, MaxError);
+	}
+
+	// Batched evaluation must match single evaluation, including the times and curves left over after the groups of four
+	FRichCurve CubicCurve;
+	BakedRichCurveTest::MakeCurve(CubicCurve, 6, RCIM_Cubic, RCCE_CycleWithOffset);
+	BakedCurve.Bake(CubicCurve, MaxError);
+
+	const float Times[] = { -3.3f, -0.2f, 0.0f, 0.7f, 1.25f, 2.5f, 6.1f };
+	float BatchedValues[UE_ARRAY_COUNT(Times)];
+	BakedCurve.EvalTimes(Times, BatchedValues);
+	for (int32 TimeIndex = 0; TimeIndex < UE_ARRAY_COUNT(Times); ++TimeIndex)
+	{
+		TestEqual(FString::Printf(TEXT("Batched time %f matches single evaluation"), Times[TimeIndex]), BatchedValues[TimeIndex], BakedCurve.Eval(Times[TimeIndex]), KINDA_SMALL_NUMBER);
+	}
+
+	TArray<FBakedRichCurve> BakedCurves;
+	TArray<const FBakedRichCurve*> CurvesToBatch;
+	BakedCurves.SetNum(UE_ARRAY_COUNT(Extrapolations));
+	for (int32 CurveIndex = 0; CurveIndex < BakedCurves.Num(); ++CurveIndex)
+	{
+		FRichCurve Curve;
+		BakedRichCurveTest::MakeCurve(Curve, 3 + CurveIndex, RCIM_Cubic, Extrapolations[CurveIndex]);
+		BakedCurves[CurveIndex].Bake(Curve, MaxError);
+		CurvesToBatch.Add(&BakedCurves[CurveIndex]);
+	}
+
+	TArray<float> BatchedCurveValues;
+	BatchedCurveValues.SetNumUninitialized(CurvesToBatch.Num());
+	for (const float Time : Times)
+	{
+		FBakedRichCurve::EvalCurves(CurvesToBatch, Time, BatchedCurveValues);
+		for (int32 CurveIndex = 0; CurveIndex < CurvesToBatch.Num(); ++CurveIndex)
+		{
+			TestEqual(FString::Printf(TEXT("Batched curve %d at time %f matches single evaluation"), CurveIndex, Time), BatchedCurveValues[CurveIndex], CurvesToBatch[CurveIndex]->Eval(Time), KINDA_SMALL_NUMBER);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBakedRichCurvePerfTest, "System.Engine.Curves.Baked Rich Curve Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FBakedRichCurvePerfTest::RunTest(const FString& Parameters)
+{
+	const int32 NumCurves = 32;
+	const int32 NumTimes = 1024;
+
+	TArray<FRichCurve> Curves;
+	TArray<FBakedRichCurve> BakedCurves;
+	Curves.SetNum(NumCurves);
+	BakedCurves.SetNum(NumCurves);
+	for (int32 CurveIndex = 0; CurveIndex < NumCurves; ++CurveIndex)
+	{
+		BakedRichCurveTest::MakeCurve(Curves[CurveIndex], 4 + CurveIndex % 12, CurveIndex % 4 ? RCIM_Cubic : RCIM_Linear, CurveIndex % 2 ? RCCE_Cycle : RCCE_Linear);
+		BakedCurves[CurveIndex].Bake(Curves[CurveIndex]);
+	}
+
+	TArray<float> Times;
+	for (int32 TimeIndex = 0; TimeIndex < NumTimes; ++TimeIndex)
+	{
+		Times.Add(-2.0f + 10.0f * TimeIndex / NumTimes);
+	}
+
+	TArray<float> Values;
+	Values.SetNumUninitialized(NumTimes);
+
+	const uint64 ExactStartCycles = FPlatformTime::Cycles64();
+	for (const FRichCurve& Curve : Curves)
+	{
+		for (int32 TimeIndex = 0; TimeIndex < NumTimes; ++TimeIndex)
+		{
+			Values[TimeIndex] = Curve.Eval(Times[TimeIndex]);
+		}
+	}
+	const double ExactMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ExactStartCycles);
+
+	const uint64 BakedStartCycles = FPlatformTime::Cycles64();
+	for (const FBakedRichCurve& BakedCurve : BakedCurves)
+	{
+		for (int32 TimeIndex = 0; TimeIndex < NumTimes; ++TimeIndex)
+		{
+			Values[TimeIndex] = BakedCurve.Eval(Times[TimeIndex]);
+		}
+	}
+	const double BakedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - BakedStartCycles);
+
+	const uint64 BatchedStartCycles = FPlatformTime::Cycles64();
+	for (const FBakedRichCurve& BakedCurve : BakedCurves)
+	{
+		BakedCurve.EvalTimes(Times, Values);
+	}
+	const double BatchedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - BatchedStartCycles);
+
+	AddInfo(FString::Printf(TEXT("%d curves, %d times each: exact %.3f ms, baked %.3f ms, batched %.3f ms"), NumCurves, NumTimes, ExactMs, BakedMs, BatchedMs));
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,339 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "Engine/DataTable.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace DataTableTest
+{
+	// Builds CSV and JSON tables of rows named Row_0 to Row_N-1, rows have no other fields so that the import cost is dominated by the rows themselves.
+	static void GenerateTables(int32 NumRows, FString& OutCSV, FString& OutJSON)
+	{
+		OutCSV = TEXT("Name\n");
+		OutJSON = TEXT("[");
+		for (int32 RowIdx = 0; RowIdx < NumRows; ++RowIdx)
+		{
+			OutCSV += FString::Printf(TEXT("Row_%d\n"), RowIdx);
+			OutJSON += FString::Printf(TEXT("%s{\"Name\":\"Row_%d\"}"), RowIdx > 0 ? TEXT(",") : TEXT(""), RowIdx);
+		}
+		OutJSON += TEXT("]");
+	}
+
+	// Builds CSV and JSON tables of rows named Row_0 to Row_N-1 with the columns of CreateItemRowStruct, so that the import parses a value of each type per row.
+	static void GenerateItemTables(int32 NumRows, FString& OutCSV, FString& OutJSON)
+	{
+		OutCSV = TEXT("Name,Level,Weight,Tag,Description\n");
+		OutJSON = TEXT("[");
+		for (int32 RowIdx = 0; RowIdx < NumRows; ++RowIdx)
+		{
+			const int32 Level = RowIdx % 50;
+			const float Weight = (RowIdx % 1000) * 0.25f;
+			OutCSV += FString::Printf(TEXT("Row_%d,%d,%f,Tag_%d,\"Description of item %d\"\n"), RowIdx, Level, Weight, RowIdx % 16, RowIdx);
+			OutJSON += FString::Printf(TEXT("%s{\"Name\":\"Row_%d\",\"Level\":%d,\"Weight\":%f,\"Tag\":\"Tag_%d\",\"Description\":\"Description of item %d\"}"), RowIdx > 0 ? TEXT(",") : TEXT(""), RowIdx, Level, Weight, RowIdx % 16, RowIdx);
+		}
+		OutJSON += TEXT("]");
+	}
+
+	static UDataTable* CreateTable(bool bPackRows, UScriptStruct* RowStruct = FTableRowBase::StaticStruct())
+	{
+		UDataTable* DataTable = NewObject<UDataTable>(GetTransientPackage());
+		DataTable->RowStruct = RowStruct;
+		DataTable->bPackRows = bPackRows;
+		return DataTable;
+	}
+
+	// Row struct with a Level column, built at runtime since the engine has no native row struct with columns to index
+	static UScriptStruct* CreateLevelRowStruct()
+	{
+		UScriptStruct* RowStruct = NewObject<UScriptStruct>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UScriptStruct::StaticClass(), TEXT("DataTableTestRow")));
+		RowStruct->AddCppProperty(new FIntProperty(RowStruct, TEXT("Level"), RF_Public));
+		RowStruct->Bind();
+		RowStruct->StaticLink(true);
+		return RowStruct;
+	}
+
+	// Row struct with an int, a float, a name and a string column, like a typical item table
+	static UScriptStruct* CreateItemRowStruct()
+	{
+		UScriptStruct* RowStruct = NewObject<UScriptStruct>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UScriptStruct::StaticClass(), TEXT("DataTableTestItemRow")));
+		RowStruct->AddCppProperty(new FStrProperty(RowStruct, TEXT("Description"), RF_Public));
+		RowStruct->AddCppProperty(new FNameProperty(RowStruct, TEXT("Tag"), RF_Public));
+		RowStruct->AddCppProperty(new FFloatProperty(RowStruct, TEXT("Weight"), RF_Public));
+		RowStruct->AddCppProperty(new FIntProperty(RowStruct, TEXT("Level"), RF_Public));
+		RowStruct->Bind();
+		RowStruct->StaticLink(true);
+		return RowStruct;
+	}
+
+	// Checks that the Level index lists exactly the rows at each level, pointing to their current data
+	static bool LevelIndexMatchesRows(const UDataTable* DataTable, const FIntProperty* LevelProperty, int32 NumLevels)
+	{
+		const FDataTableSecondaryIndex* SecondaryIndex = DataTable->FindSecondaryIndex(LevelProperty->GetFName());
+		if (SecondaryIndex == nullptr || SecondaryIndex->Entries.Num() != DataTable->GetRowMap().Num())
+		{
+			return false;
+		}
+
+		for (int32 Level = 0; Level < NumLevels; ++Level)
+		{
+			int32 NumRowsAtLevel = 0;
+			for (const TPair<FName, uint8*>& TableRowPair : DataTable->GetRowMap())
+			{
+				NumRowsAtLevel += LevelProperty->GetPropertyValue_InContainer(TableRowPair.Value) == Level ? 1 : 0;
+			}
+
+			const TArrayView<const FDataTableSecondaryIndex::FEntry> Entries = SecondaryIndex->GetEntriesInRange(FDataTableIndexKey((double)Level), FDataTableIndexKey((double)Level));
+			if (Entries.Num() != NumRowsAtLevel)
+			{
+				return false;
+			}
+
+			for (const FDataTableSecondaryIndex::FEntry& Entry : Entries)
+			{
+				if (DataTable->GetRowMap().FindRef(Entry.RowName) != Entry.RowData || LevelProperty->GetPropertyValue_InContainer(Entry.RowData) != Level)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDataTablePackedRowsTest, "System.Engine.DataTable.Packed Rows", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FDataTablePackedRowsTest::RunTest(const FString& Parameters)
+{
+	const int32 NumRows = 100;
+
+	FString CSV;
+	FString JSON;
+	DataTableTest::GenerateTables(NumRows, CSV, JSON);
+
+	// First, last and middle rows, a missing row past the end and the None name
+	const FName LookupNames[] = { FName(TEXT("Row"), 1), FName(TEXT("Row"), NumRows), FName(TEXT("Row"), NumRows / 2), FName(TEXT("Row"), NumRows + 1), NAME_None };
+
+	for (int32 FormatIdx = 0; FormatIdx < 2; ++FormatIdx)
+	{
+		const TCHAR* FormatName = FormatIdx == 0 ? TEXT("CSV") : TEXT("JSON");
+		UDataTable* MapTable = DataTableTest::CreateTable(false);
+		UDataTable* PackedTable = DataTableTest::CreateTable(true);
+
+		const TArray<FString> MapProblems = FormatIdx == 0 ? MapTable->CreateTableFromCSVString(CSV) : MapTable->CreateTableFromJSONString(JSON);
+		const TArray<FString> PackedProblems = FormatIdx == 0 ? PackedTable->CreateTableFromCSVString(CSV) : PackedTable->CreateTableFromJSONString(JSON);
+		TestTrue(FString::Printf(TEXT("%s import has no problems"), FormatName), MapProblems.Num() == 0 && PackedProblems.Num() == 0);
+		TestTrue(FString::Printf(TEXT("%s import creates all rows"), FormatName), MapTable->GetRowMap().Num() == NumRows && PackedTable->GetRowMap().Num() == NumRows);
+
+		// Packed rows keep the row order of the import
+		int32 RowIdx = 0;
+		bool bRowsInOrder = true;
+		for (const TPair<FName, uint8*>& TableRowPair : PackedTable->GetRowMap())
+		{
+			bRowsInOrder &= TableRowPair.Key == FName(TEXT("Row"), RowIdx + 1) && PackedTable->FindRowIndex(TableRowPair.Key) == RowIdx;
+			++RowIdx;
+		}
+		TestTrue(FString::Printf(TEXT("%s packed rows are indexed in import order"), FormatName), bRowsInOrder);
+
+		FTableRowBase* BatchedRows[UE_ARRAY_COUNT(LookupNames)];
+		PackedTable->FindRows<FTableRowBase>(LookupNames, BatchedRows, TEXT("DataTableTest"));
+		for (int32 LookupIdx = 0; LookupIdx < UE_ARRAY_COUNT(LookupNames); ++LookupIdx)
+		{
+			uint8* ExpectedRow = PackedTable->GetRowMap().FindRef(LookupNames[LookupIdx]);
+			TestTrue(FString::Printf(TEXT("%s lookup of %s matches the row map"), FormatName, *LookupNames[LookupIdx].ToString()), PackedTable->FindRowUnchecked(LookupNames[LookupIdx]) == ExpectedRow && (uint8*)BatchedRows[LookupIdx] == ExpectedRow);
+			TestEqual(FString::Printf(TEXT("%s lookup of %s finds a row in both tables"), FormatName, *LookupNames[LookupIdx].ToString()), MapTable->FindRowUnchecked(LookupNames[LookupIdx]) != nullptr, ExpectedRow != nullptr);
+		}
+
+		// Removing a row rebuilds the index, cached indices must look their row up again
+		const FName RemovedRowName(TEXT("Row"), 2);
+		const TDataTableRowIndex<FTableRowBase> KeptRowIndex(PackedTable, FName(TEXT("Row"), 3));
+		const TDataTableRowIndex<FTableRowBase> LastRowIndex(PackedTable, FName(TEXT("Row"), NumRows));
+		TestTrue(FString::Printf(TEXT("%s cached row index finds its row"), FormatName), (uint8*)KeptRowIndex.GetRow(TEXT("DataTableTest")) == PackedTable->GetRowMap().FindRef(KeptRowIndex.GetRowName()));
+
+		PackedTable->RemoveRow(RemovedRowName);
+		TestTrue(FString::Printf(TEXT("%s removed row is not indexed"), FormatName), PackedTable->FindRowIndex(RemovedRowName) == INDEX_NONE);
+		TestTrue(FString::Printf(TEXT("%s cached row index survives row removal"), FormatName), (uint8*)KeptRowIndex.GetRow(TEXT("DataTableTest")) == PackedTable->GetRowMap().FindRef(KeptRowIndex.GetRowName()));
+		TestTrue(FString::Printf(TEXT("%s cached index of the last row survives row removal"), FormatName), (uint8*)LastRowIndex.GetRow(TEXT("DataTableTest")) == PackedTable->GetRowMap().FindRef(LastRowIndex.GetRowName()));
+
+		MapTable->EmptyTable();
+		PackedTable->EmptyTable();
+		TestEqual(FString::Printf(TEXT("%s emptied packed table has no rows"), FormatName), PackedTable->GetRowMap().Num(), 0);
+		TestTrue(FString::Printf(TEXT("%s emptied packed table indexes nothing"), FormatName), PackedTable->FindRowIndex(FName(TEXT("Row"), 1)) == INDEX_NONE);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDataTablePackedRowsPerfTest, "System.Engine.DataTable.Packed Rows Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FDataTablePackedRowsPerfTest::RunTest(const FString& Parameters)
+{
+	const int32 NumRows = 50000;
+	const int32 NumLookups = 100000;
+
+	FString CSV;
+	FString JSON;
+	DataTableTest::GenerateItemTables(NumRows, CSV, JSON);
+
+	UScriptStruct* RowStruct = DataTableTest::CreateItemRowStruct();
+
+	// Stride through the rows with a step coprime to the range so that lookups jump around, an eighth of them miss
+	const int32 NumNames = NumRows + NumRows / 8;
+	TArray<FName> LookupNames;
+	LookupNames.Reserve(NumLookups);
+	for (int32 LookupIdx = 0; LookupIdx < NumLookups; ++LookupIdx)
+	{
+		LookupNames.Add(FName(TEXT("Row"), (int32)(((int64)LookupIdx * 7919) % NumNames) + 1));
+	}
+
+	TArray<uint8*> BatchedRows;
+	BatchedRows.SetNumUninitialized(NumLookups);
+
+	for (int32 FormatIdx = 0; FormatIdx < 2; ++FormatIdx)
+	{
+		const TCHAR* FormatName = FormatIdx == 0 ? TEXT("CSV") : TEXT("JSON");
+		UDataTable* MapTable = DataTableTest::CreateTable(false, RowStruct);
+		UDataTable* PackedTable = DataTableTest::CreateTable(true, RowStruct);
+
+		const uint64 MapImportStartCycles = FPlatformTime::Cycles64();
+		const TArray<FString> MapProblems = FormatIdx == 0 ? MapTable->CreateTableFromCSVString(CSV) : MapTable->CreateTableFromJSONString(JSON);
+		const double MapImportMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - MapImportStartCycles);
+
+		const uint64 PackedImportStartCycles = FPlatformTime::Cycles64();
+		const TArray<FString> PackedProblems = FormatIdx == 0 ? PackedTable->CreateTableFromCSVString(CSV) : PackedTable->CreateTableFromJSONString(JSON);
+		const double PackedImportMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PackedImportStartCycles);
+
+		TestTrue(FString::Printf(TEXT("%s import has no problems"), FormatName), MapProblems.Num() == 0 && PackedProblems.Num() == 0);
+
+		int32 NumMapRowsFound = 0;
+		const uint64 MapLookupStartCycles = FPlatformTime::Cycles64();
+		for (const FName& LookupName : LookupNames)
+		{
+			NumMapRowsFound += MapTable->FindRowUnchecked(LookupName) != nullptr ? 1 : 0;
+		}
+		const double MapLookupMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - MapLookupStartCycles);
+
+		int32 NumPackedRowsFound = 0;
+		const uint64 PackedLookupStartCycles = FPlatformTime::Cycles64();
+		for (const FName& LookupName : LookupNames)
+		{
+			NumPackedRowsFound += PackedTable->FindRowUnchecked(LookupName) != nullptr ? 1 : 0;
+		}
+		const double PackedLookupMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PackedLookupStartCycles);
+
+		const uint64 BatchedLookupStartCycles = FPlatformTime::Cycles64();
+		PackedTable->FindRowsUnchecked(LookupNames, BatchedRows);
+		const double BatchedLookupMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - BatchedLookupStartCycles);
+
+		// Positions of a few hot rows, cached and revalidated against the row index serial like TDataTableRowIndex does.
+		// The runtime row struct doesn't derive from FTableRowBase, so the typed TDataTableRowIndex can't be used here.
+		TArray<int32> HotRowIndices;
+		for (int32 RowIdx = 0; RowIdx < 64; ++RowIdx)
+		{
+			HotRowIndices.Add(PackedTable->FindRowIndex(FName(TEXT("Row"), RowIdx * (NumRows / 64) + 1)));
+		}
+		const uint32 RowIndexSerial = PackedTable->GetRowIndexSerial();
+
+		int32 NumIndexedRowsFound = 0;
+		const uint64 RowIndexStartCycles = FPlatformTime::Cycles64();
+		for (int32 LookupIdx = 0; LookupIdx < NumLookups; ++LookupIdx)
+		{
+			const int32 RowIndex = HotRowIndices[LookupIdx & 63];
+			NumIndexedRowsFound += RowIndex != INDEX_NONE && RowIndexSerial == PackedTable->GetRowIndexSerial() && PackedTable->GetRowDataByIndex(RowIndex) != nullptr ? 1 : 0;
+		}
+		const double RowIndexMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - RowIndexStartCycles);
+
+		TestEqual(FString::Printf(TEXT("%s packed lookups find the same rows as the map"), FormatName), NumPackedRowsFound, NumMapRowsFound);
+		TestEqual(FString::Printf(TEXT("%s cached row indices find their rows"), FormatName), NumIndexedRowsFound, NumLookups);
+
+		AddInfo(FString::Printf(TEXT("%s %d rows: import %.2f ms, packed %.2f ms; %d lookups map %.2f ms, packed %.2f ms, batched %.2f ms, cached row index %.2f ms"),
+			FormatName,
+			NumRows,
+			MapImportMs,
+			PackedImportMs,
+			NumLookups,
+			MapLookupMs,
+			PackedLookupMs,
+			BatchedLookupMs,
+			RowIndexMs));
+
+		MapTable->EmptyTable();
+		PackedTable->EmptyTable();
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDataTableSecondaryIndexTest, "System.Engine.DataTable.Secondary Index", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FDataTableSecondaryIndexTest::RunTest(const FString& Parameters)
+{
+	const int32 NumLevels = 10;
+
+	UScriptStruct* RowStruct = DataTableTest::CreateLevelRowStruct();
+	const FIntProperty* LevelProperty = CastField<FIntProperty>(RowStruct->FindPropertyByName(TEXT("Level")));
+	if (!TestNotNull(TEXT("Row struct has a Level column"), LevelProperty))
+	{
+		return false;
+	}
+
+	TArray<uint8> Row;
+	Row.SetNumZeroed(RowStruct->GetStructureSize());
+	RowStruct->InitializeStruct(Row.GetData());
+	auto MakeRow = [&Row, LevelProperty](int32 Level) -> const FTableRowBase&
+	{
+		LevelProperty->SetPropertyValue_InContainer(Row.GetData(), Level);
+		return *reinterpret_cast<const FTableRowBase*>(Row.GetData());
+	};
+
+	for (int32 PackRows = 0; PackRows < 2; ++PackRows)
+	{
+		const TCHAR* TableName = PackRows ? TEXT("Packed table") : TEXT("Table");
+
+		UDataTable* DataTable = NewObject<UDataTable>(GetTransientPackage());
+		DataTable->RowStruct = RowStruct;
+		DataTable->bPackRows = PackRows != 0;
+		DataTable->IndexedProperties.Add(LevelProperty->GetFName());
+
+		// Row_0 to Row_39 at levels 0 to 9, the index is built by the first change and updated by the next ones
+		for (int32 RowIdx = 0; RowIdx < 40; ++RowIdx)
+		{
+			DataTable->AddRow(FName(TEXT("Row"), RowIdx + 1), MakeRow(RowIdx % NumLevels));
+		}
+		TestTrue(FString::Printf(TEXT("%s indexes added rows"), TableName), DataTableTest::LevelIndexMatchesRows(DataTable, LevelProperty, NumLevels));
+
+		const FDataTableSecondaryIndex* SecondaryIndex = DataTable->FindSecondaryIndex(LevelProperty->GetFName());
+		TestTrue(FString::Printf(TEXT("%s finds rows in a range of levels"), TableName), SecondaryIndex && SecondaryIndex->GetEntriesInRange(FDataTableIndexKey(2.0), FDataTableIndexKey(4.0)).Num() == 12);
+		TestTrue(FString::Printf(TEXT("%s finds no rows outside of the levels"), TableName), SecondaryIndex && SecondaryIndex->GetEntriesInRange(FDataTableIndexKey(10.0), FDataTableIndexKey(20.0)).Num() == 0);
+
+		DataTable->AddRow(FName(TEXT("Row"), 1), MakeRow(9));
+		TestTrue(FString::Printf(TEXT("%s reindexes replaced rows"), TableName), DataTableTest::LevelIndexMatchesRows(DataTable, LevelProperty, NumLevels));
+
+		DataTable->RemoveRow(FName(TEXT("Row"), 2));
+		TestTrue(FString::Printf(TEXT("%s unindexes removed rows"), TableName), DataTableTest::LevelIndexMatchesRows(DataTable, LevelProperty, NumLevels));
+
+		// Rows changed in place are sorted under their old level until they are passed to AddRow, removing them must still drop their entry
+		uint8* EditedRow = DataTable->FindRowUnchecked(FName(TEXT("Row"), 3));
+		LevelProperty->SetPropertyValue_InContainer(EditedRow, 7);
+		DataTable->RemoveRow(FName(TEXT("Row"), 3));
+		TestTrue(FString::Printf(TEXT("%s unindexes rows removed after changing in place"), TableName), DataTableTest::LevelIndexMatchesRows(DataTable, LevelProperty, NumLevels));
+
+		EditedRow = DataTable->FindRowUnchecked(FName(TEXT("Row"), 4));
+		LevelProperty->SetPropertyValue_InContainer(EditedRow, 8);
+		DataTable->AddRow(FName(TEXT("Row"), 4), MakeRow(8));
+		TestTrue(FString::Printf(TEXT("%s reindexes rows changed in place and added again"), TableName), DataTableTest::LevelIndexMatchesRows(DataTable, LevelProperty, NumLevels));
+
+		DataTable->EmptyTable();
+		TestTrue(FString::Printf(TEXT("%s index is empty with the table"), TableName), DataTable->FindSecondaryIndex(LevelProperty->GetFName()) == nullptr || DataTable->FindSecondaryIndex(LevelProperty->GetFName())->Entries.Num() == 0);
+	}
+
+	RowStruct->DestroyStruct(Row.GetData());
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
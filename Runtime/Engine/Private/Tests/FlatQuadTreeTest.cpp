@@ -0,0 +1,208 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "GenericQuadTree.h"
+#include "FlatQuadTree.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FlatQuadTreeTest
+{
+	// Returns the elements whose box intersects the query box, sorted, by testing every element.
+	static TArray<int32> GetElementsBruteForce(const TArray<FBox2D>& Boxes, const FBox2D& QueryBox)
+	{
+		TArray<int32> Result;
+		for (int32 Index = 0; Index < Boxes.Num(); ++Index)
+		{
+			if (Boxes[Index].Intersect(QueryBox))
+			{
+				Result.Add(Index);
+			}
+		}
+		return Result;
+	}
+
+	static TArray<int32> GetElementsSorted(const TFlatQuadTree<int32>& Tree, const FBox2D& QueryBox)
+	{
+		TArray<int32> Result;
+		Tree.GetElements(QueryBox, Result);
+		Result.Sort();
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlatQuadTreeTest, "System.Engine.QuadTree.Flat QuadTree", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FFlatQuadTreeTest::RunTest(const FString& Parameters)
+{
+	TFlatQuadTree<int32> EmptyTree;
+	EmptyTree.Build(TArray<int32>(), TArray<FBox2D>());
+	TestEqual(TEXT("An empty tree returns nothing"), FlatQuadTreeTest::GetElementsSorted(EmptyTree, FBox2D(FVector2D(-10.f, -10.f), FVector2D(10.f, 10.f))).Num(), 0);
+
+	// A 32x32 grid of unit boxes two units apart, so that the tree splits down to leaves, plus a few boxes spanning many cells
+	const int32 GridSize = 32;
+	TArray<int32> Elements;
+	TArray<FBox2D> Boxes;
+	for (int32 Y = 0; Y < GridSize; ++Y)
+	{
+		for (int32 X = 0; X < GridSize; ++X)
+		{
+			const FVector2D Min(X * 2.f, Y * 2.f);
+			Elements.Add(Boxes.Num());
+			Boxes.Add(FBox2D(Min, Min + FVector2D(1.f, 1.f)));
+		}
+	}
+	Elements.Add(Boxes.Num());
+	Boxes.Add(FBox2D(FVector2D(0.5f, 0.5f), FVector2D(62.5f, 62.5f)));
+	Elements.Add(Boxes.Num());
+	Boxes.Add(FBox2D(FVector2D(10.5f, 40.5f), FVector2D(30.5f, 41.5f)));
+	Elements.Add(Boxes.Num());
+	Boxes.Add(FBox2D(FVector2D(-20.f, -20.f), FVector2D(-10.f, -10.f)));
+
+	TFlatQuadTree<int32> Tree;
+	Tree.Build(Elements, Boxes);
+
+	const FBox2D QueryBoxes[] =
+	{
+		// Inside a single grid box
+		FBox2D(FVector2D(4.25f, 6.25f), FVector2D(4.75f, 6.75f)),
+		// In the gap between grid boxes, only the large box covers it
+		FBox2D(FVector2D(1.25f, 1.25f), FVector2D(1.75f, 1.75f)),
+		// Spanning a 3x2 block of grid boxes and the thin box
+		FBox2D(FVector2D(19.5f, 39.5f), FVector2D(24.5f, 42.5f)),
+		// Covering everything
+		FBox2D(FVector2D(-100.f, -100.f), FVector2D(100.f, 100.f)),
+		// Outside the grid, only the isolated box
+		FBox2D(FVector2D(-15.f, -15.f), FVector2D(-12.f, -12.f)),
+		// Outside every box
+		FBox2D(FVector2D(200.f, 200.f), FVector2D(300.f, 300.f)),
+	};
+
+	for (int32 QueryIndex = 0; QueryIndex < UE_ARRAY_COUNT(QueryBoxes); ++QueryIndex)
+	{
+		const TArray<int32> Expected = FlatQuadTreeTest::GetElementsBruteForce(Boxes, QueryBoxes[QueryIndex]);
+		TestTrue(FString::Printf(TEXT("Query %d returns exactly the intersecting elements"), QueryIndex), FlatQuadTreeTest::GetElementsSorted(Tree, QueryBoxes[QueryIndex]) == Expected);
+	}
+	TestEqual(TEXT("The covering query returns every element"), FlatQuadTreeTest::GetElementsSorted(Tree, QueryBoxes[3]).Num(), Boxes.Num());
+
+	// Batched queries return each query's elements in their own range
+	TArray<int32> BatchedElements;
+	TArray<int32> BatchedOffsets;
+	Tree.GetElements(MakeArrayView(QueryBoxes, UE_ARRAY_COUNT(QueryBoxes)), BatchedElements, BatchedOffsets);
+	if (TestEqual(TEXT("Batched queries return one offset per query plus the end"), BatchedOffsets.Num(), (int32)UE_ARRAY_COUNT(QueryBoxes) + 1))
+	{
+		for (int32 QueryIndex = 0; QueryIndex < UE_ARRAY_COUNT(QueryBoxes); ++QueryIndex)
+		{
+			TArray<int32> Batched(BatchedElements.GetData() + BatchedOffsets[QueryIndex], BatchedOffsets[QueryIndex + 1] - BatchedOffsets[QueryIndex]);
+			Batched.Sort();
+			TestTrue(FString::Printf(TEXT("Batched query %d matches the single query"), QueryIndex), Batched == FlatQuadTreeTest::GetElementsBruteForce(Boxes, QueryBoxes[QueryIndex]));
+		}
+	}
+
+	// Serialization round trip
+	TArray<uint8> SavedTree;
+	FMemoryWriter Writer(SavedTree);
+	Tree.Serialize(Writer);
+
+	TFlatQuadTree<int32> LoadedTree;
+	FMemoryReader Reader(SavedTree);
+	LoadedTree.Serialize(Reader);
+	TestTrue(TEXT("A loaded tree answers queries like the saved one"), FlatQuadTreeTest::GetElementsSorted(LoadedTree, QueryBoxes[2]) == FlatQuadTreeTest::GetElementsSorted(Tree, QueryBoxes[2]));
+
+	// Rebuilding replaces the previous content
+	Tree.Build(MakeArrayView(Elements.GetData(), 1), MakeArrayView(Boxes.GetData(), 1));
+	TestEqual(TEXT("A rebuilt tree only holds the new elements"), FlatQuadTreeTest::GetElementsSorted(Tree, QueryBoxes[3]).Num(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlatQuadTreePerfTest, "System.Engine.QuadTree.Flat QuadTree Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FFlatQuadTreePerfTest::RunTest(const FString& Parameters)
+{
+	const int32 ElementCounts[] = { 10000, 100000, 1000000 };
+	const int32 NumQueries = 4096;
+	const float WorldSize = 2000000.f;
+
+	// Golden ratio sequences spread the elements and queries evenly and deterministically, in double so that they stay spread at a million elements
+	const auto Spread = [WorldSize](int32 Index, double Ratio) { return (float)(FMath::Frac(Index * Ratio) * WorldSize); };
+
+	for (const int32 NumElements : ElementCounts)
+	{
+		// Keep the density constant so that queries return a similar number of elements at every scale
+		const float ElementSize = WorldSize / FMath::Sqrt((float)NumElements);
+
+		TArray<int32> Elements;
+		TArray<FBox2D> Boxes;
+		Elements.Reserve(NumElements);
+		Boxes.Reserve(NumElements);
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			const FVector2D Min(Spread(Index, 0.6180339887), Spread(Index, 0.7548776662));
+			Elements.Add(Index);
+			Boxes.Add(FBox2D(Min, Min + FVector2D(ElementSize, ElementSize) * (0.25f + (float)FMath::Frac(Index * 0.5698402910))));
+		}
+
+		TArray<FBox2D> QueryBoxes;
+		QueryBoxes.Reserve(NumQueries);
+		for (int32 Index = 0; Index < NumQueries; ++Index)
+		{
+			const FVector2D Min(Spread(Index, 0.7548776662), Spread(Index, 0.6180339887));
+			QueryBoxes.Add(FBox2D(Min, Min + FVector2D(4.f * ElementSize, 4.f * ElementSize)));
+		}
+
+		const uint64 ReferenceBuildStartCycles = FPlatformTime::Cycles64();
+		TQuadTree<int32> ReferenceTree(FBox2D(FVector2D(0.f, 0.f), FVector2D(2.f * WorldSize, 2.f * WorldSize)));
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			ReferenceTree.Insert(Elements[Index], Boxes[Index]);
+		}
+		const double ReferenceBuildMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ReferenceBuildStartCycles);
+
+		const uint64 FlatBuildStartCycles = FPlatformTime::Cycles64();
+		TFlatQuadTree<int32> FlatTree;
+		FlatTree.Build(Elements, Boxes);
+		const double FlatBuildMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FlatBuildStartCycles);
+
+		TArray<int32> QueryResults;
+		int32 NumReferenceResults = 0;
+		const uint64 ReferenceQueryStartCycles = FPlatformTime::Cycles64();
+		for (const FBox2D& QueryBox : QueryBoxes)
+		{
+			QueryResults.Reset();
+			ReferenceTree.GetElements(QueryBox, QueryResults);
+			NumReferenceResults += QueryResults.Num();
+		}
+		const double ReferenceQueryMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ReferenceQueryStartCycles);
+
+		int32 NumFlatResults = 0;
+		const uint64 FlatQueryStartCycles = FPlatformTime::Cycles64();
+		for (const FBox2D& QueryBox : QueryBoxes)
+		{
+			QueryResults.Reset();
+			FlatTree.GetElements(QueryBox, QueryResults);
+			NumFlatResults += QueryResults.Num();
+		}
+		const double FlatQueryMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FlatQueryStartCycles);
+
+		TArray<int32> BatchedOffsets;
+		QueryResults.Reset();
+		const uint64 BatchedQueryStartCycles = FPlatformTime::Cycles64();
+		FlatTree.GetElements(QueryBoxes, QueryResults, BatchedOffsets);
+		const double BatchedQueryMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - BatchedQueryStartCycles);
+
+		TestEqual(FString::Printf(TEXT("Both trees return the same number of elements (%d elements)"), NumElements), NumFlatResults, NumReferenceResults);
+		TestEqual(FString::Printf(TEXT("Batched queries return the same number of elements (%d elements)"), NumElements), QueryResults.Num(), NumReferenceResults);
+
+		AddInfo(FString::Printf(TEXT("%d elements: build TQuadTree %.2f ms, flat %.2f ms; %d queries TQuadTree %.2f ms, flat %.2f ms, batched %.2f ms; flat tree %.1f KB"),
+			NumElements, ReferenceBuildMs, FlatBuildMs, NumQueries, ReferenceQueryMs, FlatQueryMs, BatchedQueryMs, FlatTree.GetAllocatedSize() / 1024.0));
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
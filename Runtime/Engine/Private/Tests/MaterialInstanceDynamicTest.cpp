@@ -0,0 +1,175 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MaterialInstanceDynamicTest
+{
+	// Returns whether both instances override the same scalar and vector parameters with the same values.
+	static bool HaveSameParameterValues(const UMaterialInstanceDynamic* A, const UMaterialInstanceDynamic* B)
+	{
+		if (A->ScalarParameterValues.Num() != B->ScalarParameterValues.Num() || A->VectorParameterValues.Num() != B->VectorParameterValues.Num())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < A->ScalarParameterValues.Num(); ++Index)
+		{
+			if (A->ScalarParameterValues[Index].ParameterInfo != B->ScalarParameterValues[Index].ParameterInfo || A->ScalarParameterValues[Index].ParameterValue != B->ScalarParameterValues[Index].ParameterValue)
+			{
+				return false;
+			}
+		}
+		for (int32 Index = 0; Index < A->VectorParameterValues.Num(); ++Index)
+		{
+			if (A->VectorParameterValues[Index].ParameterInfo != B->VectorParameterValues[Index].ParameterInfo || A->VectorParameterValues[Index].ParameterValue != B->VectorParameterValues[Index].ParameterValue)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static void MakeParameterInfos(const TCHAR* BaseName, int32 NumParameters, TArray<FMaterialParameterInfo>& OutInfos)
+	{
+		for (int32 Index = 0; Index < NumParameters; ++Index)
+		{
+			OutInfos.Emplace(FName(BaseName, Index + 1));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMaterialInstanceDynamicParametersTest, "System.Engine.Materials.Dynamic Instance Parameters", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMaterialInstanceDynamicParametersTest::RunTest(const FString& Parameters)
+{
+	UMaterial* Material = UMaterial::GetDefaultMaterial(MD_Surface);
+	UMaterialInstanceDynamic* SingleMID = UMaterialInstanceDynamic::Create(Material, GetTransientPackage());
+	UMaterialInstanceDynamic* BatchedMID = UMaterialInstanceDynamic::Create(Material, GetTransientPackage());
+
+	TArray<FMaterialParameterInfo> ScalarInfos;
+	TArray<FMaterialParameterInfo> VectorInfos;
+	MaterialInstanceDynamicTest::MakeParameterInfos(TEXT("Scalar"), 4, ScalarInfos);
+	MaterialInstanceDynamicTest::MakeParameterInfos(TEXT("Vector"), 2, VectorInfos);
+
+	// A layer parameter shares its name with a global one but is a separate override
+	const FName LayerScalarName = ScalarInfos[0].Name;
+	ScalarInfos.Emplace(LayerScalarName, LayerParameter, 0);
+
+	const float ScalarValues[] = { 0.25f, -1.0f, 3.5f, 0.0f, 8.0f };
+	const FLinearColor VectorValues[] = { FLinearColor::Red, FLinearColor(0.1f, 0.2f, 0.3f, 0.4f) };
+
+	for (int32 Index = 0; Index < ScalarInfos.Num(); ++Index)
+	{
+		SingleMID->SetScalarParameterValueByInfo(ScalarInfos[Index], ScalarValues[Index]);
+	}
+	for (int32 Index = 0; Index < VectorInfos.Num(); ++Index)
+	{
+		SingleMID->SetVectorParameterValueByInfo(VectorInfos[Index], VectorValues[Index]);
+	}
+
+	BatchedMID->SetParameterValues(ScalarInfos, ScalarValues, VectorInfos, VectorValues);
+	TestTrue(TEXT("Batched parameters are added like the single setters add them"), MaterialInstanceDynamicTest::HaveSameParameterValues(SingleMID, BatchedMID));
+	TestEqual(TEXT("Global and layer parameters of the same name are separate overrides"), BatchedMID->ScalarParameterValues.Num(), ScalarInfos.Num());
+	TestEqual(TEXT("Global parameter keeps its own value"), BatchedMID->K2_GetScalarParameterValueByInfo(ScalarInfos[0]), ScalarValues[0]);
+	TestEqual(TEXT("Layer parameter keeps its own value"), BatchedMID->K2_GetScalarParameterValueByInfo(ScalarInfos[4]), ScalarValues[4]);
+
+	// Updating a subset changes those values only, in place
+	const FMaterialParameterInfo UpdatedScalarInfos[] = { ScalarInfos[2], ScalarInfos[0] };
+	const float UpdatedScalarValues[] = { -7.0f, 1.5f };
+	SingleMID->SetScalarParameterValueByInfo(UpdatedScalarInfos[0], UpdatedScalarValues[0]);
+	SingleMID->SetScalarParameterValueByInfo(UpdatedScalarInfos[1], UpdatedScalarValues[1]);
+	BatchedMID->SetScalarParameterValues(UpdatedScalarInfos, UpdatedScalarValues);
+	TestTrue(TEXT("Batched updates match the single setters"), MaterialInstanceDynamicTest::HaveSameParameterValues(SingleMID, BatchedMID));
+	TestEqual(TEXT("Updated parameters are not added again"), BatchedMID->ScalarParameterValues.Num(), ScalarInfos.Num());
+	TestEqual(TEXT("Layer parameter is not changed by updating the global one"), BatchedMID->K2_GetScalarParameterValueByInfo(ScalarInfos[4]), ScalarValues[4]);
+
+	const FLinearColor UpdatedVectorValue = FLinearColor::Blue;
+	SingleMID->SetVectorParameterValue(VectorInfos[1].Name, UpdatedVectorValue);
+	BatchedMID->SetVectorParameterValues(MakeArrayView(&VectorInfos[1], 1), MakeArrayView(&UpdatedVectorValue, 1));
+	TestTrue(TEXT("Batched vector update matches the single setter"), MaterialInstanceDynamicTest::HaveSameParameterValues(SingleMID, BatchedMID));
+
+	// Parameters cleared or copied behind the index maps must still be found
+	BatchedMID->ClearParameterValues();
+	TestEqual(TEXT("Cleared instance has no scalar overrides"), BatchedMID->ScalarParameterValues.Num(), 0);
+	BatchedMID->SetScalarParameterValue(ScalarInfos[1].Name, 2.0f);
+	TestTrue(TEXT("Parameter set after clearing is added once"), BatchedMID->ScalarParameterValues.Num() == 1 && BatchedMID->K2_GetScalarParameterValue(ScalarInfos[1].Name) == 2.0f);
+
+	BatchedMID->CopyParameterOverrides(SingleMID);
+	TestTrue(TEXT("Copied parameters match the source"), MaterialInstanceDynamicTest::HaveSameParameterValues(SingleMID, BatchedMID));
+	BatchedMID->SetScalarParameterValue(ScalarInfos[3].Name, 4.0f);
+	TestTrue(TEXT("Copied parameters are updated rather than added"), BatchedMID->ScalarParameterValues.Num() == ScalarInfos.Num() && BatchedMID->K2_GetScalarParameterValue(ScalarInfos[3].Name) == 4.0f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMaterialInstanceDynamicParametersPerfTest, "System.Engine.Materials.Dynamic Instance Parameters Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FMaterialInstanceDynamicParametersPerfTest::RunTest(const FString& Parameters)
+{
+	const int32 NumScalars = 24;
+	const int32 NumVectors = 8;
+	const int32 NumFrames = 200;
+
+	UMaterial* Material = UMaterial::GetDefaultMaterial(MD_Surface);
+	UMaterialInstanceDynamic* SingleMID = UMaterialInstanceDynamic::Create(Material, GetTransientPackage());
+	UMaterialInstanceDynamic* BatchedMID = UMaterialInstanceDynamic::Create(Material, GetTransientPackage());
+
+	TArray<FMaterialParameterInfo> ScalarInfos;
+	TArray<FMaterialParameterInfo> VectorInfos;
+	MaterialInstanceDynamicTest::MakeParameterInfos(TEXT("Scalar"), NumScalars, ScalarInfos);
+	MaterialInstanceDynamicTest::MakeParameterInfos(TEXT("Vector"), NumVectors, VectorInfos);
+
+	TArray<float> ScalarValues;
+	TArray<FLinearColor> VectorValues;
+	ScalarValues.SetNumZeroed(NumScalars);
+	VectorValues.SetNumZeroed(NumVectors);
+
+	double SingleMs = 0.0;
+	double BatchedMs = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		// Most parameters change every frame, every eighth one keeps its value
+		for (int32 Index = 0; Index < NumScalars; ++Index)
+		{
+			if ((Index + Frame) % 8 != 0)
+			{
+				ScalarValues[Index] = FMath::Frac((Frame * NumScalars + Index) * 0.618034f);
+			}
+		}
+		for (int32 Index = 0; Index < NumVectors; ++Index)
+		{
+			if ((Index + Frame) % 8 != 0)
+			{
+				VectorValues[Index] = FLinearColor(FMath::Frac(Frame * 0.618034f), FMath::Frac(Index * 0.754878f), FMath::Frac((Frame + Index) * 0.569840f), 1.0f);
+			}
+		}
+
+		const uint64 SingleStartCycles = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < NumScalars; ++Index)
+		{
+			SingleMID->SetScalarParameterValue(ScalarInfos[Index].Name, ScalarValues[Index]);
+		}
+		for (int32 Index = 0; Index < NumVectors; ++Index)
+		{
+			SingleMID->SetVectorParameterValue(VectorInfos[Index].Name, VectorValues[Index]);
+		}
+		SingleMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SingleStartCycles);
+
+		const uint64 BatchedStartCycles = FPlatformTime::Cycles64();
+		BatchedMID->SetParameterValues(ScalarInfos, ScalarValues, VectorInfos, VectorValues);
+		BatchedMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - BatchedStartCycles);
+	}
+	TestTrue(TEXT("Batched parameter values match the single setters"), MaterialInstanceDynamicTest::HaveSameParameterValues(SingleMID, BatchedMID));
+
+	AddInfo(FString::Printf(TEXT("%d frames of %d scalar and %d vector parameters: single setters %.2f ms, batched %.2f ms"), NumFrames, NumScalars, NumVectors, SingleMs, BatchedMs));
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
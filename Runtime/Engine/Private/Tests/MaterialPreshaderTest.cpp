@@ -0,0 +1,397 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialUniformExpressions.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MaterialPreshaderTest
+{
+	// Builds a random tree of math on parameters and constants, as the translator generates for material graphs. Parameters are added to OutSet.
+	static FMaterialUniformExpression* GenerateExpression(FRandomStream& RandomStream, int32 Depth, int32 NumScalarParameters, int32 NumVectorParameters, FUniformExpressionSet& OutSet)
+	{
+		if (Depth == 0 || RandomStream.RandRange(0, 3) == 0)
+		{
+			switch (RandomStream.RandRange(0, 3))
+			{
+			case 0:
+			{
+				const FMaterialParameterInfo ParameterInfo(FName(TEXT("Scalar"), RandomStream.RandRange(1, NumScalarParameters)));
+				return new FMaterialUniformExpressionScalarParameter(ParameterInfo, OutSet.FindOrAddScalarParameter(ParameterInfo, 0.5f));
+			}
+			case 1:
+			{
+				const FMaterialParameterInfo ParameterInfo(FName(TEXT("Vector"), RandomStream.RandRange(1, NumVectorParameters)));
+				return new FMaterialUniformExpressionVectorParameter(ParameterInfo, OutSet.FindOrAddVectorParameter(ParameterInfo, FLinearColor::White));
+			}
+			default:
+			{
+				const FLinearColor Value(RandomStream.FRandRange(-4.0f, 4.0f), RandomStream.FRandRange(-4.0f, 4.0f), RandomStream.FRandRange(-4.0f, 4.0f), RandomStream.FRandRange(-4.0f, 4.0f));
+				return new FMaterialUniformExpressionConstant(Value, MCT_Float4);
+			}
+			}
+		}
+
+		const int32 Operation = RandomStream.RandRange(0, 5);
+		FMaterialUniformExpression* A = GenerateExpression(RandomStream, Depth - 1, NumScalarParameters, NumVectorParameters, OutSet);
+		switch (Operation)
+		{
+		case 0:
+		case 1:
+		case 2:
+		{
+			const uint8 FoldedMathOperations[] = { FMO_Add, FMO_Sub, FMO_Mul };
+			FMaterialUniformExpression* B = GenerateExpression(RandomStream, Depth - 1, NumScalarParameters, NumVectorParameters, OutSet);
+			return new FMaterialUniformExpressionFoldedMath(A, B, FoldedMathOperations[Operation], MCT_Float4);
+		}
+		case 3:
+		{
+			FMaterialUniformExpression* B = GenerateExpression(RandomStream, Depth - 1, NumScalarParameters, NumVectorParameters, OutSet);
+			return new FMaterialUniformExpressionMax(A, B);
+		}
+		case 4:
+			return new FMaterialUniformExpressionSaturate(A);
+		default:
+			return new FMaterialUniformExpressionSine(A, true);
+		}
+	}
+
+	// Writes the opcodes of each expression as its own preshader.
+	static void WritePreshaders(TArrayView<const TRefCountPtr<FMaterialUniformExpression>> Expressions, FMaterialPreshaderData& OutData, TArray<FMaterialUniformPreshaderHeader>& OutPreshaders)
+	{
+		for (const TRefCountPtr<FMaterialUniformExpression>& Expression : Expressions)
+		{
+			FMaterialUniformPreshaderHeader& Preshader = OutPreshaders.AddDefaulted_GetRef();
+			Preshader.OpcodeOffset = OutData.Num();
+			Expression->WriteNumberOpcodes(OutData);
+			Preshader.OpcodeSize = OutData.Num() - Preshader.OpcodeOffset;
+		}
+	}
+
+	// Returns optimized copies of Data and Preshaders.
+	static void OptimizePreshaders(const FMaterialPreshaderData& Data, const TArray<FMaterialUniformPreshaderHeader>& Preshaders, FMaterialPreshaderData& OutData, TArray<FMaterialUniformPreshaderHeader>& OutPreshaders)
+	{
+		OutData = Data;
+		OutPreshaders = Preshaders;
+		TArray<FMaterialUniformPreshaderHeader*> PreshaderPtrs;
+		for (FMaterialUniformPreshaderHeader& Preshader : OutPreshaders)
+		{
+			PreshaderPtrs.Add(&Preshader);
+		}
+		OptimizeMaterialPreshaders(OutData, PreshaderPtrs);
+	}
+
+	// Render proxy returning the parameter values set by the test, counting how many times parameters are looked up.
+	class FTestMaterialRenderProxy : public FMaterialRenderProxy
+	{
+	public:
+		explicit FTestMaterialRenderProxy(const FMaterial& InMaterial)
+			: Material(InMaterial)
+			, NumScalarLookups(0)
+			, NumVectorLookups(0)
+		{
+		}
+
+		virtual const FMaterial& GetMaterialWithFallback(ERHIFeatureLevel::Type InFeatureLevel, const FMaterialRenderProxy*& OutFallbackMaterialRenderProxy) const override
+		{
+			return Material;
+		}
+
+		virtual bool GetVectorValue(const FHashedMaterialParameterInfo& ParameterInfo, FLinearColor* OutValue, const FMaterialRenderContext& Context) const override
+		{
+			++NumVectorLookups;
+			if (const FLinearColor* Value = VectorValues.Find(ScriptNameToName(ParameterInfo.Name)))
+			{
+				*OutValue = *Value;
+				return true;
+			}
+			return false;
+		}
+
+		virtual bool GetScalarValue(const FHashedMaterialParameterInfo& ParameterInfo, float* OutValue, const FMaterialRenderContext& Context) const override
+		{
+			++NumScalarLookups;
+			if (const float* Value = ScalarValues.Find(ScriptNameToName(ParameterInfo.Name)))
+			{
+				*OutValue = *Value;
+				return true;
+			}
+			return false;
+		}
+
+		virtual bool GetTextureValue(const FHashedMaterialParameterInfo& ParameterInfo, const UTexture** OutValue, const FMaterialRenderContext& Context) const override
+		{
+			return false;
+		}
+
+		virtual bool GetTextureValue(const FHashedMaterialParameterInfo& ParameterInfo, const URuntimeVirtualTexture** OutValue, const FMaterialRenderContext& Context) const override
+		{
+			return false;
+		}
+
+		void ResetLookups()
+		{
+			NumScalarLookups = 0;
+			NumVectorLookups = 0;
+		}
+
+		const FMaterial& Material;
+		TMap<FName, float> ScalarValues;
+		TMap<FName, FLinearColor> VectorValues;
+		mutable int32 NumScalarLookups;
+		mutable int32 NumVectorLookups;
+	};
+
+	// Evaluates the expressions of the set a number of times, returns the time it took in milliseconds.
+	static double EvaluateExpressionSet(const FUniformExpressionSet& Set, const FMaterialRenderContext& Context, bool bCacheParameters, int32 NumIterations, TArray<FLinearColor>& OutVectorValues, TArray<float>& OutScalarValues)
+	{
+		OutVectorValues.SetNumZeroed(Set.GetNumVectorPreshaders());
+		OutScalarValues.SetNumZeroed(Set.GetNumScalarPreshaders());
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Set.EvaluatePreshaders(Context, OutVectorValues, OutScalarValues, bCacheParameters);
+		}
+		return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	static const FMaterialResource* GetDefaultMaterialResource(FAutomationTestBase& Test)
+	{
+		const FMaterialResource* MaterialResource = UMaterial::GetDefaultMaterial(MD_Surface)->GetMaterialResource(GMaxRHIFeatureLevel);
+		if (!MaterialResource)
+		{
+			Test.AddError(TEXT("Default surface material has no resource to evaluate preshaders with"));
+		}
+		return MaterialResource;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMaterialPreshaderOptimizationTest, "System.Engine.Materials.Preshader Optimization", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMaterialPreshaderOptimizationTest::RunTest(const FString& Parameters)
+{
+	const FMaterialResource* MaterialResource = MaterialPreshaderTest::GetDefaultMaterialResource(*this);
+	if (!MaterialResource)
+	{
+		return false;
+	}
+	const FMaterialRenderContext Context(nullptr, *MaterialResource, nullptr);
+
+	const FLinearColor A(1.0f, 2.0f, 3.0f, 4.0f);
+	const FLinearColor B(0.5f, -2.0f, 0.25f, 1.0f);
+	auto MakeConstant = [](const FLinearColor& Value) { return new FMaterialUniformExpressionConstant(Value, MCT_Float4); };
+	auto MakeMath = [](FMaterialUniformExpression* X, FMaterialUniformExpression* Y, uint8 Operation) { return new FMaterialUniformExpressionFoldedMath(X, Y, Operation, MCT_Float4); };
+
+	enum { Folded, Zero, NegativeZero, Parameter, FoldedAgain, Nested, NumPreshaders };
+	TRefCountPtr<FMaterialUniformExpression> Expressions[NumPreshaders];
+	Expressions[Folded] = MakeMath(MakeConstant(A), MakeConstant(B), FMO_Add);
+	Expressions[Zero] = MakeMath(MakeConstant(A), MakeConstant(A), FMO_Sub);
+	Expressions[NegativeZero] = MakeMath(MakeConstant(FLinearColor(-1.0f, -1.0f, -1.0f, -1.0f)), MakeConstant(FLinearColor(0.0f, 0.0f, 0.0f, 0.0f)), FMO_Mul);
+	Expressions[Parameter] = MakeMath(new FMaterialUniformExpressionScalarParameter(FMaterialParameterInfo(TEXT("Scalar")), 0), MakeMath(MakeConstant(A), MakeConstant(B), FMO_Mul), FMO_Add);
+	Expressions[FoldedAgain] = MakeMath(MakeConstant(A), MakeConstant(B), FMO_Add);
+	Expressions[Nested] = new FMaterialUniformExpressionSine(new FMaterialUniformExpressionSaturate(new FMaterialUniformExpressionMax(MakeConstant(A), MakeConstant(B))), false);
+
+	FMaterialPreshaderData Data;
+	TArray<FMaterialUniformPreshaderHeader> Preshaders;
+	MaterialPreshaderTest::WritePreshaders(Expressions, Data, Preshaders);
+
+	FMaterialPreshaderData OptimizedData;
+	TArray<FMaterialUniformPreshaderHeader> OptimizedPreshaders;
+	MaterialPreshaderTest::OptimizePreshaders(Data, Preshaders, OptimizedData, OptimizedPreshaders);
+
+	auto GetFirstOpcode = [&OptimizedData, &OptimizedPreshaders](int32 PreshaderIndex) { return (EMaterialPreshaderOpcode)OptimizedData.Data[OptimizedPreshaders[PreshaderIndex].OpcodeOffset]; };
+	const uint32 ConstantSize = 1 + sizeof(FLinearColor);
+
+	TestTrue(TEXT("Math on constants folds into a single constant"), OptimizedPreshaders[Folded].OpcodeSize == ConstantSize && GetFirstOpcode(Folded) == EMaterialPreshaderOpcode::Constant);
+	TestTrue(TEXT("Math on constants folds across nested operations"), OptimizedPreshaders[Nested].OpcodeSize == ConstantSize && GetFirstOpcode(Nested) == EMaterialPreshaderOpcode::Constant);
+	TestTrue(TEXT("Folded zero is written as ConstantZero"), OptimizedPreshaders[Zero].OpcodeSize == 1 && GetFirstOpcode(Zero) == EMaterialPreshaderOpcode::ConstantZero);
+	TestTrue(TEXT("Folded negative zero stays a constant"), GetFirstOpcode(NegativeZero) == EMaterialPreshaderOpcode::Constant);
+
+	// Only the constant operand of the parameter is folded: ScalarParameter, Constant, Add
+	TestTrue(TEXT("Parameters are not folded"), GetFirstOpcode(Parameter) == EMaterialPreshaderOpcode::ScalarParameter);
+	TestTrue(TEXT("Constant operands of parameters are folded"), OptimizedPreshaders[Parameter].OpcodeSize == 1 + sizeof(uint16) + ConstantSize + 1);
+
+	TestTrue(TEXT("Identical preshaders share their opcodes"), OptimizedPreshaders[FoldedAgain].OpcodeOffset == OptimizedPreshaders[Folded].OpcodeOffset);
+	TestTrue(TEXT("Optimized preshaders are smaller"), OptimizedData.Num() < Data.Num());
+
+	// Folding evaluates the same operations as the interpreter, results must be identical rather than close
+	const int32 ConstantPreshaders[] = { Folded, Zero, NegativeZero, FoldedAgain, Nested };
+	for (const int32 PreshaderIndex : ConstantPreshaders)
+	{
+		FLinearColor Value;
+		FLinearColor OptimizedValue;
+		EvaluateMaterialPreshader(nullptr, Context, Data, Preshaders[PreshaderIndex], Value);
+		EvaluateMaterialPreshader(nullptr, Context, OptimizedData, OptimizedPreshaders[PreshaderIndex], OptimizedValue);
+		TestTrue(FString::Printf(TEXT("Optimized preshader %d evaluates to the same value"), PreshaderIndex), FMemory::Memcmp(&Value, &OptimizedValue, sizeof(FLinearColor)) == 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMaterialPreshaderParameterCacheTest, "System.Engine.Materials.Preshader Parameter Cache", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMaterialPreshaderParameterCacheTest::RunTest(const FString& Parameters)
+{
+	const FMaterialResource* MaterialResource = MaterialPreshaderTest::GetDefaultMaterialResource(*this);
+	if (!MaterialResource)
+	{
+		return false;
+	}
+
+	const FMaterialParameterInfo RoughnessInfo(TEXT("Roughness"));
+	const FMaterialParameterInfo TintInfo(TEXT("Tint"));
+	const FMaterialParameterInfo UnsetInfo(TEXT("Unset"));
+	const FLinearColor A(1.0f, 2.0f, 3.0f, 4.0f);
+	const FLinearColor B(0.5f, -2.0f, 0.25f, 1.0f);
+
+	// Roughness is read by most preshaders, Unset is never given a value by the proxy and falls back to its default
+	enum { TintTimesRoughness, TintPlusConstant, NumVectorPreshaders };
+	enum { RoughnessTimesTwo, RoughnessPlusConstant, UnsetTimesFour, RoughnessTimesTwoAgain, NumScalarPreshaders };
+	FUniformExpressionSet Set;
+	FUniformExpressionSet OptimizedSet;
+	FUniformExpressionSet* const Sets[] = { &Set, &OptimizedSet };
+	for (FUniformExpressionSet* BuiltSet : Sets)
+	{
+		TRefCountPtr<FMaterialUniformExpression> Roughness = new FMaterialUniformExpressionScalarParameter(RoughnessInfo, BuiltSet->FindOrAddScalarParameter(RoughnessInfo, 0.5f));
+		TRefCountPtr<FMaterialUniformExpression> Tint = new FMaterialUniformExpressionVectorParameter(TintInfo, BuiltSet->FindOrAddVectorParameter(TintInfo, FLinearColor::White));
+		TRefCountPtr<FMaterialUniformExpression> Unset = new FMaterialUniformExpressionScalarParameter(UnsetInfo, BuiltSet->FindOrAddScalarParameter(UnsetInfo, 0.25f));
+		TestEqual(TEXT("Parameters are only added once"), BuiltSet->FindOrAddScalarParameter(RoughnessInfo, 0.5f), 0);
+
+		auto MakeConstant = [](float Value) { return new FMaterialUniformExpressionConstant(FLinearColor(Value, Value, Value, Value), MCT_Float); };
+		auto MakeMath = [](FMaterialUniformExpression* X, FMaterialUniformExpression* Y, uint8 Operation) { return new FMaterialUniformExpressionFoldedMath(X, Y, Operation, MCT_Float4); };
+		auto AddVectorPreshader = [BuiltSet](FMaterialUniformExpression* Expression) { BuiltSet->AddVectorPreshader(*TRefCountPtr<FMaterialUniformExpression>(Expression)); };
+		auto AddScalarPreshader = [BuiltSet](FMaterialUniformExpression* Expression) { BuiltSet->AddScalarPreshader(*TRefCountPtr<FMaterialUniformExpression>(Expression)); };
+
+		AddVectorPreshader(MakeMath(Tint, Roughness, FMO_Mul));
+		AddVectorPreshader(MakeMath(Tint, MakeMath(new FMaterialUniformExpressionConstant(A, MCT_Float4), new FMaterialUniformExpressionConstant(B, MCT_Float4), FMO_Mul), FMO_Add));
+		AddScalarPreshader(MakeMath(Roughness, MakeConstant(2.0f), FMO_Mul));
+		AddScalarPreshader(MakeMath(Roughness, MakeMath(MakeConstant(1.0f), MakeConstant(2.0f), FMO_Add), FMO_Add));
+		AddScalarPreshader(MakeMath(Unset, MakeConstant(4.0f), FMO_Mul));
+		AddScalarPreshader(MakeMath(Roughness, MakeConstant(2.0f), FMO_Mul));
+	}
+	OptimizedSet.OptimizePreshaders();
+
+	MaterialPreshaderTest::FTestMaterialRenderProxy RenderProxy(*MaterialResource);
+	RenderProxy.ScalarValues.Add(RoughnessInfo.Name, 0.5f);
+	RenderProxy.VectorValues.Add(TintInfo.Name, FLinearColor(1.0f, 0.5f, 0.25f, 1.0f));
+	const FMaterialRenderContext Context(&RenderProxy, *MaterialResource, nullptr);
+
+	FLinearColor VectorValues[NumVectorPreshaders];
+	float ScalarValues[NumScalarPreshaders];
+
+	Set.EvaluatePreshaders(Context, VectorValues, ScalarValues, false);
+	TestEqual(TEXT("Without the cache, parameters are looked up by every preshader reading them"), RenderProxy.NumScalarLookups, 5);
+	TestEqual(TEXT("Without the cache, vector parameters are looked up by every preshader reading them"), RenderProxy.NumVectorLookups, 2);
+
+	for (const FUniformExpressionSet* EvaluatedSet : Sets)
+	{
+		const TCHAR* SetName = EvaluatedSet == &Set ? TEXT("preshaders") : TEXT("optimized preshaders");
+
+		RenderProxy.ScalarValues[RoughnessInfo.Name] = 0.5f;
+		RenderProxy.VectorValues[TintInfo.Name] = FLinearColor(1.0f, 0.5f, 0.25f, 1.0f);
+		RenderProxy.ResetLookups();
+		EvaluatedSet->EvaluatePreshaders(Context, VectorValues, ScalarValues);
+		TestEqual(FString::Printf(TEXT("Cached %s look scalar parameters up once"), SetName), RenderProxy.NumScalarLookups, 2);
+		TestEqual(FString::Printf(TEXT("Cached %s look vector parameters up once"), SetName), RenderProxy.NumVectorLookups, 1);
+		TestTrue(FString::Printf(TEXT("Cached %s multiply by the parameter"), SetName), VectorValues[TintTimesRoughness] == FLinearColor(0.5f, 0.25f, 0.125f, 0.5f));
+		TestTrue(FString::Printf(TEXT("Cached %s add constants to the parameter"), SetName), VectorValues[TintPlusConstant] == FLinearColor(1.5f, -3.5f, 1.0f, 5.0f));
+		TestTrue(FString::Printf(TEXT("Cached %s read the scalar parameter"), SetName), ScalarValues[RoughnessTimesTwo] == 1.0f && ScalarValues[RoughnessPlusConstant] == 3.5f && ScalarValues[RoughnessTimesTwoAgain] == 1.0f);
+		TestTrue(FString::Printf(TEXT("Cached %s fall back to the default value"), SetName), ScalarValues[UnsetTimesFour] == 1.0f);
+
+		// Values are only cached for a single evaluation, the next one must see the new values
+		RenderProxy.ScalarValues[RoughnessInfo.Name] = 2.0f;
+		RenderProxy.VectorValues[TintInfo.Name] = FLinearColor(0.0f, 1.0f, 0.0f, 1.0f);
+		EvaluatedSet->EvaluatePreshaders(Context, VectorValues, ScalarValues);
+		TestTrue(FString::Printf(TEXT("Cached %s see the updated vector parameter"), SetName), VectorValues[TintTimesRoughness] == FLinearColor(0.0f, 2.0f, 0.0f, 2.0f) && VectorValues[TintPlusConstant] == FLinearColor(0.5f, -3.0f, 0.75f, 5.0f));
+		TestTrue(FString::Printf(TEXT("Cached %s see the updated scalar parameter"), SetName), ScalarValues[RoughnessTimesTwo] == 4.0f && ScalarValues[RoughnessPlusConstant] == 5.0f && ScalarValues[RoughnessTimesTwoAgain] == 4.0f);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMaterialPreshaderOptimizationPerfTest, "System.Engine.Materials.Preshader Optimization Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FMaterialPreshaderOptimizationPerfTest::RunTest(const FString& Parameters)
+{
+	const int32 NumScalarParameters = 16;
+	const int32 NumVectorParameters = 8;
+	const int32 NumUniqueExpressions = 128;
+	const int32 NumExpressions = 256;
+	const int32 NumIterations = 1000;
+
+	const FMaterialResource* MaterialResource = MaterialPreshaderTest::GetDefaultMaterialResource(*this);
+	if (!MaterialResource)
+	{
+		return false;
+	}
+
+	// Materials often compute the same values for several uniform expressions, repeat some of them. Every expression is
+	// both a vector and a scalar preshader, the same random stream rebuilds the same set to optimize.
+	FUniformExpressionSet Set;
+	FUniformExpressionSet OptimizedSet;
+	FUniformExpressionSet* const Sets[] = { &Set, &OptimizedSet };
+	for (FUniformExpressionSet* BuiltSet : Sets)
+	{
+		for (int32 ExpressionIndex = 0; ExpressionIndex < NumExpressions; ++ExpressionIndex)
+		{
+			FRandomStream RandomStream(ExpressionIndex < NumUniqueExpressions ? ExpressionIndex : (ExpressionIndex * 7) % NumUniqueExpressions);
+			const TRefCountPtr<FMaterialUniformExpression> Expression = MaterialPreshaderTest::GenerateExpression(RandomStream, 6, NumScalarParameters, NumVectorParameters, *BuiltSet);
+			BuiltSet->AddVectorPreshader(*Expression);
+			BuiltSet->AddScalarPreshader(*Expression);
+		}
+	}
+
+	const uint64 OptimizeStartCycles = FPlatformTime::Cycles64();
+	OptimizedSet.OptimizePreshaders();
+	const double OptimizeMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - OptimizeStartCycles);
+
+	MaterialPreshaderTest::FTestMaterialRenderProxy RenderProxy(*MaterialResource);
+	for (int32 ParameterIndex = 0; ParameterIndex < NumScalarParameters; ++ParameterIndex)
+	{
+		RenderProxy.ScalarValues.Add(FName(TEXT("Scalar"), ParameterIndex + 1), ParameterIndex * 0.25f - 1.0f);
+	}
+	for (int32 ParameterIndex = 0; ParameterIndex < NumVectorParameters; ++ParameterIndex)
+	{
+		RenderProxy.VectorValues.Add(FName(TEXT("Vector"), ParameterIndex + 1), FLinearColor(ParameterIndex * 0.5f, -1.0f, 0.25f, 2.0f - ParameterIndex));
+	}
+	const FMaterialRenderContext Context(&RenderProxy, *MaterialResource, nullptr);
+
+	TArray<FLinearColor> VectorValues;
+	TArray<float> ScalarValues;
+	RenderProxy.ResetLookups();
+	const double UncachedMs = MaterialPreshaderTest::EvaluateExpressionSet(Set, Context, false, NumIterations, VectorValues, ScalarValues);
+	const int32 NumUncachedLookups = (RenderProxy.NumScalarLookups + RenderProxy.NumVectorLookups) / NumIterations;
+
+	TArray<FLinearColor> CachedVectorValues;
+	TArray<float> CachedScalarValues;
+	RenderProxy.ResetLookups();
+	const double CachedMs = MaterialPreshaderTest::EvaluateExpressionSet(Set, Context, true, NumIterations, CachedVectorValues, CachedScalarValues);
+	const int32 NumCachedLookups = (RenderProxy.NumScalarLookups + RenderProxy.NumVectorLookups) / NumIterations;
+
+	TArray<FLinearColor> OptimizedVectorValues;
+	TArray<float> OptimizedScalarValues;
+	const double OptimizedMs = MaterialPreshaderTest::EvaluateExpressionSet(OptimizedSet, Context, true, NumIterations, OptimizedVectorValues, OptimizedScalarValues);
+
+	// Folding evaluates the same operations as the interpreter, results must be identical rather than close
+	TestTrue(TEXT("Cached parameters evaluate to the same values"), FMemory::Memcmp(VectorValues.GetData(), CachedVectorValues.GetData(), VectorValues.Num() * sizeof(FLinearColor)) == 0 && FMemory::Memcmp(ScalarValues.GetData(), CachedScalarValues.GetData(), ScalarValues.Num() * sizeof(float)) == 0);
+	TestTrue(TEXT("Optimized preshaders evaluate to the same values"), FMemory::Memcmp(VectorValues.GetData(), OptimizedVectorValues.GetData(), VectorValues.Num() * sizeof(FLinearColor)) == 0 && FMemory::Memcmp(ScalarValues.GetData(), OptimizedScalarValues.GetData(), ScalarValues.Num() * sizeof(float)) == 0);
+
+	AddInfo(FString::Printf(TEXT("%d vector and scalar preshaders (%d unique) optimized in %.2f ms; %d evaluations without parameter cache %.2f ms (%d lookups each), cached %.2f ms (%d lookups each), cached and optimized %.2f ms"),
+		NumExpressions,
+		NumUniqueExpressions,
+		OptimizeMs,
+		NumIterations,
+		UncachedMs,
+		NumUncachedLookups,
+		CachedMs,
+		NumCachedLookups,
+		OptimizedMs));
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "ShaderCompiler.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+namespace ShaderCompileWorkerTransferTest
+{
+	typedef TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>> FJobArray;
+
+	// Builds jobs shaped like the ones of a fixed set of materials, the jobs of a material share its generated source and differ by their defines.
+	static void CreateJobs(int32 NumMaterials, int32 NumJobsPerMaterial, FJobArray& OutJobs)
+	{
+		for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+		{
+			FString MaterialSource;
+			for (int32 ExpressionIndex = 0; ExpressionIndex < 512; ++ExpressionIndex)
+			{
+				MaterialSource += FString::Printf(TEXT("float Material%d_Expression%d(float X) { return X * %d.0 + %d.0; }\n"), MaterialIndex, ExpressionIndex, ExpressionIndex, MaterialIndex);
+			}
+
+			TRefCountPtr<FShaderCompilerEnvironment> MaterialEnvironment = new FShaderCompilerEnvironment();
+			MaterialEnvironment->IncludeVirtualPathToContentsMap.Add(TEXT("/Engine/Generated/Material.ush"), MaterialSource);
+
+			for (int32 JobIndex = 0; JobIndex < NumJobsPerMaterial; ++JobIndex)
+			{
+				FShaderCompileJob* Job = new FShaderCompileJob(FShaderCommonCompileJob::GetNextJobId(), nullptr, nullptr, JobIndex);
+				Job->Input.Target = FShaderTarget(SF_Pixel, GMaxRHIShaderPlatform);
+				Job->Input.ShaderFormat = LegacyShaderPlatformToShaderFormat(GMaxRHIShaderPlatform);
+				Job->Input.VirtualSourceFilePath = TEXT("/Engine/Private/BasePassPixelShader.usf");
+				Job->Input.EntryPointName = TEXT("MainPS");
+				Job->Input.SharedEnvironment = MaterialEnvironment;
+				Job->Input.Environment.SetDefine(TEXT("PERMUTATION_ID"), JobIndex);
+				OutJobs.Add(TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>(Job));
+			}
+		}
+	}
+
+	// Builds the output file a worker returns for the jobs, with CodeSize bytes of compiled code per job.
+	static void CreateWorkerOutput(const FJobArray& Jobs, int32 CodeSize, TArray<uint8>& OutData)
+	{
+		FMemoryWriter Ar(OutData, true);
+
+		int32 OutputVersion = ShaderCompileWorkerOutputVersion;
+		int64 FileSize = 0;
+		int32 ErrorCode = (int32)ESCWErrorCode::Success;
+		int32 NumProcessedJobs = Jobs.Num();
+		int32 CallstackLength = 0;
+		int32 ExceptionInfoLength = 0;
+		Ar << OutputVersion << FileSize << ErrorCode << NumProcessedJobs << CallstackLength << ExceptionInfoLength;
+
+		int32 SingleJobHeader = ShaderCompileWorkerSingleJobHeader;
+		int32 NumSingleJobs = Jobs.Num();
+		Ar << SingleJobHeader << NumSingleJobs;
+		for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+		{
+			FShaderCompilerOutput Output;
+			Output.bSucceeded = true;
+			Output.Target = Jobs[JobIndex]->GetSingleShaderJob()->Input.Target;
+			Output.NumInstructions = 64 + JobIndex;
+			TArray<uint8>& Code = Output.ShaderCode.GetWriteAccess();
+			Code.SetNumUninitialized(CodeSize);
+			for (int32 ByteIndex = 0; ByteIndex < CodeSize; ++ByteIndex)
+			{
+				Code[ByteIndex] = (uint8)(ByteIndex * 31 + JobIndex);
+			}
+			Ar << Output;
+		}
+
+		int32 PipelineJobHeader = ShaderCompileWorkerPipelineJobHeader;
+		int32 NumPipelineJobs = 0;
+		Ar << PipelineJobHeader << NumPipelineJobs;
+
+		FileSize = OutData.Num();
+		Ar.Seek(sizeof(OutputVersion));
+		Ar << FileSize;
+	}
+
+	struct FTransferResult
+	{
+		TArray<uint8> ArchiveInput;
+		TArray<uint8> BufferedInput;
+		TArray<uint8> OutputData;
+		FJobArray ArchiveJobs;
+		FJobArray MappedJobs;
+		int64 MappedSize = 0;
+		double ArchiveWriteMs = 0.0;
+		double BufferedWriteMs = 0.0;
+		double ArchiveReadMs = 0.0;
+		double MappedReadMs = 0.0;
+	};
+
+	// Writes the worker input of Jobs through both transports, then reads the same worker output back into fresh copies of the jobs through both transports.
+	static bool RunTransfer(FAutomationTestBase& Test, const FString& TestDirectory, int32 NumMaterials, int32 NumJobsPerMaterial, int32 CodeSize, const FJobArray& Jobs, FTransferResult& OutResult)
+	{
+		const FString ArchiveInputFileName = TestDirectory / TEXT("ArchiveInput.in");
+		const FString BufferedInputFileName = TestDirectory / TEXT("BufferedInput.in");
+		const FString OutputFileName = TestDirectory / TEXT("WorkerOutput.out");
+
+		// Worker input serialized straight to the file
+		const uint64 ArchiveWriteStartCycles = FPlatformTime::Cycles64();
+		FArchive* TransferFile = IFileManager::Get().CreateFileWriter(*ArchiveInputFileName);
+		if (!Test.TestNotNull(TEXT("Transfer file can be created"), TransferFile))
+		{
+			return false;
+		}
+		FShaderCompileUtilities::DoWriteTasks(Jobs, *TransferFile);
+		delete TransferFile;
+		OutResult.ArchiveWriteMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ArchiveWriteStartCycles);
+
+		// Worker input serialized in memory and written in one call, as the local workers are fed
+		const uint64 BufferedWriteStartCycles = FPlatformTime::Cycles64();
+		FMemoryWriter TransferWriter(OutResult.BufferedInput, true);
+		FShaderCompileUtilities::DoWriteTasks(Jobs, TransferWriter);
+		FFileHelper::SaveArrayToFile(OutResult.BufferedInput, *BufferedInputFileName);
+		OutResult.BufferedWriteMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - BufferedWriteStartCycles);
+
+		FFileHelper::LoadFileToArray(OutResult.ArchiveInput, *ArchiveInputFileName);
+
+		CreateWorkerOutput(Jobs, CodeSize, OutResult.OutputData);
+		FFileHelper::SaveArrayToFile(OutResult.OutputData, *OutputFileName);
+
+		// Worker output read through a file archive
+		CreateJobs(NumMaterials, NumJobsPerMaterial, OutResult.ArchiveJobs);
+		const uint64 ArchiveReadStartCycles = FPlatformTime::Cycles64();
+		FArchive* OutputFile = IFileManager::Get().CreateFileReader(*OutputFileName);
+		if (!Test.TestNotNull(TEXT("Output file can be opened"), OutputFile))
+		{
+			return false;
+		}
+		FShaderCompileUtilities::DoReadTaskResults(OutResult.ArchiveJobs, *OutputFile);
+		delete OutputFile;
+		OutResult.ArchiveReadMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ArchiveReadStartCycles);
+
+		// Worker output mapped in memory where supported, as the local workers are read
+		CreateJobs(NumMaterials, NumJobsPerMaterial, OutResult.MappedJobs);
+		const uint64 MappedReadStartCycles = FPlatformTime::Cycles64();
+		OutResult.MappedSize = FShaderCompileUtilities::ReadTaskResultsFile(OutResult.MappedJobs, OutputFileName);
+		OutResult.MappedReadMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - MappedReadStartCycles);
+
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShaderCompileWorkerTransferTest, "System.Engine.Shaders.Worker Transfer", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FShaderCompileWorkerTransferTest::RunTest(const FString& Parameters)
+{
+	const int32 NumMaterials = 2;
+	const int32 NumJobsPerMaterial = 3;
+	const int32 CodeSize = 256;
+
+	const FString TestDirectory = FPaths::AutomationTransientDir() / TEXT("ShaderCompileWorkerTransfer");
+
+	ShaderCompileWorkerTransferTest::FJobArray Jobs;
+	ShaderCompileWorkerTransferTest::CreateJobs(NumMaterials, NumJobsPerMaterial, Jobs);
+
+	ShaderCompileWorkerTransferTest::FTransferResult Result;
+	if (ShaderCompileWorkerTransferTest::RunTransfer(*this, TestDirectory, NumMaterials, NumJobsPerMaterial, CodeSize, Jobs, Result))
+	{
+		TestTrue(TEXT("Buffered worker input is written"), Result.BufferedInput.Num() > 0);
+		TestTrue(TEXT("Buffered worker input matches the input serialized to the file"), Result.ArchiveInput == Result.BufferedInput);
+		TestEqual(TEXT("Mapped read consumes the whole output file"), Result.MappedSize, (int64)Result.OutputData.Num());
+
+		// Each job gets the output written for it, whichever way it is read
+		for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+		{
+			const FShaderCompileJob* const ReadJobs[] = { Result.ArchiveJobs[JobIndex]->GetSingleShaderJob(), Result.MappedJobs[JobIndex]->GetSingleShaderJob() };
+			for (int32 ReadIndex = 0; ReadIndex < UE_ARRAY_COUNT(ReadJobs); ++ReadIndex)
+			{
+				const TCHAR* ReadName = ReadIndex == 0 ? TEXT("archive") : TEXT("mapped");
+				const FShaderCompileJob& Job = *ReadJobs[ReadIndex];
+				TestTrue(FString::Printf(TEXT("Job %d read through %s succeeded"), JobIndex, ReadName), Job.bFinalized && Job.bSucceeded);
+				TestEqual(FString::Printf(TEXT("Job %d read through %s has its own instruction count"), JobIndex, ReadName), Job.Output.NumInstructions, (uint32)(64 + JobIndex));
+			}
+			TestTrue(FString::Printf(TEXT("Job %d has the same output hash through both reads"), JobIndex), ReadJobs[0]->Output.OutputHash == ReadJobs[1]->Output.OutputHash);
+		}
+	}
+
+	IFileManager::Get().DeleteDirectory(*TestDirectory, false, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShaderCompileWorkerTransferPerfTest, "System.Engine.Shaders.Worker Transfer Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FShaderCompileWorkerTransferPerfTest::RunTest(const FString& Parameters)
+{
+	const int32 NumMaterials = 8;
+	const int32 NumJobsPerMaterial = 32;
+	const int32 CodeSize = 16 * 1024;
+
+	const FString TestDirectory = FPaths::AutomationTransientDir() / TEXT("ShaderCompileWorkerTransferPerf");
+
+	ShaderCompileWorkerTransferTest::FJobArray Jobs;
+	ShaderCompileWorkerTransferTest::CreateJobs(NumMaterials, NumJobsPerMaterial, Jobs);
+
+	ShaderCompileWorkerTransferTest::FTransferResult Result;
+	if (ShaderCompileWorkerTransferTest::RunTransfer(*this, TestDirectory, NumMaterials, NumJobsPerMaterial, CodeSize, Jobs, Result))
+	{
+		AddInfo(FString::Printf(TEXT("%d jobs of %d materials: input %.2f MB written through archive %.2f ms, buffered %.2f ms; output %.2f MB read through archive %.2f ms, mapped %.2f ms"),
+			Jobs.Num(),
+			NumMaterials,
+			Result.BufferedInput.Num() / (1024.0 * 1024.0),
+			Result.ArchiveWriteMs,
+			Result.BufferedWriteMs,
+			Result.OutputData.Num() / (1024.0 * 1024.0),
+			Result.ArchiveReadMs,
+			Result.MappedReadMs));
+	}
+
+	IFileManager::Get().DeleteDirectory(*TestDirectory, false, true);
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
@@ -0,0 +1,275 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "VisualLogger/VisualLoggerTypes.h"
+#include "VisualLogger/VisualLoggerBinaryFile.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && ENABLE_VISUAL_LOG
+
+namespace VisualLoggerBinaryFileTest
+{
+	typedef TArray<FVisualLogDevice::FVisualLogEntryItem> FItemArray;
+
+	const int32 NumCategories = 4;
+
+	// Builds the entries a set of AI agents log every frame, a few text lines and a path in a handful of categories.
+	static void CreateFrames(int32 NumOwners, int32 NumFrames, float FrameTime, TArray<FItemArray>& OutFrames)
+	{
+		const FName Categories[NumCategories] = { TEXT("LogBehaviorTree"), TEXT("LogNavigation"), TEXT("LogPathFollowing"), TEXT("LogPerception") };
+		const FName OwnerClassName(TEXT("AIController"));
+
+		OutFrames.SetNum(NumFrames);
+		for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+		{
+			for (int32 OwnerIndex = 0; OwnerIndex < NumOwners; ++OwnerIndex)
+			{
+				FVisualLogEntry Entry;
+				Entry.TimeStamp = FrameIndex * FrameTime;
+				Entry.Location = FVector(OwnerIndex * 100.0f, FrameIndex * 10.0f, 0.0f);
+				for (int32 LineIndex = 0; LineIndex < NumCategories; ++LineIndex)
+				{
+					Entry.AddText(FString::Printf(TEXT("Agent %d task %d state %d"), OwnerIndex, LineIndex, (FrameIndex + OwnerIndex * 7 + LineIndex) % 17), Categories[LineIndex], ELogVerbosity::Log);
+				}
+				TArray<FVector> Path;
+				for (int32 PointIndex = 0; PointIndex < 8; ++PointIndex)
+				{
+					Path.Add(Entry.Location + FVector(PointIndex * 50.0f, (PointIndex + OwnerIndex) % 3 * 25.0f, 0.0f));
+				}
+				Entry.AddElement(Path, Categories[1], ELogVerbosity::Log, FColor::Green, TEXT("Path"));
+
+				OutFrames[FrameIndex].Add(FVisualLogDevice::FVisualLogEntryItem(FName(TEXT("Agent"), OwnerIndex + 1), OwnerClassName, Entry));
+			}
+		}
+	}
+
+	// Loads a whole recording as the log viewer does.
+	static void LoadFile(const FString& FileName, FItemArray& OutItems)
+	{
+		FArchive* FileReader = IFileManager::Get().CreateFileReader(*FileName);
+		if (FileReader)
+		{
+			FVisualLoggerHelpers::Serialize(*FileReader, OutItems);
+			delete FileReader;
+		}
+	}
+
+	// Returns whether both lists hold the same items in the same order.
+	static bool ItemsMatch(const FItemArray& A, const FItemArray& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+		for (int32 ItemIndex = 0; ItemIndex < A.Num(); ++ItemIndex)
+		{
+			const FVisualLogEntry& EntryA = A[ItemIndex].Entry;
+			const FVisualLogEntry& EntryB = B[ItemIndex].Entry;
+			if (A[ItemIndex].OwnerName != B[ItemIndex].OwnerName || A[ItemIndex].OwnerClassName != B[ItemIndex].OwnerClassName
+				|| EntryA.TimeStamp != EntryB.TimeStamp || EntryA.Location != EntryB.Location
+				|| EntryA.LogLines.Num() != EntryB.LogLines.Num() || EntryA.ElementsToDraw.Num() != EntryB.ElementsToDraw.Num()
+				|| (EntryA.LogLines.Num() > 0 && EntryA.LogLines.Last().Line != EntryB.LogLines.Last().Line))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVisualLoggerBinaryFileTest, "System.Engine.VisualLogger.Binary File", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVisualLoggerBinaryFileTest::RunTest(const FString& Parameters)
+{
+	// Four seconds of recording split in one second chunks
+	const int32 NumOwners = 4;
+	const int32 NumFrames = 240;
+	const float FrameTime = 1.0f / 60.0f;
+	const float ChunkLength = 1.0f;
+
+	const FString TestDirectory = FPaths::AutomationTransientDir() / TEXT("VisualLoggerBinaryFile");
+	const FString FileName = TestDirectory / TEXT("Chunked.bvlog");
+
+	TArray<VisualLoggerBinaryFileTest::FItemArray> Frames;
+	VisualLoggerBinaryFileTest::CreateFrames(NumOwners, NumFrames, FrameTime, Frames);
+	VisualLoggerBinaryFileTest::FItemArray LoggedItems;
+	for (const VisualLoggerBinaryFileTest::FItemArray& Frame : Frames)
+	{
+		LoggedItems.Append(Frame);
+	}
+
+	FArchive* File = IFileManager::Get().CreateFileWriter(*FileName);
+	if (!TestNotNull(TEXT("Chunked file can be created"), File))
+	{
+		return false;
+	}
+	FVisualLoggerBinaryFileWriter* Writer = new FVisualLoggerBinaryFileWriter(*File, true, ChunkLength);
+	for (VisualLoggerBinaryFileTest::FItemArray& Frame : Frames)
+	{
+		Writer->Write(MoveTemp(Frame));
+	}
+	Writer->Close();
+	delete Writer;
+	delete File;
+
+	VisualLoggerBinaryFileTest::FItemArray LoadedItems;
+	VisualLoggerBinaryFileTest::LoadFile(FileName, LoadedItems);
+	TestTrue(TEXT("Chunked file loads all the logged items in the order they were logged"), VisualLoggerBinaryFileTest::ItemsMatch(LoadedItems, LoggedItems));
+
+	FVisualLoggerBinaryFileReader Reader;
+	if (TestTrue(TEXT("Chunked file can be opened"), Reader.Open(FileName)))
+	{
+		const TArray<FVisualLogChunkInfo>& Chunks = Reader.GetChunks();
+		TestTrue(TEXT("Recording is split in chunks"), Chunks.Num() > 1);
+
+		bool bChunksInOrder = true;
+		for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+		{
+			bChunksInOrder &= Chunks[ChunkIndex].StartTime <= Chunks[ChunkIndex].EndTime;
+			bChunksInOrder &= ChunkIndex == 0 || Chunks[ChunkIndex - 1].EndTime <= Chunks[ChunkIndex].StartTime;
+		}
+		TestTrue(TEXT("Chunks cover successive time spans"), bChunksInOrder);
+		TestTrue(TEXT("Index lists the categories of the owners"), Chunks.Num() > 0 && Chunks[0].Owners.Num() == NumOwners && Chunks[0].Owners[0].Categories.Num() == VisualLoggerBinaryFileTest::NumCategories);
+
+		// One owner over a time range spanning two chunks
+		const FName OwnerName(TEXT("Agent"), 2);
+		const float StartTime = 0.5f;
+		const float EndTime = 1.5f;
+		VisualLoggerBinaryFileTest::FItemArray RangeItems;
+		VisualLoggerBinaryFileTest::FItemArray ExpectedRangeItems;
+		Reader.ReadItems(StartTime, EndTime, OwnerName, RangeItems);
+		for (const FVisualLogDevice::FVisualLogEntryItem& Item : LoggedItems)
+		{
+			if (Item.OwnerName == OwnerName && Item.Entry.TimeStamp >= StartTime && Item.Entry.TimeStamp <= EndTime)
+			{
+				ExpectedRangeItems.Add(Item);
+			}
+		}
+		TestTrue(TEXT("Indexed read returns the items of the owner in the time range"), ExpectedRangeItems.Num() > 0 && VisualLoggerBinaryFileTest::ItemsMatch(RangeItems, ExpectedRangeItems));
+
+		RangeItems.Reset();
+		Reader.ReadItems(StartTime, EndTime, FName(TEXT("Agent"), NumOwners + 1), RangeItems);
+		TestEqual(TEXT("Indexed read of an owner that didn't log returns nothing"), RangeItems.Num(), 0);
+
+		Reader.Close();
+	}
+
+	// A recording that didn't finish has no index, its chunks are found from their headers
+	const int32 NumUnfinishedFrames = NumFrames / 2;
+	const int32 FramesPerChunk = 60;
+	FArchive* UnfinishedFile = IFileManager::Get().CreateFileWriter(*FileName);
+	for (int32 FrameIndex = 0; FrameIndex < NumUnfinishedFrames; FrameIndex += FramesPerChunk)
+	{
+		VisualLoggerBinaryFileTest::FItemArray ChunkItems;
+		ChunkItems.Append(LoggedItems.GetData() + FrameIndex * NumOwners, FramesPerChunk * NumOwners);
+		FVisualLogChunkInfo UnfinishedChunk;
+		FVisualLoggerBinaryFile::WriteChunk(*UnfinishedFile, ChunkItems, true, UnfinishedChunk);
+	}
+	delete UnfinishedFile;
+	TestTrue(TEXT("Chunks of an unfinished recording can be read"), Reader.Open(FileName) && Reader.GetChunks().Num() == NumUnfinishedFrames / FramesPerChunk && Reader.GetChunks().Last().EndTime == LoggedItems[(NumUnfinishedFrames - 1) * NumOwners].Entry.TimeStamp);
+	Reader.Close();
+
+	IFileManager::Get().DeleteDirectory(*TestDirectory, false, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVisualLoggerBinaryFilePerfTest, "System.Engine.VisualLogger.Binary File Performance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVisualLoggerBinaryFilePerfTest::RunTest(const FString& Parameters)
+{
+	const int32 NumOwners = 16;
+	const int32 NumFrames = 300;
+	const float FrameTime = 1.0f / 60.0f;
+
+	const FString TestDirectory = FPaths::AutomationTransientDir() / TEXT("VisualLoggerBinaryFilePerf");
+	const FString LegacyFileName = TestDirectory / TEXT("Legacy.bvlog");
+	const FString ChunkedFileName = TestDirectory / TEXT("Chunked.bvlog");
+
+	TArray<VisualLoggerBinaryFileTest::FItemArray> LegacyFrames;
+	VisualLoggerBinaryFileTest::CreateFrames(NumOwners, NumFrames, FrameTime, LegacyFrames);
+	TArray<VisualLoggerBinaryFileTest::FItemArray> ChunkedFrames = LegacyFrames;
+
+	// Frames serialized on the logging thread, as the binary device used to
+	FArchive* LegacyFile = IFileManager::Get().CreateFileWriter(*LegacyFileName);
+	if (!TestNotNull(TEXT("Legacy file can be created"), LegacyFile))
+	{
+		return false;
+	}
+	const uint64 LegacyRecordStartCycles = FPlatformTime::Cycles64();
+	for (VisualLoggerBinaryFileTest::FItemArray& Frame : LegacyFrames)
+	{
+		FVisualLoggerHelpers::Serialize(*LegacyFile, Frame);
+	}
+	const double LegacyRecordMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - LegacyRecordStartCycles);
+	delete LegacyFile;
+
+	// Frames handed to the writer thread, the logging thread only pays for the queue
+	FArchive* ChunkedFile = IFileManager::Get().CreateFileWriter(*ChunkedFileName);
+	if (!TestNotNull(TEXT("Chunked file can be created"), ChunkedFile))
+	{
+		return false;
+	}
+	FVisualLoggerBinaryFileWriter* Writer = new FVisualLoggerBinaryFileWriter(*ChunkedFile, true, 1.0f);
+	const uint64 ChunkedRecordStartCycles = FPlatformTime::Cycles64();
+	for (VisualLoggerBinaryFileTest::FItemArray& Frame : ChunkedFrames)
+	{
+		Writer->Write(MoveTemp(Frame));
+	}
+	const double ChunkedRecordMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ChunkedRecordStartCycles);
+	const uint64 ChunkedCloseStartCycles = FPlatformTime::Cycles64();
+	Writer->Close();
+	const double ChunkedCloseMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ChunkedCloseStartCycles);
+	delete Writer;
+	delete ChunkedFile;
+
+	const int64 LegacySize = IFileManager::Get().FileSize(*LegacyFileName);
+	const int64 ChunkedSize = IFileManager::Get().FileSize(*ChunkedFileName);
+
+	VisualLoggerBinaryFileTest::FItemArray LegacyItems;
+	const uint64 LegacyLoadStartCycles = FPlatformTime::Cycles64();
+	VisualLoggerBinaryFileTest::LoadFile(LegacyFileName, LegacyItems);
+	const double LegacyLoadMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - LegacyLoadStartCycles);
+
+	VisualLoggerBinaryFileTest::FItemArray ChunkedItems;
+	const uint64 ChunkedLoadStartCycles = FPlatformTime::Cycles64();
+	VisualLoggerBinaryFileTest::LoadFile(ChunkedFileName, ChunkedItems);
+	const double ChunkedLoadMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ChunkedLoadStartCycles);
+
+	TestTrue(TEXT("Chunked file loads the same items as the legacy file"), LegacyItems.Num() == NumOwners * NumFrames && VisualLoggerBinaryFileTest::ItemsMatch(ChunkedItems, LegacyItems));
+
+	// One owner over one second, read through the index
+	const float StartTime = 2.0f;
+	const float EndTime = 3.0f;
+	TArray<FVisualLogDevice::FVisualLogEntryItem> RangeItems;
+	const uint64 IndexedReadStartCycles = FPlatformTime::Cycles64();
+	FVisualLoggerBinaryFileReader Reader;
+	if (Reader.Open(ChunkedFileName))
+	{
+		Reader.ReadItems(StartTime, EndTime, FName(TEXT("Agent"), NumOwners / 2), RangeItems);
+		Reader.Close();
+	}
+	const double IndexedReadMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - IndexedReadStartCycles);
+
+	AddInfo(FString::Printf(TEXT("%d owners, %d frames: record %.2f ms on the logging thread, chunked %.2f ms + %.2f ms on close; file %.2f MB, chunked %.2f MB; load %.2f ms, chunked %.2f ms; indexed read of one owner over %.0f s %.2f ms"),
+		NumOwners,
+		NumFrames,
+		LegacyRecordMs,
+		ChunkedRecordMs,
+		ChunkedCloseMs,
+		LegacySize / (1024.0 * 1024.0),
+		ChunkedSize / (1024.0 * 1024.0),
+		LegacyLoadMs,
+		ChunkedLoadMs,
+		EndTime - StartTime,
+		IndexedReadMs));
+
+	IFileManager::Get().DeleteDirectory(*TestDirectory, false, true);
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS && ENABLE_VISUAL_LOG
@@ -83,6 +83,7 @@ FUploadingVirtualTexture::~FUploadingVirtualTexture()
 
 	// Complete all open transcode requests before deleting IFileCacheHandle objects
 	StreamingManager->WaitTasksFinished();
+	StreamingManager->ReleaseChunkReads(this);
 
 	for (TUniquePtr<FVirtualTextureCodec>& Codec : CodecPerChunk)
 	{
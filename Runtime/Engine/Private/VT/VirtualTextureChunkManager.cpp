@@ -22,12 +22,29 @@ static FAutoConsoleVariableRef CVarNumTranscodeRequests(
 	TEXT("Number of transcode request that can be in flight. default 32\n"),
 	ECVF_Default);
 
+static int32 MaxTranscodeRequests = 256;
+static FAutoConsoleVariableRef CVarMaxTranscodeRequests(
+	TEXT("r.VT.MaxTranscodeRequests"),
+	MaxTranscodeRequests,
+	TEXT("Upper bound of the number of transcode requests that can be in flight, the limit grows from r.VT.NumTranscodeRequests with the rate tiles are requested at.\n")
+	TEXT("Unused upload buffers above the limit are released. Set to r.VT.NumTranscodeRequests for a fixed limit. default 256\n"),
+	ECVF_Default);
+
+static int32 NumTilesPerChunkRead = 16;
+static FAutoConsoleVariableRef CVarNumTilesPerChunkRead(
+	TEXT("r.VT.NumTilesPerChunkRead"),
+	NumTilesPerChunkRead,
+	TEXT("Number of neighbouring tiles of a mip level read from their chunk in a single request, tiles requested in the same frame share the read.\n")
+	TEXT("Rounded up to a power of two, 1 reads each tile on its own. default 16\n"),
+	ECVF_Default);
+
 FVirtualTextureChunkStreamingManager::FVirtualTextureChunkStreamingManager()
 {
 #if WITH_EDITOR
 	GetVirtualTextureChunkDDCCache()->Initialize();
 #endif
 	BeginInitResource(&UploadCache);
+	MaxPendingTiles = (uint32)FMath::Max(NumTranscodeRequests, 1);
 }
 
 FVirtualTextureChunkStreamingManager::~FVirtualTextureChunkStreamingManager()
@@ -51,8 +68,11 @@ void FVirtualTextureChunkStreamingManager::UpdateResourceStreaming(float DeltaTi
 #if WITH_EDITOR
 				GetVirtualTextureChunkDDCCache()->UpdateRequests();
 #endif // WITH_EDITOR
+				StreamingManager->ChunkReads.Reset();
+				StreamingManager->UpdateMaxPendingTiles();
 				StreamingManager->TranscodeCache.RetireOldTasks(StreamingManager->UploadCache);
 				StreamingManager->UploadCache.UpdateFreeList();
+				StreamingManager->UploadCache.TrimFreeTiles(StreamingManager->MaxPendingTiles);
 
 				FVirtualTextureCodec::RetireOldCodecs();
 			});
@@ -97,7 +117,8 @@ FVTRequestPageResult FVirtualTextureChunkStreamingManager::RequestTile(FUploadin
 	}
 
 	// we limit the number of pending upload tiles in order to limit the memory required to store all the staging buffers
-	if (UploadCache.GetNumPendingTiles() >= (uint32)NumTranscodeRequests)
+	++NumTileRequests;
+	if (UploadCache.GetNumPendingTiles() >= MaxPendingTiles)
 	{
 		INC_DWORD_STAT(STAT_VTP_NumTranscodeDropped);
 		return EVTRequestPageStatus::Saturated;
@@ -122,12 +143,8 @@ FVTRequestPageResult FVirtualTextureChunkStreamingManager::RequestTile(FUploadin
 		}
 	}
 
-	// make a single read request that covers region of all requested tiles
-	const uint32 OffsetStart = VTData->GetTileOffset(ChunkIndex, TileIndex + MinLayerIndex);
-	const uint32 OffsetEnd = VTData->GetTileOffset(ChunkIndex, TileIndex + MaxLayerIndex + 1u);
-	const uint32 RequestSize = OffsetEnd - OffsetStart;
-
-	const FVTDataAndStatus TileDataResult = VTexture->ReadData(GraphCompletionEvents, ChunkIndex, OffsetStart, RequestSize, Priority);
+	uint32 DataOffset = 0u;
+	const FVTDataAndStatus TileDataResult = ReadTileData(GraphCompletionEvents, VTexture, ChunkIndex, vLevel, vAddress, MinLayerIndex, MaxLayerIndex, Priority, DataOffset);
 	if (!VTRequestPageStatus_HasData(TileDataResult.Status))
 	{
 		return TileDataResult.Status;
@@ -138,14 +155,84 @@ FVTRequestPageResult FVirtualTextureChunkStreamingManager::RequestTile(FUploadin
 	TranscodeParams.Data = TileDataResult.Data;
 	TranscodeParams.VTData = VTData;
 	TranscodeParams.ChunkIndex = ChunkIndex;
+	TranscodeParams.DataOffset = DataOffset;
 	TranscodeParams.vAddress = vAddress;
 	TranscodeParams.vLevel = vLevel;
 	TranscodeParams.LayerMask = LayerMask;
+	TranscodeParams.Priority = Priority;
 	TranscodeParams.Codec = CodecResult.Codec;
 	TranscodeHandle = TranscodeCache.SubmitTask(UploadCache, TranscodeKey, TranscodeParams, &GraphCompletionEvents);
 	return FVTRequestPageResult(EVTRequestPageStatus::Pending, TranscodeHandle.PackedData);
 }
 
+FVTDataAndStatus FVirtualTextureChunkStreamingManager::ReadTileData(FGraphEventArray& OutCompletionEvents, FUploadingVirtualTexture* VTexture, uint32 ChunkIndex, uint8 vLevel, uint32 vAddress, uint32 MinLayerIndex, uint32 MaxLayerIndex, EVTRequestPagePriority Priority, uint32& OutDataOffset)
+{
+	const FVirtualTextureBuiltData* VTData = VTexture->GetVTData();
+	const uint32 TileIndex = VTData->GetTileIndex(vLevel, vAddress);
+	const uint32 OffsetStart = VTData->GetTileOffset(ChunkIndex, TileIndex + MinLayerIndex);
+
+	// Tiles of a mip level are stored in Morton order, so an aligned window of tiles is a square region of the mip that is contiguous in the chunk
+	// Reading the whole window serves the requests of its other tiles, which tend to come in the same frame when many tiles are needed at once
+	const uint32 NumWindowTiles = FMath::RoundUpToPowerOfTwo(FMath::Max(NumTilesPerChunkRead, 1));
+	if (NumWindowTiles > 1u)
+	{
+		const FVTChunkReadKey Key(VTexture, vLevel, vAddress & ~(NumWindowTiles - 1u));
+		FVTChunkRead* ChunkRead = ChunkReads.Find(Key);
+		if (ChunkRead)
+		{
+			INC_DWORD_STAT(STAT_VTP_NumCoalescedReads);
+		}
+		else
+		{
+			const uint32 NumLayers = VTData->GetNumLayers();
+			const uint32 WindowTileIndex = VTData->TileIndexPerMip[vLevel] + Key.vAddress * NumLayers;
+			const uint32 FirstTileIndex = FMath::Max(WindowTileIndex, VTData->TileIndexPerChunk[ChunkIndex]);
+			const uint32 EndTileIndex = FMath::Min3(WindowTileIndex + NumWindowTiles * NumLayers, VTData->TileIndexPerMip[vLevel + 1], VTData->TileIndexPerChunk[ChunkIndex + 1]);
+			const uint32 WindowOffsetStart = VTData->GetTileOffset(ChunkIndex, FirstTileIndex);
+			const uint32 WindowOffsetEnd = VTData->GetTileOffset(ChunkIndex, EndTileIndex);
+
+			FVTChunkRead NewChunkRead;
+			const FVTDataAndStatus WindowDataResult = VTexture->ReadData(NewChunkRead.CompletionEvents, ChunkIndex, WindowOffsetStart, WindowOffsetEnd - WindowOffsetStart, Priority);
+			if (VTRequestPageStatus_HasData(WindowDataResult.Status))
+			{
+				NewChunkRead.Data = WindowDataResult.Data;
+				NewChunkRead.Offset = WindowOffsetStart;
+				ChunkRead = &ChunkReads.Add(Key, MoveTemp(NewChunkRead));
+			}
+			// else the file cache may not fit the window, fall back to reading the requested tile only
+		}
+
+		if (ChunkRead)
+		{
+			check(OffsetStart >= ChunkRead->Offset);
+			OutCompletionEvents.Append(ChunkRead->CompletionEvents);
+			OutDataOffset = OffsetStart - ChunkRead->Offset;
+			return FVTDataAndStatus(EVTRequestPageStatus::Pending, ChunkRead->Data);
+		}
+	}
+
+	// make a single read request that covers region of all requested tiles
+	const uint32 OffsetEnd = VTData->GetTileOffset(ChunkIndex, TileIndex + MaxLayerIndex + 1u);
+	const uint32 RequestSize = OffsetEnd - OffsetStart;
+
+	OutDataOffset = 0u;
+	return VTexture->ReadData(OutCompletionEvents, ChunkIndex, OffsetStart, RequestSize, Priority);
+}
+
+void FVirtualTextureChunkStreamingManager::UpdateMaxPendingTiles()
+{
+	// Follow bursts of requests quickly, and give the upload buffers back slowly once they are over
+	const float RequestRateBlend = (float)NumTileRequests > TileRequestRate ? 0.5f : 0.05f;
+	TileRequestRate = FMath::Lerp(TileRequestRate, (float)NumTileRequests, RequestRateBlend);
+	NumTileRequests = 0u;
+
+	// Tiles are produced the frame after they are requested at best, so cover the requests of two frames
+	const uint32 MinTiles = (uint32)FMath::Max(NumTranscodeRequests, 1);
+	const uint32 MaxTiles = FMath::Max((uint32)FMath::Max(MaxTranscodeRequests, 0), MinTiles);
+	MaxPendingTiles = FMath::Clamp((uint32)FMath::CeilToInt(TileRequestRate * 2.0f), MinTiles, MaxTiles);
+	SET_DWORD_STAT(STAT_VTP_MaxPendingTiles, MaxPendingTiles);
+}
+
 IVirtualTextureFinalizer* FVirtualTextureChunkStreamingManager::ProduceTile(FRHICommandListImmediate& RHICmdList, uint32 SkipBorderSize, uint8 NumLayers, uint8 LayerMask, uint64 RequestHandle, const FVTProduceTargetLayer* TargetLayers)
 {
 	SCOPE_CYCLE_COUNTER(STAT_VTP_ProduceTile);
@@ -167,3 +254,14 @@ void FVirtualTextureChunkStreamingManager::WaitTasksFinished() const
 {
 	TranscodeCache.WaitTasksFinished();
 }
+
+void FVirtualTextureChunkStreamingManager::ReleaseChunkReads(const FUploadingVirtualTexture* VTexture)
+{
+	for (TMap<FVTChunkReadKey, FVTChunkRead>::TIterator It(ChunkReads); It; ++It)
+	{
+		if (It.Key().VTexture == VTexture)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -7,6 +7,7 @@
 #include "VirtualTextureTranscodeCache.h"
 
 class FUploadingVirtualTexture;
+struct FVTDataAndStatus;
 
 DECLARE_STATS_GROUP(TEXT("Virtual Texturing Paging"), STATGROUP_VTP, STATCAT_Advanced);
 
@@ -24,6 +25,28 @@ DECLARE_DWORD_COUNTER_STAT(TEXT("Num transcodes dropped"), STAT_VTP_NumTranscode
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num transcodes retired"), STAT_VTP_NumTranscodeRetired, STATGROUP_VTP);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Intraframe upload flushes"), STAT_VTP_NumIntraFrameFlush, STATGROUP_VTP);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num uploads"), STAT_VTP_NumUploads, STATGROUP_VTP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num coalesced tile reads"), STAT_VTP_NumCoalescedReads, STATGROUP_VTP);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Max pending tiles"), STAT_VTP_MaxPendingTiles, STATGROUP_VTP);
+
+// Aligned window of neighbouring tiles of a mip level, that are read from their chunk with a single request
+struct FVTChunkReadKey
+{
+	FVTChunkReadKey(const FUploadingVirtualTexture* InVTexture, uint8 InvLevel, uint32 InvAddress) : VTexture(InVTexture), vAddress(InvAddress), vLevel(InvLevel) {}
+
+	inline bool operator==(const FVTChunkReadKey& Other) const { return VTexture == Other.VTexture && vAddress == Other.vAddress && vLevel == Other.vLevel; }
+	friend inline uint32 GetTypeHash(const FVTChunkReadKey& Key) { return HashCombine(PointerHash(Key.VTexture), MurmurFinalize32(Key.vAddress * 16u + Key.vLevel)); }
+
+	const FUploadingVirtualTexture* VTexture;
+	uint32 vAddress;
+	uint8 vLevel;
+};
+
+struct FVTChunkRead
+{
+	IMemoryReadStreamRef Data;
+	FGraphEventArray CompletionEvents;
+	uint32 Offset = 0u; // offset of Data in the chunk
+};
 
 struct FVirtualTextureChunkStreamingManager final  : public IStreamingManager
 {
@@ -45,8 +68,22 @@ public:
 	FVTRequestPageResult RequestTile(FUploadingVirtualTexture* VTexture, const FVirtualTextureProducerHandle& ProducerHandle, uint8 LayerMask, uint8 vLevel, uint32 vAddress, EVTRequestPagePriority Priority);
 	IVirtualTextureFinalizer* ProduceTile(FRHICommandListImmediate& RHICmdList, uint32 SkipBorderSize, uint8 NumLayers, uint8 LayerMask, uint64 RequestHandle, const FVTProduceTargetLayer* TargetLayers);
 	void WaitTasksFinished() const;
+	void ReleaseChunkReads(const FUploadingVirtualTexture* VTexture);
 
 private:
+	FVTDataAndStatus ReadTileData(FGraphEventArray& OutCompletionEvents, FUploadingVirtualTexture* VTexture, uint32 ChunkIndex, uint8 vLevel, uint32 vAddress, uint32 MinLayerIndex, uint32 MaxLayerIndex, EVTRequestPagePriority Priority, uint32& OutDataOffset);
+	void UpdateMaxPendingTiles();
+
 	FVirtualTextureUploadCache UploadCache;
 	FVirtualTextureTranscodeCache TranscodeCache;
+
+	/** Reads of tile windows issued this frame, tiles requested from the same window share its read */
+	TMap<FVTChunkReadKey, FVTChunkRead> ChunkReads;
+
+	/** Number of tiles that needed a transcode this frame, and its average over the last frames */
+	uint32 NumTileRequests = 0u;
+	float TileRequestRate = 0.0f;
+
+	/** Number of tiles that may wait for upload, adapted to the tile request rate */
+	uint32 MaxPendingTiles = 0u;
 };
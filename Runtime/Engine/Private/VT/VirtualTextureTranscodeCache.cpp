@@ -15,6 +15,15 @@ static FAutoConsoleVariableRef CVarVTTranscodeRetireAge(
 	, ECVF_Default
 );
 
+static int32 MaxTranscodeTasks = 0;
+static FAutoConsoleVariableRef CVarVTMaxTranscodeTasks(
+	TEXT("r.VT.MaxTranscodeTasks"),
+	MaxTranscodeTasks,
+	TEXT("Maximum number of VT transcode tasks running at once, tasks whose data is loaded wait in a queue ordered by request priority and mip level.\n")
+	TEXT("0 uses the number of task graph worker threads, < 0 is unlimited. default 0\n")
+	, ECVF_Default
+);
+
 namespace TextureBorderGenerator
 {
 	static int32 Enabled = 0;
@@ -26,6 +35,64 @@ namespace TextureBorderGenerator
 	);
 }
 
+struct FTranscodeTask;
+
+/**
+ * Bounds the number of transcode tasks running at once.
+ * Tasks are held until their data is loaded, then queued and released by priority as running tasks finish,
+ * so that a burst of requests after a camera cut doesn't flood the task graph and coarse mips are ready first.
+ */
+class FTranscodeTaskScheduler
+{
+public:
+	static uint32 GetPriority(const FVTTranscodeParams& InParams)
+	{
+		return (InParams.Priority == EVTRequestPagePriority::High ? 0x100u : 0u) | InParams.vLevel;
+	}
+
+	void Enqueue(TGraphTask<FTranscodeTask>* InTask, uint32 InPriority)
+	{
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			// Queue is sorted by increasing priority and tasks are released from the back,
+			// insert before the tasks of same priority so that those are released in submit order
+			int32 InsertIndex = 0;
+			while (InsertIndex < QueuedTasks.Num() && QueuedTasks[InsertIndex].Priority < InPriority)
+			{
+				++InsertIndex;
+			}
+			QueuedTasks.Insert(FQueuedTask{ InTask, InPriority }, InsertIndex);
+		}
+		ReleaseTasks();
+	}
+
+	void OnTaskFinished()
+	{
+		{
+			FScopeLock Lock(&CriticalSection);
+			check(NumRunningTasks > 0);
+			--NumRunningTasks;
+		}
+		ReleaseTasks();
+	}
+
+private:
+	struct FQueuedTask
+	{
+		TGraphTask<FTranscodeTask>* Task;
+		uint32 Priority;
+	};
+
+	void ReleaseTasks();
+
+	FCriticalSection CriticalSection;
+	TArray<FQueuedTask> QueuedTasks;
+	int32 NumRunningTasks = 0;
+};
+
+static FTranscodeTaskScheduler GTranscodeTaskScheduler;
+
 struct FTranscodeTask
 {
 	FVTUploadTileBuffer StagingBuffer[VIRTUALTEXTURE_SPACE_MAXLAYERS];
@@ -83,7 +150,7 @@ struct FTranscodeTask
 			// We make a single IO request that covers all the required layers
 			// this means if there's an unused layer in between two required layers, the unused layer will still be loaded
 			// So we compute offset using offset to this layer vs offset to the first requested layer
-			const uint32 DataOffset = TileLayerOffset - TileBaseOffset;
+			const uint32 DataOffset = Params.DataOffset + TileLayerOffset - TileBaseOffset;
 			const uint32 TileLayerSize = NextTileLayerOffset - TileLayerOffset;
 
 			const EPixelFormat LayerFormat = Params.VTData->LayerTypes[LayerIndex];
@@ -189,6 +256,8 @@ struct FTranscodeTask
 		// We're done with the compressed data
 		// The uncompressed data will be freed once it's uploaded to the GPU
 		Params.Data.SafeRelease();
+
+		GTranscodeTaskScheduler.OnTaskFinished();
 	}
 
 	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
@@ -200,6 +269,59 @@ struct FTranscodeTask
 	}
 };
 
+void FTranscodeTaskScheduler::ReleaseTasks()
+{
+	int32 MaxRunningTasks = MaxTranscodeTasks;
+	if (MaxRunningTasks == 0)
+	{
+		MaxRunningTasks = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	}
+	else if (MaxRunningTasks < 0)
+	{
+		MaxRunningTasks = MAX_int32;
+	}
+
+	TArray<TGraphTask<FTranscodeTask>*, TInlineAllocator<8>> TasksToRelease;
+	{
+		FScopeLock Lock(&CriticalSection);
+		while (QueuedTasks.Num() > 0 && NumRunningTasks < MaxRunningTasks)
+		{
+			TasksToRelease.Add(QueuedTasks.Pop(false).Task);
+			++NumRunningTasks;
+		}
+	}
+
+	for (TGraphTask<FTranscodeTask>* Task : TasksToRelease)
+	{
+		Task->Unlock();
+	}
+}
+
+// Queues a held transcode task once the data it needs has been loaded
+struct FQueueTranscodeTask
+{
+	TGraphTask<FTranscodeTask>* Task;
+	uint32 Priority;
+
+	FQueueTranscodeTask(TGraphTask<FTranscodeTask>* InTask, uint32 InPriority)
+		: Task(InTask)
+		, Priority(InPriority)
+	{}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		GTranscodeTaskScheduler.Enqueue(Task, Priority);
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::FireAndForget; }
+	ENamedThreads::Type GetDesiredThread() { return ENamedThreads::AnyNormalThreadHiPriTask; }
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(QueueTranscodeJob, STATGROUP_VTP);
+	}
+};
+
 FVirtualTextureTranscodeCache::FVirtualTextureTranscodeCache()
 {
 	Tasks.AddDefaulted(LIST_COUNT);
@@ -332,7 +454,28 @@ FVTTranscodeTileHandle FVirtualTextureTranscodeCache::SubmitTask(FVirtualTexture
 		}
 	}
 
-	TaskEntry.GraphEvent = TGraphTask<FTranscodeTask>::CreateTask(InPrerequisites).ConstructAndDispatchWhenReady(StagingBuffer, InParams);
+	// The task is held until its data is loaded and the scheduler has a free slot for it
+	TGraphTask<FTranscodeTask>* Task = TGraphTask<FTranscodeTask>::CreateTask().ConstructAndHold(StagingBuffer, InParams);
+	TaskEntry.GraphEvent = Task->GetCompletionEvent();
+
+	const uint32 Priority = FTranscodeTaskScheduler::GetPriority(InParams);
+	bool bPrerequisitesComplete = true;
+	if (InPrerequisites)
+	{
+		for (const FGraphEventRef& Prerequisite : *InPrerequisites)
+		{
+			bPrerequisitesComplete &= Prerequisite->IsComplete();
+		}
+	}
+
+	if (bPrerequisitesComplete)
+	{
+		GTranscodeTaskScheduler.Enqueue(Task, Priority);
+	}
+	else
+	{
+		TGraphTask<FQueueTranscodeTask>::CreateTask(InPrerequisites).ConstructAndDispatchWhenReady(Task, Priority);
+	}
 
 	return FVTTranscodeTileHandle(TaskIndex, TaskEntry.Magic);
 }
@@ -17,9 +17,11 @@ struct FVTTranscodeParams
 	const FVirtualTextureCodec* Codec;
 	const FVirtualTextureBuiltData* VTData;
 	uint32 ChunkIndex;
+	uint32 DataOffset; // offset of the first requested layer of the tile in Data, which may hold the neighbouring tiles of the chunk
 	uint32 vAddress;
 	uint8 vLevel;
 	uint8 LayerMask;
+	EVTRequestPagePriority Priority;
 };
 
 union FVTTranscodeTileHandle
@@ -186,6 +186,63 @@ void FVirtualTextureUploadCache::ReleaseRHI()
 	Tiles.Empty();
 }
 
+void FVirtualTextureUploadCache::AllocateTileMemory(FRHICommandListImmediate& RHICmdList, FTileEntry& Entry, EPixelFormat InFormat, uint32 InTileSize)
+{
+	const FPixelFormatInfo& FormatInfo = GPixelFormats[InFormat];
+	const uint32 TileWidthInBlocks = FMath::DivideAndRoundUp(InTileSize, (uint32)FormatInfo.BlockSizeX);
+	const uint32 TileHeightInBlocks = FMath::DivideAndRoundUp(InTileSize, (uint32)FormatInfo.BlockSizeY);
+	const uint32 Stride = TileWidthInBlocks * FormatInfo.BlockBytes;
+	const uint32 MemorySize = Stride * TileHeightInBlocks;
+
+	// We support several different methods for staging tile data to GPU textures
+	// On some platforms, CPU can write linear texture data to persist mapped buffer, then this can be uploaded directly to GPU...this is fastest method
+	// Otherwise, CPU writes texture data to temp buffer, then this is copied to GPU via a batched staging texture...this involves more copying, but is best method under default D3D11
+	// Can potentially write each tile to a separate staging texture, but this has too much lock/unlock overhead
+	Entry.Stride = Stride;
+	Entry.MemorySize = MemorySize;
+
+	// Stage to persist mapped GPU buffer then GPU copy into texture
+	// this is fast where supported
+	if (GRHISupportsDirectGPUMemoryLock)
+	{
+		FRHIResourceCreateInfo CreateInfo;
+		Entry.RHIStagingBuffer = RHICreateStructuredBuffer(FormatInfo.BlockBytes, MemorySize, BUF_ShaderResource | BUF_Static | BUF_KeepCPUAccessible, CreateInfo);
+
+		// Here we bypass 'normal' RHI operations in order to get a persistent pointer to GPU memory, on supported platforms
+		// This should be encapsulated into a proper RHI method at some point
+		Entry.Memory = RHICmdList.LockStructuredBuffer(Entry.RHIStagingBuffer, 0u, MemorySize, RLM_WriteOnly_NoOverwrite);
+
+		INC_MEMORY_STAT_BY(STAT_TotalGPUUploadSize, MemorySize);
+	}
+	else
+	{
+		Entry.Memory = FMemory::Malloc(MemorySize);
+		INC_MEMORY_STAT_BY(STAT_TotalCPUUploadSize, MemorySize);
+	}
+	INC_DWORD_STAT(STAT_NumUploadEntries);
+}
+
+void FVirtualTextureUploadCache::ReleaseTileMemory(FRHICommandListImmediate& RHICmdList, FTileEntry& Entry)
+{
+	check(Entry.Memory);
+	if (Entry.RHIStagingBuffer)
+	{
+		RHICmdList.UnlockStructuredBuffer(Entry.RHIStagingBuffer);
+		Entry.RHIStagingBuffer.SafeRelease();
+		DEC_MEMORY_STAT_BY(STAT_TotalGPUUploadSize, Entry.MemorySize);
+	}
+	else
+	{
+		FMemory::Free(Entry.Memory);
+		DEC_MEMORY_STAT_BY(STAT_TotalCPUUploadSize, Entry.MemorySize);
+	}
+	DEC_DWORD_STAT(STAT_NumUploadEntries);
+
+	Entry.Memory = nullptr;
+	Entry.MemorySize = 0u;
+	Entry.Stride = 0u;
+}
+
 FVTUploadTileHandle FVirtualTextureUploadCache::PrepareTileForUpload(FVTUploadTileBuffer& OutBuffer, EPixelFormat InFormat, uint32 InTileSize)
 {
 	SCOPE_CYCLE_COUNTER(STAT_VTP_StageTile)
@@ -200,40 +257,6 @@ FVTUploadTileHandle FVirtualTextureUploadCache::PrepareTileForUpload(FVTUploadTi
 	if (Index == PoolEntry.FreeTileListHead)
 	{
 		Index = CreateTileEntry(PoolIndex);
-		FTileEntry& NewEntry = Tiles[Index];
-
-		const FPixelFormatInfo& FormatInfo = GPixelFormats[InFormat];
-		const uint32 TileWidthInBlocks = FMath::DivideAndRoundUp(InTileSize, (uint32)FormatInfo.BlockSizeX);
-		const uint32 TileHeightInBlocks = FMath::DivideAndRoundUp(InTileSize, (uint32)FormatInfo.BlockSizeY);
-		const uint32 Stride = TileWidthInBlocks * FormatInfo.BlockBytes;
-		const uint32 MemorySize = Stride * TileHeightInBlocks;
-
-		// We support several different methods for staging tile data to GPU textures
-		// On some platforms, CPU can write linear texture data to persist mapped buffer, then this can be uploaded directly to GPU...this is fastest method
-		// Otherwise, CPU writes texture data to temp buffer, then this is copied to GPU via a batched staging texture...this involves more copying, but is best method under default D3D11
-		// Can potentially write each tile to a separate staging texture, but this has too much lock/unlock overhead
-		NewEntry.Stride = Stride;
-		NewEntry.MemorySize = MemorySize;
-
-		// Stage to persist mapped GPU buffer then GPU copy into texture
-		// this is fast where supported
-		if (GRHISupportsDirectGPUMemoryLock)
-		{
-			FRHIResourceCreateInfo CreateInfo;
-			NewEntry.RHIStagingBuffer = RHICreateStructuredBuffer(FormatInfo.BlockBytes, MemorySize, BUF_ShaderResource | BUF_Static | BUF_KeepCPUAccessible, CreateInfo);
-
-			// Here we bypass 'normal' RHI operations in order to get a persistent pointer to GPU memory, on supported platforms
-			// This should be encapsulated into a proper RHI method at some point
-			NewEntry.Memory = RHICmdList.LockStructuredBuffer(NewEntry.RHIStagingBuffer, 0u, MemorySize, RLM_WriteOnly_NoOverwrite);
-
-			INC_MEMORY_STAT_BY(STAT_TotalGPUUploadSize, MemorySize);
-		}
-		else
-		{
-			NewEntry.Memory = FMemory::Malloc(MemorySize);
-			INC_MEMORY_STAT_BY(STAT_TotalCPUUploadSize, MemorySize);
-		}
-		INC_DWORD_STAT(STAT_NumUploadEntries);
 	}
 	else
 	{
@@ -241,6 +264,10 @@ FVTUploadTileHandle FVirtualTextureUploadCache::PrepareTileForUpload(FVTUploadTi
 	}
 
 	FTileEntry& Entry = Tiles[Index];
+	if (!Entry.Memory)
+	{
+		AllocateTileMemory(RHICmdList, Entry, InFormat, InTileSize);
+	}
 	++NumPendingTiles;
 	
 	OutBuffer.Memory = Entry.Memory;
@@ -332,3 +359,24 @@ void FVirtualTextureUploadCache::UpdateFreeList()
 		Index = NextIndex;
 	}
 }
+
+void FVirtualTextureUploadCache::TrimFreeTiles(uint32 MaxFreeTiles)
+{
+	check(IsInRenderingThread());
+	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+
+	// Tiles are reused from the head of the free lists, so keep the memory of the tiles closest to it
+	uint32 NumFreeTiles = 0u;
+	for (const FPoolEntry& PoolEntry : Pools)
+	{
+		const int32 FreeListHead = PoolEntry.FreeTileListHead;
+		for (int32 Index = Tiles[FreeListHead].NextIndex; Index != FreeListHead; Index = Tiles[Index].NextIndex)
+		{
+			FTileEntry& Entry = Tiles[Index];
+			if (Entry.Memory && ++NumFreeTiles > MaxFreeTiles)
+			{
+				ReleaseTileMemory(RHICmdList, Entry);
+			}
+		}
+	}
+}
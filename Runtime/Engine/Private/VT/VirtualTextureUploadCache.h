@@ -48,6 +48,9 @@ public:
 
 	void UpdateFreeList();
 
+	/** Releases the memory of free tiles above the given number, it's allocated again when the tiles are reused */
+	void TrimFreeTiles(uint32 MaxFreeTiles);
+
 private:
 	enum EListType
 	{
@@ -99,6 +102,9 @@ private:
 
 	int32 GetOrCreatePoolIndex(EPixelFormat InFormat, uint32 InTileSize);
 
+	void AllocateTileMemory(FRHICommandListImmediate& RHICmdList, FTileEntry& Entry, EPixelFormat InFormat, uint32 InTileSize);
+	void ReleaseTileMemory(FRHICommandListImmediate& RHICmdList, FTileEntry& Entry);
+
 	int32 CreateTileEntry(int32 PoolIndex)
 	{
 		const int32 Index = Tiles.AddDefaulted();
@@ -0,0 +1,493 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#include "VisualLogger/VisualLoggerBinaryFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Algo/StableSort.h"
+#include "VisualLogger/VisualLogger.h"
+
+#if ENABLE_VISUAL_LOG
+
+namespace
+{
+	// Bounds the memory used by a chunk when a lot is logged within the chunk length
+	const int32 MaxItemsPerChunk = 16 * 1024;
+
+	void SerializeChunkHeader(FArchive& Ar, FVisualLogChunkInfo& Chunk)
+	{
+		Ar << Chunk.Version;
+		Ar << Chunk.StartTime;
+		Ar << Chunk.EndTime;
+
+		int32 NumOwners = Chunk.Owners.Num();
+		Ar << NumOwners;
+		if (Ar.IsLoading())
+		{
+			if (NumOwners < 0)
+			{
+				Ar.SetError();
+				return;
+			}
+			Chunk.Owners.SetNum(NumOwners);
+		}
+
+		for (FVisualLogChunkOwner& Owner : Chunk.Owners)
+		{
+			FVisualLoggerHelpers::Serialize(Ar, Owner.OwnerName);
+
+			int32 NumCategories = Owner.Categories.Num();
+			Ar << NumCategories;
+			if (Ar.IsLoading())
+			{
+				if (NumCategories < 0)
+				{
+					Ar.SetError();
+					return;
+				}
+				Owner.Categories.SetNum(NumCategories);
+			}
+			for (FName& Category : Owner.Categories)
+			{
+				FVisualLoggerHelpers::Serialize(Ar, Category);
+			}
+
+			Ar << Owner.StartTime;
+			Ar << Owner.EndTime;
+			Ar << Owner.Offset;
+			Ar << Owner.Size;
+		}
+
+		Ar << Chunk.bCompressed;
+		Ar << Chunk.UncompressedSize;
+		Ar << Chunk.PayloadSize;
+	}
+
+	void SerializeIndex(FArchive& Ar, TArray<FVisualLogChunkInfo>& Chunks)
+	{
+		int32 NumChunks = Chunks.Num();
+		Ar << NumChunks;
+		if (Ar.IsLoading())
+		{
+			if (NumChunks < 0)
+			{
+				Ar.SetError();
+				return;
+			}
+			Chunks.SetNum(NumChunks);
+		}
+
+		for (FVisualLogChunkInfo& Chunk : Chunks)
+		{
+			Ar << Chunk.PayloadOffset;
+			SerializeChunkHeader(Ar, Chunk);
+		}
+	}
+}
+
+//----------------------------------------------------------------------//
+// FVisualLoggerBinaryFile
+//----------------------------------------------------------------------//
+void FVisualLoggerBinaryFile::WriteChunk(FArchive& Ar, TArray<FVisualLogDevice::FVisualLogEntryItem>& Items, bool bCompress, FVisualLogChunkInfo& OutChunk)
+{
+	// Group the items by owner, in the order the owners first logged in
+	TMap<FName, TArray<int32>> OwnerItems;
+	for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+	{
+		OwnerItems.FindOrAdd(Items[ItemIndex].OwnerName).Add(ItemIndex);
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Writer.UsingCustomVersion(EVisualLoggerVersion::GUID);
+
+	OutChunk.Version = Writer.CustomVer(EVisualLoggerVersion::GUID);
+	OutChunk.StartTime = MAX_flt;
+	OutChunk.EndTime = -MAX_flt;
+	OutChunk.Owners.Reset(OwnerItems.Num());
+
+	TArray<FVisualLoggerCategoryVerbosityPair> Categories;
+	for (const TPair<FName, TArray<int32>>& Pair : OwnerItems)
+	{
+		FVisualLogChunkOwner& Owner = OutChunk.Owners.AddDefaulted_GetRef();
+		Owner.OwnerName = Pair.Key;
+		Owner.StartTime = MAX_flt;
+		Owner.EndTime = -MAX_flt;
+		Owner.Offset = (uint32)Writer.Tell();
+
+		FName OwnerClassName = Items[Pair.Value[0]].OwnerClassName;
+		FVisualLoggerHelpers::Serialize(Writer, OwnerClassName);
+
+		int32 NumEntries = Pair.Value.Num();
+		Writer << NumEntries;
+
+		Categories.Reset();
+		for (const int32 ItemIndex : Pair.Value)
+		{
+			FVisualLogEntry& Entry = Items[ItemIndex].Entry;
+			Writer << Entry;
+
+			Owner.StartTime = FMath::Min(Owner.StartTime, Entry.TimeStamp);
+			Owner.EndTime = FMath::Max(Owner.EndTime, Entry.TimeStamp);
+			FVisualLoggerHelpers::GetCategories(Entry, Categories);
+		}
+
+		for (const FVisualLoggerCategoryVerbosityPair& Category : Categories)
+		{
+			Owner.Categories.AddUnique(Category.CategoryName);
+		}
+
+		Owner.Size = (uint32)Writer.Tell() - Owner.Offset;
+		OutChunk.StartTime = FMath::Min(OutChunk.StartTime, Owner.StartTime);
+		OutChunk.EndTime = FMath::Max(OutChunk.EndTime, Owner.EndTime);
+	}
+
+	OutChunk.UncompressedSize = Data.Num();
+	OutChunk.bCompressed = false;
+
+	TArray<uint8> CompressedData;
+	if (bCompress)
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Data.Num());
+		CompressedData.SetNumUninitialized(CompressedSize);
+		if (FCompression::CompressMemory(NAME_Zlib, CompressedData.GetData(), CompressedSize, Data.GetData(), Data.Num()) && CompressedSize < Data.Num())
+		{
+			CompressedData.SetNum(CompressedSize, false);
+			OutChunk.bCompressed = true;
+		}
+	}
+
+	TArray<uint8>& Payload = OutChunk.bCompressed ? CompressedData : Data;
+	OutChunk.PayloadSize = Payload.Num();
+
+	int32 ChunkTag = VISUAL_LOGGER_CHUNK_MAGIC_NUMBER;
+	Ar << ChunkTag;
+	SerializeChunkHeader(Ar, OutChunk);
+	OutChunk.PayloadOffset = Ar.Tell();
+	Ar.Serialize(Payload.GetData(), Payload.Num());
+}
+
+void FVisualLoggerBinaryFile::WriteIndex(FArchive& Ar, TArray<FVisualLogChunkInfo>& Chunks)
+{
+	int64 IndexOffset = Ar.Tell();
+	int32 IndexTag = VISUAL_LOGGER_INDEX_MAGIC_NUMBER;
+	Ar << IndexTag;
+	SerializeIndex(Ar, Chunks);
+
+	// Footer, readers find the index from the end of the file
+	Ar << IndexOffset;
+	Ar << IndexTag;
+}
+
+void FVisualLoggerBinaryFile::ReadChunk(FArchive& Ar, TArray<FVisualLogDevice::FVisualLogEntryItem>& OutItems)
+{
+	FVisualLogChunkInfo Chunk;
+	SerializeChunkHeader(Ar, Chunk);
+	Chunk.PayloadOffset = Ar.Tell();
+
+	const int64 ChunkEnd = Chunk.PayloadOffset + Chunk.PayloadSize;
+	if (Ar.IsError() || ChunkEnd > Ar.TotalSize())
+	{
+		// Last chunk of a recording that didn't finish
+		Ar.Seek(Ar.TotalSize());
+		return;
+	}
+
+	ReadChunkItems(Ar, Chunk, -MAX_flt, MAX_flt, NAME_None, OutItems);
+	Ar.Seek(ChunkEnd);
+}
+
+void FVisualLoggerBinaryFile::ReadChunkItems(FArchive& Ar, const FVisualLogChunkInfo& Chunk, float StartTime, float EndTime, FName OwnerName, TArray<FVisualLogDevice::FVisualLogEntryItem>& OutItems)
+{
+	auto IsOwnerNeeded = [&](const FVisualLogChunkOwner& Owner)
+	{
+		return (OwnerName.IsNone() || Owner.OwnerName == OwnerName) && Owner.EndTime >= StartTime && Owner.StartTime <= EndTime;
+	};
+
+	if (!Chunk.Owners.ContainsByPredicate(IsOwnerNeeded))
+	{
+		return;
+	}
+
+	TArray<uint8> Data;
+	Ar.Seek(Chunk.PayloadOffset);
+	if (Chunk.bCompressed)
+	{
+		TArray<uint8> CompressedData;
+		CompressedData.SetNumUninitialized(Chunk.PayloadSize);
+		Ar.Serialize(CompressedData.GetData(), Chunk.PayloadSize);
+
+		Data.SetNumUninitialized(Chunk.UncompressedSize);
+		if (!FCompression::UncompressMemory(NAME_Zlib, Data.GetData(), Chunk.UncompressedSize, CompressedData.GetData(), Chunk.PayloadSize))
+		{
+			UE_LOG(LogVisual, Warning, TEXT("Failed to decompress vislog chunk at offset %lld"), Chunk.PayloadOffset);
+			return;
+		}
+	}
+	else
+	{
+		Data.SetNumUninitialized(Chunk.PayloadSize);
+		Ar.Serialize(Data.GetData(), Chunk.PayloadSize);
+	}
+
+	FMemoryReader Reader(Data);
+	Reader.SetCustomVersion(EVisualLoggerVersion::GUID, Chunk.Version, TEXT("VisualLogger"));
+
+	const int32 FirstItemIndex = OutItems.Num();
+	for (const FVisualLogChunkOwner& Owner : Chunk.Owners)
+	{
+		if (!IsOwnerNeeded(Owner))
+		{
+			continue;
+		}
+
+		Reader.Seek(Owner.Offset);
+
+		FName OwnerClassName;
+		FVisualLoggerHelpers::Serialize(Reader, OwnerClassName);
+
+		int32 NumEntries = 0;
+		Reader << NumEntries;
+		for (int32 EntryIndex = 0; EntryIndex < NumEntries && !Reader.IsError(); ++EntryIndex)
+		{
+			FVisualLogDevice::FVisualLogEntryItem& Item = OutItems.AddDefaulted_GetRef();
+			Item.OwnerName = Owner.OwnerName;
+			Item.OwnerClassName = OwnerClassName;
+			Reader << Item.Entry;
+
+			if (Item.Entry.TimeStamp < StartTime || Item.Entry.TimeStamp > EndTime)
+			{
+				OutItems.Pop(false);
+			}
+		}
+	}
+
+	// Columns are per owner, put the items back in the order they were logged
+	Algo::StableSortBy(MakeArrayView(OutItems).Slice(FirstItemIndex, OutItems.Num() - FirstItemIndex), [](const FVisualLogDevice::FVisualLogEntryItem& Item) { return Item.Entry.TimeStamp; });
+}
+
+//----------------------------------------------------------------------//
+// FVisualLoggerBinaryFileWriter
+//----------------------------------------------------------------------//
+FVisualLoggerBinaryFileWriter::FVisualLoggerBinaryFileWriter(FArchive& InFileArchive, bool bInCompress, float InChunkLength)
+	: FileArchive(InFileArchive)
+	, Thread(nullptr)
+	, WorkEvent(nullptr)
+	, ChunkLength(InChunkLength)
+	, bCompress(bInCompress)
+	, bClosed(false)
+{
+	// Without threads the items are written when they are queued
+	if (FPlatformProcess::SupportsMultithreading())
+	{
+		WorkEvent = FPlatformProcess::GetSynchEventFromPool();
+		Thread = FRunnableThread::Create(this, TEXT("FVisualLoggerBinaryFileWriter"), 0, TPri_BelowNormal);
+	}
+}
+
+FVisualLoggerBinaryFileWriter::~FVisualLoggerBinaryFileWriter()
+{
+	// Discards the items that are still queued when the writer wasn't closed
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (WorkEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		WorkEvent = nullptr;
+	}
+}
+
+void FVisualLoggerBinaryFileWriter::Write(TArray<FVisualLogDevice::FVisualLogEntryItem>&& Items)
+{
+	check(!bClosed);
+	if (Items.Num() == 0)
+	{
+		return;
+	}
+
+	QueuedItems.Enqueue(MoveTemp(Items));
+	if (Thread)
+	{
+		WorkEvent->Trigger();
+	}
+	else
+	{
+		WriteQueuedItems(false);
+	}
+}
+
+void FVisualLoggerBinaryFileWriter::Close()
+{
+	if (bClosed)
+	{
+		return;
+	}
+	bClosed = true;
+
+	if (Thread)
+	{
+		Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	WriteQueuedItems(true);
+	if (Chunks.Num() > 0)
+	{
+		FVisualLoggerBinaryFile::WriteIndex(FileArchive, Chunks);
+	}
+}
+
+uint32 FVisualLoggerBinaryFileWriter::Run()
+{
+	while (StopTaskCounter.GetValue() == 0)
+	{
+		WorkEvent->Wait();
+		WriteQueuedItems(false);
+	}
+	return 0;
+}
+
+void FVisualLoggerBinaryFileWriter::Stop()
+{
+	StopTaskCounter.Increment();
+	WorkEvent->Trigger();
+}
+
+void FVisualLoggerBinaryFileWriter::WriteQueuedItems(bool bFlush)
+{
+	TArray<FVisualLogDevice::FVisualLogEntryItem> Items;
+	while (QueuedItems.Dequeue(Items))
+	{
+		for (FVisualLogDevice::FVisualLogEntryItem& Item : Items)
+		{
+			if (ChunkItems.Num() >= MaxItemsPerChunk || (ChunkItems.Num() > 0 && Item.Entry.TimeStamp >= ChunkItems[0].Entry.TimeStamp + ChunkLength))
+			{
+				WriteChunk();
+			}
+			ChunkItems.Add(MoveTemp(Item));
+		}
+	}
+
+	if (bFlush && ChunkItems.Num() > 0)
+	{
+		WriteChunk();
+	}
+}
+
+void FVisualLoggerBinaryFileWriter::WriteChunk()
+{
+	FVisualLoggerBinaryFile::WriteChunk(FileArchive, ChunkItems, bCompress, Chunks.AddDefaulted_GetRef());
+	ChunkItems.Reset();
+}
+
+//----------------------------------------------------------------------//
+// FVisualLoggerBinaryFileReader
+//----------------------------------------------------------------------//
+FVisualLoggerBinaryFileReader::~FVisualLoggerBinaryFileReader()
+{
+	Close();
+}
+
+bool FVisualLoggerBinaryFileReader::Open(const FString& Filename)
+{
+	Close();
+
+	FileArchive = IFileManager::Get().CreateFileReader(*Filename);
+	if (FileArchive == nullptr)
+	{
+		return false;
+	}
+
+	FArchive& Ar = *FileArchive;
+	const int64 FileSize = Ar.TotalSize();
+	const int64 FooterSize = sizeof(int64) + sizeof(int32);
+	if (FileSize >= FooterSize)
+	{
+		int64 IndexOffset = 0;
+		int32 IndexTag = 0;
+		Ar.Seek(FileSize - FooterSize);
+		Ar << IndexOffset;
+		Ar << IndexTag;
+		if (IndexTag == VISUAL_LOGGER_INDEX_MAGIC_NUMBER && IndexOffset >= 0 && IndexOffset < FileSize - FooterSize)
+		{
+			Ar.Seek(IndexOffset);
+			Ar << IndexTag;
+			SerializeIndex(Ar, Chunks);
+			if (Ar.IsError())
+			{
+				Chunks.Reset();
+				Ar.ClearError();
+			}
+		}
+	}
+
+	if (Chunks.Num() == 0)
+	{
+		// No index, the recording didn't finish so find the chunks that were written
+		Ar.Seek(0);
+		while (!Ar.AtEnd())
+		{
+			int32 ChunkTag = 0;
+			Ar << ChunkTag;
+			if (ChunkTag != VISUAL_LOGGER_CHUNK_MAGIC_NUMBER)
+			{
+				break;
+			}
+
+			FVisualLogChunkInfo Chunk;
+			SerializeChunkHeader(Ar, Chunk);
+			Chunk.PayloadOffset = Ar.Tell();
+			if (Ar.IsError() || Chunk.PayloadOffset + Chunk.PayloadSize > FileSize)
+			{
+				break;
+			}
+
+			Ar.Seek(Chunk.PayloadOffset + Chunk.PayloadSize);
+			Chunks.Add(MoveTemp(Chunk));
+		}
+		Ar.ClearError();
+	}
+
+	if (Chunks.Num() == 0)
+	{
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void FVisualLoggerBinaryFileReader::Close()
+{
+	delete FileArchive;
+	FileArchive = nullptr;
+	Chunks.Reset();
+}
+
+void FVisualLoggerBinaryFileReader::ReadItems(float StartTime, float EndTime, FName OwnerName, TArray<FVisualLogDevice::FVisualLogEntryItem>& OutItems)
+{
+	if (FileArchive == nullptr)
+	{
+		return;
+	}
+
+	for (const FVisualLogChunkInfo& Chunk : Chunks)
+	{
+		if (Chunk.EndTime >= StartTime && Chunk.StartTime <= EndTime)
+		{
+			FVisualLoggerBinaryFile::ReadChunkItems(*FileArchive, Chunk, StartTime, EndTime, OwnerName, OutItems);
+		}
+	}
+}
+
+#endif //ENABLE_VISUAL_LOG
@@ -4,11 +4,13 @@
 #include "Misc/Paths.h"
 #include "Misc/ConfigCacheIni.h"
 #include "VisualLogger/VisualLogger.h"
+#include "VisualLogger/VisualLoggerBinaryFile.h"
 
 #if ENABLE_VISUAL_LOG
 
 FVisualLoggerBinaryFileDevice::FVisualLoggerBinaryFileDevice()
 	: FileArchive(nullptr)
+	, FileWriter(nullptr)
 {
 	Cleanup();
 
@@ -19,6 +21,9 @@ FVisualLoggerBinaryFileDevice::FVisualLoggerBinaryFileDevice()
 	bool UseCompression = false;
 	GConfig->GetBool(TEXT("VisualLogger"), TEXT("UseCompression"), UseCompression, GEngineIni);
 	bUseCompression = UseCompression;
+
+	ChunkLength = 1.0f;
+	GConfig->GetFloat(TEXT("VisualLogger"), TEXT("ChunkLength"), ChunkLength, GEngineIni);
 }
 
 void FVisualLoggerBinaryFileDevice::Cleanup(bool bReleaseMemory)
@@ -42,6 +47,10 @@ void FVisualLoggerBinaryFileDevice::StartRecordingToFile(float TimeStamp)
 	
 	const FString FullFilename = FPaths::Combine(*FPaths::ProjectLogDir(), *TempFileName);
 	FileArchive = IFileManager::Get().CreateFileWriter(*FullFilename);
+	if (FileArchive)
+	{
+		FileWriter = new FVisualLoggerBinaryFileWriter(*FileArchive, bUseCompression, ChunkLength);
+	}
 }
 
 void FVisualLoggerBinaryFileDevice::StopRecordingToFile(float TimeStamp)
@@ -51,12 +60,11 @@ void FVisualLoggerBinaryFileDevice::StopRecordingToFile(float TimeStamp)
 		return;
 	}
 
-	const int32 NumEntries = FrameCache.Num();
-	if (NumEntries> 0)
-	{
-		FVisualLoggerHelpers::Serialize(*FileArchive, FrameCache);
-		FrameCache.Reset();
-	}
+	FileWriter->Write(MoveTemp(FrameCache));
+	FrameCache.Reset();
+	FileWriter->Close();
+	delete FileWriter;
+	FileWriter = nullptr;
 
 	const int64 TotalSize = FileArchive->TotalSize();
 	FileArchive->Close();
@@ -85,6 +93,10 @@ void FVisualLoggerBinaryFileDevice::DiscardRecordingToFile()
 {
 	if (FileArchive)
 	{
+		// drops the items that were not written yet
+		delete FileWriter;
+		FileWriter = nullptr;
+
 		FileArchive->Close();
 		delete FileArchive;
 		FileArchive = nullptr;
@@ -102,9 +114,10 @@ void FVisualLoggerBinaryFileDevice::SetFileName(const FString& InFileName)
 void FVisualLoggerBinaryFileDevice::Serialize(const UObject* LogOwner, FName OwnerName, FName OwnerClassName, const FVisualLogEntry& LogEntry)
 {
 	const int32 NumEntries = FrameCache.Num();
-	if (NumEntries> 0 && LastLogTimeStamp + FrameCacheLenght <= LogEntry.TimeStamp && FileArchive)
+	if (NumEntries> 0 && LastLogTimeStamp + FrameCacheLenght <= LogEntry.TimeStamp && FileWriter)
 	{
-		FVisualLoggerHelpers::Serialize(*FileArchive, FrameCache);
+		// serialization and compression happen on the writer thread
+		FileWriter->Write(MoveTemp(FrameCache));
 		FrameCache.Reset();
 	}
 
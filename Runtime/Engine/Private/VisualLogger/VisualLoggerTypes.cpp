@@ -4,6 +4,7 @@
 #include "Engine/World.h"
 #include "Misc/Paths.h"
 #include "VisualLogger/VisualLoggerDebugSnapshotInterface.h"
+#include "VisualLogger/VisualLoggerBinaryFile.h"
 
 namespace
 {
@@ -529,6 +530,13 @@ FArchive& FVisualLoggerHelpers::Serialize(FArchive& Ar, TArray<FVisualLogDevice:
 		{
 			int32 FrameTag = VISUAL_LOGGER_MAGIC_NUMBER;
 			Ar << FrameTag;
+			if (FrameTag == VISUAL_LOGGER_CHUNK_MAGIC_NUMBER)
+			{
+				FVisualLoggerBinaryFile::ReadChunk(Ar, RecordedLogs);
+				continue;
+			}
+
+			// files made of chunks end with their index
 			if (FrameTag != DEPRECATED_VISUAL_LOGGER_MAGIC_NUMBER && FrameTag != VISUAL_LOGGER_MAGIC_NUMBER)
 			{
 				break;
@@ -66,6 +66,7 @@
 #include "AudioDeviceManager.h"
 #include "VisualLogger/VisualLogger.h"
 #include "LevelUtils.h"
+#include "LevelStreamingScheduler.h"
 #include "Physics/PhysicsInterfaceCore.h"
 #include "Physics/Experimental/PhysScene_Chaos.h"
 #include "AI/AISystemBase.h"
@@ -2370,6 +2371,37 @@ private:
 
 #endif // PERF_TRACK_DETAILED_ASYNC_STATS
 
+double UWorld::ClampToLevelStreamingFrameBudget(double TimeLimit)
+{
+	if (GLevelStreamingFrameTimeBudget <= 0.0f)
+	{
+		return TimeLimit;
+	}
+
+	if (LevelStreamingFrameBudgetFrameNumber != GFrameCounter)
+	{
+		LevelStreamingFrameBudgetFrameNumber = GFrameCounter;
+		LevelStreamingFrameTimeSpent = 0.0;
+	}
+
+	// Callers check the limit after each step, so even an exhausted budget lets them make one step of progress
+	const double RemainingBudget = FMath::Max(GLevelStreamingFrameTimeBudget - LevelStreamingFrameTimeSpent * 1000.0, 0.0);
+	return FMath::Min(TimeLimit, RemainingBudget);
+}
+
+void UWorld::ChargeLevelStreamingFrameBudget(double StartTime)
+{
+	if (GLevelStreamingFrameTimeBudget > 0.0f)
+	{
+		if (LevelStreamingFrameBudgetFrameNumber != GFrameCounter)
+		{
+			LevelStreamingFrameBudgetFrameNumber = GFrameCounter;
+			LevelStreamingFrameTimeSpent = 0.0;
+		}
+		LevelStreamingFrameTimeSpent += FPlatformTime::Seconds() - StartTime;
+	}
+}
+
 void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool bConsiderTimeLimit )
 {
 	SCOPE_CYCLE_COUNTER(STAT_AddToWorldTime);
@@ -2430,6 +2462,8 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 				TimeLimit += GPriorityLevelStreamingActorsUpdateExtraTime;
 			}
 		}
+
+		TimeLimit = ClampToLevelStreamingFrameBudget(TimeLimit);
 	}
 
 	if( bExecuteNextStep && !Level->bAlreadyMovedActors )
@@ -2520,12 +2554,22 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 		
 		// Incrementally update components.
 		int32 NumComponentsToUpdate = (!bConsiderTimeLimit || !IsGameWorld() || IsRunningCommandlet() ? 0 : GLevelStreamingComponentsRegistrationGranularity);
+
+		// Primitives registered during this time slice get their scene proxies created in parallel once the slice is over, rather than one at a time.
+		// Everything else, including physics state creation, still happens as each component registers.
+		FRegisterComponentContext Context(this);
+		FRegisterComponentContext* ContextPtr = GLevelStreamingParallelComponentRegistration ? &Context : nullptr;
 		do
 		{
-			Level->IncrementalUpdateComponents( NumComponentsToUpdate, bRerunConstructionScript );
+			Level->IncrementalUpdateComponents( NumComponentsToUpdate, bRerunConstructionScript, ContextPtr );
 		}
 		while (!Level->bAreComponentsCurrentlyRegistered && !IsTimeLimitExceeded(TEXT("updating components"), StartTime, Level, TimeLimit));
 
+		{
+			QUICK_SCOPE_CYCLE_COUNTER(STAT_AddToWorldTime_UpdatingComponents_AddPrimitives);
+			Context.Process();
+		}
+
 		// We are done once all components are attached.
 		Level->bAlreadyUpdatedComponents	= Level->bAreComponentsCurrentlyRegistered;
 		bExecuteNextStep					= Level->bAreComponentsCurrentlyRegistered && (!bConsiderTimeLimit || !IsTimeLimitExceeded(TEXT("updating components"), StartTime, Level, TimeLimit));
@@ -2640,6 +2684,11 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 		}
 	}
 
+	if (bConsiderTimeLimit)
+	{
+		ChargeLevelStreamingFrameBudget(StartTime);
+	}
+
 #if PERF_TRACK_DETAILED_ASYNC_STATS
 	if (bPerformedLastStep)
 	{
@@ -2719,6 +2768,7 @@ void UWorld::RemoveFromWorld( ULevel* Level, bool bAllowIncrementalRemoval )
 				// This avoids spikes on the renderthread and gamethread when we subsequently call ClearLevelComponents() further down
 				check(IsGameWorld());
 				int32 NumComponentsToUnregister = GLevelStreamingComponentsUnregistrationGranularity;
+				const double TimeLimit = ClampToLevelStreamingFrameBudget(GLevelStreamingUnregisterComponentsTimeLimit);
 				do
 				{
 					if (Level->IncrementalUnregisterComponents(NumComponentsToUnregister))
@@ -2728,7 +2778,9 @@ void UWorld::RemoveFromWorld( ULevel* Level, bool bAllowIncrementalRemoval )
 						bFinishRemovingLevel = true;
 						break;
 					}
-				} while (!IsTimeLimitExceeded(TEXT("unregistering components"), StartTime, Level, GLevelStreamingUnregisterComponentsTimeLimit));
+				} while (!IsTimeLimitExceeded(TEXT("unregistering components"), StartTime, Level, TimeLimit));
+
+				ChargeLevelStreamingFrameBudget(StartTime);
 			}
 		}
 		else
@@ -3420,12 +3472,21 @@ void UWorld::UpdateLevelStreaming()
 
 	StreamingLevelsToConsider.BeginConsideration();
 
-	for (int32 Index = StreamingLevelsToConsider.GetStreamingLevels().Num() - 1; Index >= 0; --Index)
+	TArray<int32> UpdateOrder;
+	TArray<float> ViewDistances;
+	FLevelStreamingScheduler::GetUpdateOrder(this, StreamingLevelsToConsider.GetStreamingLevels(), UpdateOrder, ViewDistances);
+
+	for (int32 OrderIndex = 0; OrderIndex < UpdateOrder.Num(); ++OrderIndex)
 	{
+		const int32 Index = UpdateOrder[OrderIndex];
+		bool bShouldContinueToConsider = true;
+
 		if (ULevelStreaming* StreamingLevel = StreamingLevelsToConsider.GetStreamingLevels()[Index])
 		{
+			const ULevelStreaming::ECurrentState PreviousState = StreamingLevel->GetCurrentState();
+			const double UpdateStartTime = FPlatformTime::Seconds();
+
 			bool bUpdateAgain = true;
-			bool bShouldContinueToConsider = true;
 			while (bUpdateAgain && bShouldContinueToConsider)
 			{
 				bool bRedetermineTarget = false;
@@ -3437,14 +3498,25 @@ void UWorld::UpdateLevelStreaming()
 				}
 			}
 
-			if (!bShouldContinueToConsider)
-			{
-				StreamingLevelsToConsider.RemoveAt(Index);
-			}
+			FLevelStreamingScheduler::RecordUpdate(StreamingLevel, PreviousState, ViewDistances[OrderIndex], FPlatformTime::Seconds() - UpdateStartTime);
 		}
 		else
+		{
+			bShouldContinueToConsider = false;
+		}
+
+		if (!bShouldContinueToConsider)
 		{
 			StreamingLevelsToConsider.RemoveAt(Index);
+
+			// Keep the indices of the levels still to be updated pointing at the same levels
+			for (int32 PendingOrderIndex = OrderIndex + 1; PendingOrderIndex < UpdateOrder.Num(); ++PendingOrderIndex)
+			{
+				if (UpdateOrder[PendingOrderIndex] > Index)
+				{
+					--UpdateOrder[PendingOrderIndex];
+				}
+			}
 		}
 	}
 
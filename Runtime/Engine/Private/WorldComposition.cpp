@@ -33,7 +33,10 @@ UWorldComposition::UWorldComposition(const FObjectInitializer& ObjectInitializer
 	, bTemporallyDisableOriginTracking(false)
 	, bTemporarilyDisableOriginTracking(false)
 #endif
+	, TilesSpatialIndexQueryExtent(0.0f)
+	, bDistanceStreamedTilesValid(false)
 	, TilesStreamingTimeThreshold(1.0)
+	, TilesStreamingDistanceHysteresis(0.0f)
 	, bLoadAllTilesDuringCinematic(false)
 	, bRebaseOriginIn3DSpace(false)
 	, RebaseOriginDistance(HALF_WORLD_MAX1*0.5f)
@@ -62,6 +65,11 @@ void UWorldComposition::Serialize( FArchive& Ar )
 		Ar << WorldRoot;
 		Ar << Tiles;
 		Ar << TilesStreaming;
+
+		if (Ar.IsLoading())
+		{
+			InvalidateTilesSpatialIndex();
+		}
 	}
 }
 
@@ -372,6 +380,8 @@ void UWorldComposition::CaclulateTilesAbsolutePositions()
 		} 
 		while (ParentTile);
 	}
+
+	InvalidateTilesSpatialIndex();
 }
 
 void UWorldComposition::Reset()
@@ -379,6 +389,14 @@ void UWorldComposition::Reset()
 	WorldRoot.Empty();
 	Tiles.Empty();
 	TilesStreaming.Empty();
+	InvalidateTilesSpatialIndex();
+}
+
+void UWorldComposition::InvalidateTilesSpatialIndex()
+{
+	TilesSpatialIndex.Reset();
+	DistanceStreamedTiles.Reset();
+	bDistanceStreamedTilesValid = false;
 }
 
 int32 UWorldComposition::FindTileIndexByName(const FName& InPackageName) const
@@ -459,6 +477,8 @@ void UWorldComposition::OnTileInfoUpdated(const FName& InPackageName, const FWor
 		TilesStreaming.Add(CreateStreamingLevel(NewTile));
 		Tile = &Tiles.Last();
 	}
+
+	InvalidateTilesSpatialIndex();
 	
 	// Assign info to level package in case package is loaded
 	UPackage* LevelPackage = Cast<UPackage>(StaticFindObjectFast(UPackage::StaticClass(), NULL, Tile->PackageName));
@@ -504,6 +524,8 @@ void UWorldComposition::RestoreDirtyTilesInfo(const FTilesList& TilesPrevState)
 			}
 		}
 	}
+
+	InvalidateTilesSpatialIndex();
 }
 
 void UWorldComposition::CollectTilesToCook(TArray<FString>& PackageNames)
@@ -524,6 +546,8 @@ void UWorldComposition::CollectTilesToCook(TArray<FString>& PackageNames)
 void UWorldComposition::PopulateStreamingLevels()
 {
 	TilesStreaming.Empty(Tiles.Num());
+	DistanceStreamedTiles.Reset();
+	bDistanceStreamedTilesValid = false;
 	
 	for (const FWorldCompositionTile& Tile : Tiles)
 	{
@@ -547,83 +571,166 @@ void UWorldComposition::GetDistanceVisibleLevels(
 {
 	const UWorld* OwningWorld = GetWorld();
 
-	FIntPoint WorldOriginLocationXY = FIntPoint(OwningWorld->OriginLocation.X, OwningWorld->OriginLocation.Y);
-			
+	// Tiles that are not near any location are hidden without testing them
+	TBitArray<> TilesNearLocations(true, Tiles.Num());
+	if (!OwningWorld->IsNetMode(NM_DedicatedServer) && !IsRunningCommandlet())
+	{
+		TilesNearLocations.Init(false, Tiles.Num());
+		GetTilesNearLocations(InLocations, NumLocations, TilesNearLocations);
+	}
+
 	for (int32 TileIdx = 0; TileIdx < Tiles.Num(); TileIdx++)
 	{
-		const FWorldCompositionTile& Tile = Tiles[TileIdx];
-		
 		// Skip non distance based levels
 		if (!IsDistanceDependentLevel(TileIdx))
 		{
 			continue;
 		}
 
-		FDistanceVisibleLevel VisibleLevel = 
-		{
-			TileIdx,
-			TilesStreaming[TileIdx],
-			INDEX_NONE
-		};
-
-		bool bIsVisible = false;
-
-		if (OwningWorld->IsNetMode(NM_DedicatedServer))
+		if (TilesNearLocations[TileIdx])
 		{
-			// Dedicated server always loads all distance dependent tiles
-			bIsVisible = true;
+			GetTileDistanceVisibility(TileIdx, InLocations, NumLocations, OutVisibleLevels, OutHiddenLevels);
 		}
-		else if (IsRunningCommandlet())
+		else
 		{
-			// Commandlets have no concept of viewer location, so always load all distance-dependent tiles.
-			bIsVisible = true;
+			OutHiddenLevels.Add({ TileIdx, TilesStreaming[TileIdx], INDEX_NONE });
 		}
-		else
+	}
+}
+
+void UWorldComposition::GetTilesNearLocations(const FVector* InLocations, int32 NumLocations, TBitArray<>& OutTilesNearLocations) const
+{
+	const UWorld* OwningWorld = GetWorld();
+
+	if (!TilesSpatialIndex.IsValid())
+	{
+		// Index tile bounds in absolute space so that origin rebasing does not invalidate it
+		TArray<int32> IndexedTiles;
+		TArray<FBox2D> IndexedTileBoxes;
+		int32 MaxStreamingDistance = 0;
+		for (int32 TileIdx = 0; TileIdx < Tiles.Num(); ++TileIdx)
 		{
-			//
-			// Check if tile bounding box intersects with a sphere with origin at provided location and with radius equal to tile layer distance settings
-			//
-			FIntPoint LevelPositionXY = FIntPoint(Tile.Info.AbsolutePosition.X, Tile.Info.AbsolutePosition.Y);
-			FIntPoint LevelOffsetXY = LevelPositionXY - WorldOriginLocationXY;
-			FBox LevelBounds = Tile.Info.Bounds.ShiftBy(FVector(LevelOffsetXY));
-			// We don't care about third dimension yet
-			LevelBounds.Min.Z = -WORLD_MAX;
-			LevelBounds.Max.Z = +WORLD_MAX;
-				
-			int32 NumAvailableLOD = FMath::Min(Tile.Info.LODList.Num(), Tile.LODPackageNames.Num());
-			// Find LOD
-			// INDEX_NONE for original non-LOD level
-			for (int32 LODIdx = INDEX_NONE; LODIdx < NumAvailableLOD; ++LODIdx)
+			const FWorldCompositionTile& Tile = Tiles[TileIdx];
+			if (Tile.Info.Layer.DistanceStreamingEnabled)
 			{
-				if (bIsVisible && LODIdx > VisibleLevel.LODIndex)
-				{
-					// no point to loop more, we have visible tile with best possible LOD
-					break;
-				}
-				
-				int32 TileStreamingDistance = Tile.Info.GetStreamingDistance(LODIdx);
-				for (int32 LocationIdx = 0; LocationIdx < NumLocations; ++LocationIdx)
+				IndexedTiles.Add(TileIdx);
+				IndexedTileBoxes.Add(FBox2D(FVector2D(Tile.Info.Bounds.Min), FVector2D(Tile.Info.Bounds.Max)).ShiftBy(FVector2D(Tile.Info.AbsolutePosition.X, Tile.Info.AbsolutePosition.Y)));
+
+				const int32 NumAvailableLOD = FMath::Min(Tile.Info.LODList.Num(), Tile.LODPackageNames.Num());
+				for (int32 LODIdx = INDEX_NONE; LODIdx < NumAvailableLOD; ++LODIdx)
 				{
-					FSphere QuerySphere(InLocations[LocationIdx], TileStreamingDistance);
-					if (FMath::SphereAABBIntersection(QuerySphere, LevelBounds))
-					{
-						VisibleLevel.LODIndex = LODIdx;
-						bIsVisible = true;
-						break;
-					}
+					MaxStreamingDistance = FMath::Max(MaxStreamingDistance, Tile.Info.GetStreamingDistance(LODIdx));
 				}
 			}
 		}
 
-		if (bIsVisible)
-		{
-			OutVisibleLevels.Add(VisibleLevel);
-		}
-		else
+		TilesSpatialIndexQueryExtent = MaxStreamingDistance + FMath::Max(TilesStreamingDistanceHysteresis, 0.0f);
+		TilesSpatialIndex = MakeUnique<TFlatQuadTree<int32>>();
+		TilesSpatialIndex->Build(IndexedTiles, IndexedTileBoxes);
+	}
+
+	// Bounds are only tested on XY, and the query boxes contain every tile any of its LODs could be streamed in for
+	TArray<FBox2D, TInlineAllocator<8>> QueryBoxes;
+	for (int32 LocationIdx = 0; LocationIdx < NumLocations; ++LocationIdx)
+	{
+		const FVector2D AbsoluteLocation = FVector2D(InLocations[LocationIdx]) + FVector2D(OwningWorld->OriginLocation.X, OwningWorld->OriginLocation.Y);
+		const FVector2D QueryExtent(TilesSpatialIndexQueryExtent, TilesSpatialIndexQueryExtent);
+		QueryBoxes.Add(FBox2D(AbsoluteLocation - QueryExtent, AbsoluteLocation + QueryExtent));
+	}
+
+	TArray<int32> NearTiles;
+	TArray<int32> NearTilesOffsets;
+	TilesSpatialIndex->GetElements(QueryBoxes, NearTiles, NearTilesOffsets);
+	for (const int32 TileIdx : NearTiles)
+	{
+		OutTilesNearLocations[TileIdx] = true;
+	}
+}
+
+void UWorldComposition::GetTileDistanceVisibility(
+	int32 TileIdx,
+	const FVector* InLocations,
+	int32 NumLocations,
+	TArray<FDistanceVisibleLevel>& OutVisibleLevels,
+	TArray<FDistanceVisibleLevel>& OutHiddenLevels) const
+{
+	const UWorld* OwningWorld = GetWorld();
+	const FWorldCompositionTile& Tile = Tiles[TileIdx];
+
+	FDistanceVisibleLevel VisibleLevel = 
+	{
+		TileIdx,
+		TilesStreaming[TileIdx],
+		INDEX_NONE
+	};
+
+	bool bIsVisible = false;
+
+	if (OwningWorld->IsNetMode(NM_DedicatedServer))
+	{
+		// Dedicated server always loads all distance dependent tiles
+		bIsVisible = true;
+	}
+	else if (IsRunningCommandlet())
+	{
+		// Commandlets have no concept of viewer location, so always load all distance-dependent tiles.
+		bIsVisible = true;
+	}
+	else
+	{
+		//
+		// Check if tile bounding box intersects with a sphere with origin at provided location and with radius equal to tile layer distance settings
+		//
+		FIntPoint WorldOriginLocationXY = FIntPoint(OwningWorld->OriginLocation.X, OwningWorld->OriginLocation.Y);
+		FIntPoint LevelPositionXY = FIntPoint(Tile.Info.AbsolutePosition.X, Tile.Info.AbsolutePosition.Y);
+		FIntPoint LevelOffsetXY = LevelPositionXY - WorldOriginLocationXY;
+		FBox LevelBounds = Tile.Info.Bounds.ShiftBy(FVector(LevelOffsetXY));
+		// We don't care about third dimension yet
+		LevelBounds.Min.Z = -WORLD_MAX;
+		LevelBounds.Max.Z = +WORLD_MAX;
+
+		// A visible tile keeps its current LOD, and any coarser one, until the views are farther than the streaming distance plus the hysteresis band
+		const bool bCurrentlyVisible = VisibleLevel.StreamingLevel->GetShouldBeVisibleFlag();
+		const int32 CurrentLODIdx = VisibleLevel.StreamingLevel->GetLevelLODIndex();
+			
+		int32 NumAvailableLOD = FMath::Min(Tile.Info.LODList.Num(), Tile.LODPackageNames.Num());
+		// Find LOD
+		// INDEX_NONE for original non-LOD level
+		for (int32 LODIdx = INDEX_NONE; LODIdx < NumAvailableLOD; ++LODIdx)
 		{
-			OutHiddenLevels.Add(VisibleLevel);
+			if (bIsVisible && LODIdx > VisibleLevel.LODIndex)
+			{
+				// no point to loop more, we have visible tile with best possible LOD
+				break;
+			}
+			
+			float TileStreamingDistance = Tile.Info.GetStreamingDistance(LODIdx);
+			if (bCurrentlyVisible && LODIdx >= CurrentLODIdx)
+			{
+				TileStreamingDistance += FMath::Max(TilesStreamingDistanceHysteresis, 0.0f);
+			}
+
+			for (int32 LocationIdx = 0; LocationIdx < NumLocations; ++LocationIdx)
+			{
+				FSphere QuerySphere(InLocations[LocationIdx], TileStreamingDistance);
+				if (FMath::SphereAABBIntersection(QuerySphere, LevelBounds))
+				{
+					VisibleLevel.LODIndex = LODIdx;
+					bIsVisible = true;
+					break;
+				}
+			}
 		}
 	}
+
+	if (bIsVisible)
+	{
+		OutVisibleLevels.Add(VisibleLevel);
+	}
+	else
+	{
+		OutHiddenLevels.Add(VisibleLevel);
+	}
 }
 
 void UWorldComposition::UpdateStreamingState(const FVector& InLocation)
@@ -638,22 +745,54 @@ void UWorldComposition::UpdateStreamingState(const FVector* InLocations, int32 N
 	// Get the list of visible and hidden levels from current view point
 	TArray<FDistanceVisibleLevel> DistanceVisibleLevels;
 	TArray<FDistanceVisibleLevel> DistanceHiddenLevels;
-	GetDistanceVisibleLevels(InLocations, Num, DistanceVisibleLevels, DistanceHiddenLevels);
+	if (bDistanceStreamedTilesValid && !OwningWorld->IsNetMode(NM_DedicatedServer) && !IsRunningCommandlet())
+	{
+		// Only tiles near the views and tiles left loaded by the previous update can change state
+		TBitArray<> TilesToEvaluate(false, Tiles.Num());
+		GetTilesNearLocations(InLocations, Num, TilesToEvaluate);
+		for (const int32 TileIdx : DistanceStreamedTiles)
+		{
+			TilesToEvaluate[TileIdx] = true;
+		}
+
+		for (TConstSetBitIterator<> It(TilesToEvaluate); It; ++It)
+		{
+			if (IsDistanceDependentLevel(It.GetIndex()))
+			{
+				GetTileDistanceVisibility(It.GetIndex(), InLocations, Num, DistanceVisibleLevels, DistanceHiddenLevels);
+			}
+		}
+	}
+	else
+	{
+		GetDistanceVisibleLevels(InLocations, Num, DistanceVisibleLevels, DistanceHiddenLevels);
+	}
 	
 	// Dedicated server always blocks on load
 	bool bShouldBlock = (OwningWorld->GetNetMode() == NM_DedicatedServer);
 	
+	DistanceStreamedTiles.Reset();
+
 	// Set distance hidden levels to unload
 	for (const FDistanceVisibleLevel& Level : DistanceHiddenLevels)
 	{
 		CommitTileStreamingState(OwningWorld, Level.TileIdx, false, false, bShouldBlock, Level.LODIndex);
+
+		// Tiles that could not be unloaded yet because of the state change cooldown have to be retried
+		if (Level.StreamingLevel->ShouldBeLoaded())
+		{
+			DistanceStreamedTiles.Add(Level.TileIdx);
+		}
 	}
 
 	// Set distance visible levels to load
 	for (const FDistanceVisibleLevel& Level : DistanceVisibleLevels)
 	{
 		CommitTileStreamingState(OwningWorld, Level.TileIdx, true, true, bShouldBlock, Level.LODIndex);
+		DistanceStreamedTiles.Add(Level.TileIdx);
 	}
+
+	bDistanceStreamedTilesValid = true;
 }
 
 void UWorldComposition::UpdateStreamingStateCinematic(const FVector* InLocations, int32 Num)
@@ -683,6 +822,9 @@ void UWorldComposition::UpdateStreamingStateCinematic(const FVector* InLocations
 		bStreamingStateChanged|= CommitTileStreamingState(GetWorld(), TileIdx, true, true, bShouldBlock, INDEX_NONE);
 	}
 
+	// Every tile is loaded now, the next distance based update has to consider all of them
+	bDistanceStreamedTilesValid = false;
+
 	if (bStreamingStateChanged)
 	{
 		GetWorld()->FlushLevelStreaming(EFlushLevelStreamingType::Full);
@@ -977,3 +1119,14 @@ FBox UWorldComposition::GetLevelBounds(ULevel* InLevel) const
 	
 	return LevelBBox;
 }
+
+FBox UWorldComposition::GetTileBounds(const FName& InPackageName) const
+{
+	FBox TileBBox(ForceInit);
+	if (const FWorldCompositionTile* Tile = FindTileByName(InPackageName))
+	{
+		TileBBox = Tile->Info.Bounds.ShiftBy(FVector(Tile->Info.AbsolutePosition - GetWorld()->OriginLocation));
+	}
+
+	return TileBBox;
+}
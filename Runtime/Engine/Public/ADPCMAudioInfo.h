@@ -86,6 +86,23 @@ namespace ADPCM
 #pragma pack(pop)
 #endif
 
+	/** Maximum number of channels DecodeBlocksInterleaved decodes in lockstep. Wider blocks are decoded one channel at a time. */
+	static constexpr int32 MaxInterleavedDecodeChannels = 8;
+
+	/** Number of samples a single channel block of the given size decodes to: 2 preamble samples, then 2 samples per byte after the 7 byte preamble. */
+	FORCEINLINE int32 GetNumSamplesPerBlock(int32 BlockSize)
+	{
+		return 2 + (BlockSize - 7) * 2;
+	}
+
+	/** Decodes a single channel ADPCM block into DecodedPCMData, which must hold GetNumSamplesPerBlock(BlockSize) samples. */
+	void DecodeBlock(const uint8* EncodedADPCMBlock, int32 BlockSize, int16* DecodedPCMData);
+
+	/**
+	 * Decodes one ADPCM block per channel and writes the result interleaved by channel into DecodedPCMData,
+	 * which must hold NumChannels * GetNumSamplesPerBlock(BlockSize) samples. This can be the caller's output buffer.
+	 */
+	void DecodeBlocksInterleaved(const uint8* const* EncodedADPCMBlocks, int32 NumChannels, int32 BlockSize, int16* DecodedPCMData);
 };
 
 class FADPCMAudioInfo : public ICompressedAudioInfo
@@ -140,6 +157,12 @@ private:
 	// until we move on to a different chunk.
 	const uint8* GetLoadedChunk(USoundWave* InSoundWave, uint32 ChunkIndex, uint32& OutChunkSize);
 
+	// Returns true if a whole block for every channel fits in BufferSize bytes of output and in the remaining samples of the wave.
+	bool CanDecodeBlockDirectlyToOutput(uint32 BufferSize) const;
+
+	// Decodes the current block of every channel, interleaved into Destination. Channel N's block starts N * ChannelStride bytes after FirstChannelBlock.
+	void DecodeBlocks(const uint8* FirstChannelBlock, uint32 ChannelStride, int16* Destination);
+
 	int32 NumConsecutiveReadFailiures;
 
 	FWaveModInfo WaveInfo;
@@ -156,7 +179,7 @@ private:
 
 	uint32 PreviouslyRequestedChunkIndex;
 
-	uint8*			UncompressedBlockData;			// This holds the current block of compressed data for all channels
+	uint8*			UncompressedBlockData;			// This holds the current block of decompressed data for all channels, interleaved
 	uint32			CurrentUncompressedBlockSampleIndex;	// This is the sample index within the current uncompressed block data
 	uint32			CurrentChunkIndex;				// This is the index that is currently being used, needed by streaming engine to make sure it stays loaded and the next chunk gets preloaded
 	uint32			CurrentChunkBufferOffset;		// This is this byte offset within the current chunk, used by streaming engine to prioritize a load if more then half way through current chunk
@@ -28,6 +28,19 @@ class USoundWave;
 struct FListener;
 struct FAttenuationListenerData;
 
+/**
+ * Flattened node payload layout of a sound cue. Built on the game thread when the cue's graph changes,
+ * then shared read-only by the active sounds playing the cue.
+ */
+struct FSoundCueNodeLayout
+{
+	/** Wave instance hashes of every node reachable from the cue's first node, in the depth first order ParseNodes visits them when every child is parsed. */
+	TArray<UPTRINT> NodeWaveInstanceHashes;
+
+	/** Index of each hash in NodeWaveInstanceHashes. */
+	TMap<UPTRINT, int32> NodeIndices;
+};
+
 /**
  * Attenuation focus system data computed per update per active sound
  */
@@ -548,6 +561,63 @@ public:
 	TMap<UPTRINT,uint32> SoundNodeOffsetMap;
 	TArray<uint8> SoundNodeData;
 
+	/** Node payload layout of the sound cue being played, captured in SetSound so that it never changes while the sound plays. Null for other sounds. */
+	TSharedPtr<const FSoundCueNodeLayout, ESPMode::ThreadSafe> SoundNodeLayout;
+
+	/** Payload offsets in SoundNodeData, indexed like the hashes of SoundNodeLayout. MAX_uint32 until the node's payload is created. */
+	TArray<uint32> SoundNodeLayoutOffsets;
+
+	/** Index in SoundNodeLayout of the node expected to look up its payload next. */
+	int32 SoundNodeParseCursor;
+
+	/** Called before parsing the sound's node graph from its root. */
+	void BeginSoundNodeParse()
+	{
+		SoundNodeParseCursor = 0;
+		if (SoundNodeLayout.IsValid() && SoundNodeLayoutOffsets.Num() == 0)
+		{
+			const int32 NumNodes = SoundNodeLayout->NodeWaveInstanceHashes.Num();
+			SoundNodeLayoutOffsets.Init(MAX_uint32, NumNodes);
+			SoundNodeOffsetMap.Reserve(NumNodes);
+		}
+	}
+
+	/** Returns the payload offset for the given node wave instance hash, or nullptr if the node has no payload yet. */
+	uint32* FindSoundNodeDataOffset(const UPTRINT NodeWaveInstanceHash)
+	{
+		const int32 NodeIndex = FindSoundNodeLayoutIndex(NodeWaveInstanceHash);
+		if (NodeIndex == INDEX_NONE)
+		{
+			return SoundNodeOffsetMap.Find(NodeWaveInstanceHash);
+		}
+
+		uint32& Offset = SoundNodeLayoutOffsets[NodeIndex];
+		if (Offset == MAX_uint32)
+		{
+			// Payloads created before the layout was in use are only registered in the map
+			const uint32* MappedOffset = SoundNodeOffsetMap.Find(NodeWaveInstanceHash);
+			if (!MappedOffset)
+			{
+				return nullptr;
+			}
+			Offset = *MappedOffset;
+		}
+		return &Offset;
+	}
+
+	/** Registers the payload offset of a node wave instance hash seen for the first time. */
+	void AddSoundNodeDataOffset(const UPTRINT NodeWaveInstanceHash, const uint32 Offset)
+	{
+		SoundNodeOffsetMap.Add(NodeWaveInstanceHash, Offset);
+
+		// FindSoundNodeDataOffset just moved the cursor past the node if it is part of the layout
+		const int32 NodeIndex = SoundNodeParseCursor - 1;
+		if (SoundNodeLayoutOffsets.IsValidIndex(NodeIndex) && SoundNodeLayout->NodeWaveInstanceHashes[NodeIndex] == NodeWaveInstanceHash)
+		{
+			SoundNodeLayoutOffsets[NodeIndex] = Offset;
+		}
+	}
+
 	TArray<FAudioComponentParam> InstanceParameters;
 
 	// Whether or not there are Source Bus Sends that have not been sent to the render thread
@@ -732,6 +802,32 @@ private:
 	/** Cached index to the closest listener. So we don't have to do the work to find it twice. */
 	int32 ClosestListenerIndex;
 
+	/**
+	 * Returns the index of the node in SoundNodeLayout and moves the parse cursor past it, or INDEX_NONE if the node is not part of the layout.
+	 * Nodes parsing all of their children hit the cursor, nodes skipping some of them fall back to the layout's index map.
+	 */
+	int32 FindSoundNodeLayoutIndex(const UPTRINT NodeWaveInstanceHash)
+	{
+		if (SoundNodeLayoutOffsets.Num() == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		int32 NodeIndex = SoundNodeParseCursor;
+		if (!SoundNodeLayoutOffsets.IsValidIndex(NodeIndex) || SoundNodeLayout->NodeWaveInstanceHashes[NodeIndex] != NodeWaveInstanceHash)
+		{
+			const int32* FoundIndex = SoundNodeLayout->NodeIndices.Find(NodeWaveInstanceHash);
+			if (!FoundIndex)
+			{
+				return INDEX_NONE;
+			}
+			NodeIndex = *FoundIndex;
+		}
+
+		SoundNodeParseCursor = NodeIndex + 1;
+		return NodeIndex;
+	}
+
 	/** This is a friend so the audio device can call Stop() on the active sound. */
 	friend class FAudioDevice;
 
@@ -776,6 +776,18 @@ public:
 	*/
 	FActiveSound* FindActiveSound(uint64 AudioComponentID);
 
+	/**
+	* Sets the transform of the provided active sound, flagging the virtual loop spatial hash for
+	* rebuild if the sound is a virtualized loop
+	*/
+	void SetActiveSoundTransform(FActiveSound& ActiveSound, const FTransform& InTransform);
+
+	/**
+	* Sets the attenuation settings of the provided active sound, flagging the virtual loop spatial hash
+	* for rebuild if the sound is a virtualized loop
+	*/
+	void SetActiveSoundAttenuationSettings(FActiveSound& ActiveSound, const FSoundAttenuationSettings& InAttenuationSettings);
+
 	/**
 	 * Removes an active sound from the active sounds array
 	 */
@@ -1407,6 +1419,12 @@ private:
 	 */
 	void UpdateConcurrency(TArray<FWaveInstance*>& WaveInstances, TArray<FActiveSound*>& ActiveSoundsCopy);
 
+	/**
+	 * Partially orders the given wave instances by priority, such that the element at NthIndex and all
+	 * elements after it are of at least as high priority as all elements before it.
+	 */
+	static void SelectNthLowestPriority(TArray<TPair<float, FWaveInstance*>>& InPrioritizedWaveInstances, const int32 NthIndex);
+
 	/**
 	 * Checks if the given sound would be audible.
 	 * @param NewActiveSound	The ActiveSound attempting to be created
@@ -1969,11 +1987,17 @@ private:
 
 	TArray<FWaveInstance*> ActiveWaveInstances;
 
+	/** Wave instances paired with their volume weighted priority. Cached to avoid allocating and re-evaluating priorities while sorting every frame. */
+	TArray<TPair<float, FWaveInstance*>> PrioritizedWaveInstances;
+
 	/** Array of dormant loops stopped due to proximity/applicable concurrency rules
 	  * that can be retriggered.
 	  */
 	TMap<FActiveSound*, FAudioVirtualLoop> VirtualLoops;
 
+	/** Spatial hash of virtual loops used to cull realization checks of loops far from all listeners when force updating. */
+	FAudioVirtualLoopSpatialHash VirtualLoopSpatialHash;
+
 	/** Cached copy of sound class adjusters array. Cached to avoid allocating every frame. */
 	TArray<FSoundClassAdjuster> SoundClassAdjustersCopy;
 
@@ -57,6 +57,9 @@ public:
 	// InOutCacheLookupID will be set to the offset the chunk is in the cache, which can be used for faster lookup in the future.
 	TArrayView<uint8> GetChunk(const FChunkKey& InKey, bool bBlockForLoadCompletion, bool bNeededForPlayback, uint64& InOutCacheLookupID);
 
+	// Returns whether the chunk is in the cache, loaded or not.
+	bool IsChunkCached(const FChunkKey& InKey);
+
 	// add an additional reference for a chunk.
 	void AddNewReferenceToChunk(const FChunkKey& InKey, uint64 InCacheLookupID);
 	void RemoveReferenceToChunk(const FChunkKey& InKey, uint64 InCacheLookupID);
@@ -115,6 +118,40 @@ public:
 		return CacheOverflowCount.GetValue();
 	}
 
+	// Number of buckets in the chunk load latency histogram. Bucket N counts loads that took less than 2^N milliseconds
+	// (and at least 2^(N-1) milliseconds), with the final bucket counting every load slower than that.
+	static constexpr int32 NumLoadLatencyBuckets = 8;
+
+	// Snapshot of the counters this cache accumulates over its lifetime.
+	struct FCacheStats
+	{
+		// Number of chunk loads that playback had to wait for, each load counted once.
+		int32 NumMisses = 0;
+
+		// Number of times a caller blocked on a chunk load (i.e. bBlockForLoad was set and the chunk was not loaded yet).
+		int32 NumStalls = 0;
+
+		// Total time spent blocking on chunk loads, in milliseconds.
+		double StallTimeMs = 0.0;
+
+		// Number of chunk loads started by prefetching, chunks that were already cached aren't counted.
+		int32 NumPrefetches = 0;
+
+		// Number of times an eviction moved a protected chunk back to the most recent end instead of evicting it.
+		int32 NumProtectedChunksSpared = 0;
+
+		// Histogram of async chunk load latency. See NumLoadLatencyBuckets.
+		int32 LoadLatencyHistogram[NumLoadLatencyBuckets] = {};
+	};
+
+	FCacheStats GetCacheStats() const;
+
+	// Counts a chunk requested by prefetching.
+	void IncrementPrefetchCounter()
+	{
+		PrefetchCount.Increment();
+	}
+
 private:
 
 #if DEBUG_STREAM_CACHE
@@ -169,6 +206,20 @@ private:
 	// counter for the number of times this cache has overflown
 	FThreadSafeCounter CacheOverflowCount;
 
+	// Counters reported through GetCacheStats.
+	FThreadSafeCounter CacheMissCount;
+	FThreadSafeCounter StallCount;
+	TAtomic<uint64> StallTimeCycles;
+	FThreadSafeCounter PrefetchCount;
+	FThreadSafeCounter ProtectedChunksSparedCount;
+	FThreadSafeCounter LoadLatencyHistogram[NumLoadLatencyBuckets];
+
+	// Records a completed async chunk load in LoadLatencyHistogram.
+	void RecordLoadLatency(double LoadTimeSeconds);
+
+	// Records time spent blocking on a chunk load.
+	void RecordStall(uint64 StallStartCycles);
+
 
 	// Struct containing a single element in our LRU Cache.  
 	struct FCacheElement
@@ -185,6 +236,18 @@ private:
 		// How many disparate consumers have called GetLoadedChunk.
 		FThreadSafeCounter NumConsumers;
 
+		// Number of playback consumers that acquired this chunk since it was loaded or last demoted.
+		int32 NumPlaybackHits;
+
+		// If true, the next eviction that reaches this chunk moves it back to the most recent end of the cache instead of evicting it.
+		bool bIsProtected;
+
+		// Whether a playback request already found this chunk not loaded yet, so that its load is counted as a single miss.
+		bool bCountedAsMiss;
+
+		// Time the async load of this chunk was kicked off, used for load latency reporting.
+		double TimeLoadStarted;
+
 #if WITH_EDITORONLY_DATA
 		TUniquePtr<FAsyncStreamDerivedChunkTask> DDCTask;
 #endif
@@ -203,6 +266,10 @@ private:
 			, LessRecentElement(nullptr)
 			, CacheLookupID(InCacheIndex)
 			, bIsLoaded(false)
+			, NumPlaybackHits(0)
+			, bIsProtected(false)
+			, bCountedAsMiss(false)
+			, TimeLoadStarted(0.0)
 			, ReadRequest(nullptr)
 		{
 		}
@@ -305,6 +372,15 @@ private:
 	// Puts this element at the front of the linked list.
 	void TouchElement(FCacheElement* InElement);
 
+	// Counts a playback consumer acquiring a chunk already in the cache, protecting it if it is used often enough.
+	void RecordPlaybackHit(FCacheElement* InElement);
+
+	// Counts a playback request for a chunk that isn't loaded yet, once per load of the chunk.
+	void RecordMiss(FCacheElement* InElement);
+
+	// Unprotects a protected chunk and moves it to the most recent end of the cache.
+	void DemoteProtectedChunk(FCacheElement* InElement);
+
 	// Inserts a new element into the cache, potentially evicting the oldest element in the cache.
 	FCacheElement* InsertChunk(const FChunkKey& InKey);
 
@@ -401,6 +477,9 @@ public:
 	virtual int32 RenderStatAudioStreaming(UWorld* World, FViewport* Viewport, FCanvas* Canvas, int32 X, int32 Y, const FVector* ViewLocation, const FRotator* ViewRotation) override;
 	virtual FString GenerateMemoryReport() override;
 	virtual void SetProfilingMode(bool bEnabled) override;
+	virtual void AddPrefetchAudioComponent(UAudioComponent* AudioComponent) override;
+	virtual void RemovePrefetchAudioComponent(UAudioComponent* AudioComponent) override;
+	virtual void PrefetchSound(USoundBase* Sound) override;
 	// End IAudioStreamingManager interface
 
 protected:
@@ -422,11 +501,20 @@ protected:
 	 */
 	int32 GetNextChunkIndex(const USoundWave* InSoundWave, uint32 CurrentChunkIndex) const;
 
+	/** Requests the first streamed chunk of the given sound wave, if it is not already in the cache. */
+	void PrefetchSoundWave(USoundWave* InSoundWave);
+
+	/** Prefetches sounds of registered audio components within range of a streaming view. Called from UpdateResourceStreaming. */
+	void UpdatePrefetchAudioComponents(float DeltaTime);
+
 	/** Audio chunk caches. These are set up on initialization. */
 	TArray<FAudioChunkCache> CacheArray;
 
-	
+	/** Audio components registered for prefetching, mapped to whether they were in prefetch range on the last update. */
+	TMap<TWeakObjectPtr<UAudioComponent>, bool> PrefetchAudioComponents;
 
+	/** Time accumulated since the prefetch candidates were last evaluated. */
+	float TimeSinceLastPrefetchUpdate;
 };
 
 inline int32 GetTypeHash(const FAudioChunkCache::FChunkKey& InKey)
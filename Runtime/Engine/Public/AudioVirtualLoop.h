@@ -24,6 +24,12 @@ private:
 	static bool IsInAudibleRange(const FActiveSound& InActiveSound, const FAudioDevice* InAudioDevice = nullptr);
 
 public:
+	/**
+	  * Returns distance from a listener beyond which the provided active sound is inaudible,
+	  * or WORLD_MAX if the sound is audible regardless of distance.
+	  */
+	static float GetAudibleDistance(const FActiveSound& InActiveSound);
+
 	FAudioVirtualLoop();
 
 	/**
@@ -67,6 +73,11 @@ public:
 	 */
 	void CalculateUpdateInterval();
 
+	/**
+	 * Overrides the update interval using the provided distance to the nearest listener
+	 */
+	void CalculateUpdateInterval(float DistanceToListener);
+
 	/**
 	 * Takes aggregate update delta and updates focus so that realization
 	 * check can test if ready to play.
@@ -76,6 +87,94 @@ public:
 	/**
 	  * Updates the loop and checks if ready to play (or 'realize').
 	  * Returns whether or not the sound is ready to be realized.
+	  * If bMayBeAudible is false, the sound is known to be out of range of all
+	  * listeners and the realization check is skipped. The update interval is then
+	  * derived from CulledDistanceToListener rather than querying the listeners.
 	  */
-	bool Update(float DeltaTime, bool bForceUpdate);
+	bool Update(float DeltaTime, bool bForceUpdate, bool bMayBeAudible = true, float CulledDistanceToListener = 0.0f);
+};
+
+/**
+ * Coarse spatial hash of virtualized loops. Cells track the bounds and largest audible
+ * distance of the loops within them, so that loops residing in cells out of range of all
+ * listeners can skip their realization checks without evaluating each loop individually.
+ */
+class ENGINE_API FAudioVirtualLoopSpatialHash
+{
+public:
+	FAudioVirtualLoopSpatialHash();
+
+	/**
+	 * Whether the spatial hash is enabled and worth building for the given number of virtual loops
+	 */
+	static bool IsEnabled(int32 NumVirtualLoops);
+
+	/**
+	 * Removes all cells, maintaining allocated memory
+	 */
+	void Reset();
+
+	/**
+	 * Flags the cells as out of date, such that they are rebuilt on the next forced update.
+	 * Called whenever a virtual loop is added, removed or moved.
+	 */
+	void MarkNeedsRebuild();
+
+	/**
+	 * Whether loops were added, removed or moved since the cells were last built
+	 */
+	bool NeedsRebuild() const;
+
+	/**
+	 * Adds the provided loop to the cell containing its location
+	 */
+	void Add(const FAudioVirtualLoop& VirtualLoop);
+
+	/**
+	 * Flags cells that are within audible range of at least one of the provided listener locations,
+	 * and caches each cell's distance to the nearest of them
+	 */
+	void UpdateAudibleCells(const TArray<FVector>& ListenerLocations);
+
+	/**
+	 * Returns whether the provided loop resides in a cell in audible range of any listener.
+	 * Loops that were not added to the hash are always considered potentially audible.
+	 */
+	bool IsInAudibleCell(const FAudioVirtualLoop& VirtualLoop) const;
+
+	/**
+	 * Returns whether the provided loop resides in a cell in audible range of any listener,
+	 * and the distance from that cell to the nearest listener, which never exceeds the loop's own.
+	 */
+	bool IsInAudibleCell(const FAudioVirtualLoop& VirtualLoop, float& OutDistanceToListener) const;
+
+	/**
+	 * Returns number of cells in the hash and the number of which are in audible range of a listener
+	 */
+	int32 GetNumCells() const;
+	int32 GetNumAudibleCells() const;
+
+private:
+	struct FCell
+	{
+		FBox Bounds;
+		float MaxAudibleDistance;
+		float DistanceToListener;
+		bool bAudible;
+
+		FCell()
+			: Bounds(ForceInit)
+			, MaxAudibleDistance(0.0f)
+			, DistanceToListener(0.0f)
+			, bAudible(false)
+		{
+		}
+	};
+
+	FIntVector GetCellKey(const FVector& Location) const;
+
+	TMap<FIntVector, FCell> Cells;
+	float CellSize;
+	int32 NumAudibleCells;
+	bool bNeedsRebuild;
 };
@@ -15,6 +15,8 @@ class AActor;
 class FSoundSource;
 class UPrimitiveComponent;
 class USoundWave;
+class USoundBase;
+class UAudioComponent;
 class ICompressedAudioInfo;
 class UTexture2D;
 struct FRenderAssetStreamingManager;
@@ -358,6 +360,15 @@ protected:
 	 */
 	static void RemoveViewInfoFromArray( TArray<FStreamingViewInfo> &ViewInfos, const FVector& ViewOrigin );
 
+	/**
+	 * Updates the motion of the regular views and adds views where they are predicted to be within "r.Streaming.PredictiveViews.Horizon",
+	 * so that streaming can start before the camera gets there.
+	 *
+	 * @param DeltaTime				Time since last call in seconds
+	 * @param SplitScreenFactor		Screen size factor applied to the regular views
+	 */
+	static void AddPredictedViewInfos( float DeltaTime, float SplitScreenFactor );
+
 	struct FSlaveLocation
 	{
 		FSlaveLocation( const FVector& InLocation, float InBoostFactor, bool bInOverrideLocation, float InDuration )
@@ -377,6 +388,25 @@ protected:
 		bool		bOverrideLocation;
 	};
 
+	struct FViewMotion
+	{
+		FViewMotion()
+		:	Origin( FVector::ZeroVector )
+		,	Velocity( FVector::ZeroVector )
+		,	Acceleration( FVector::ZeroVector )
+		,	bHasVelocity( false )
+		{
+		}
+		/** View origin at the last update. */
+		FVector		Origin;
+		/** Smoothed view velocity, in units per second. */
+		FVector		Velocity;
+		/** Smoothed view acceleration, in units per second squared. */
+		FVector		Acceleration;
+		/** Whether Velocity has been measured since the view appeared or teleported. */
+		bool		bHasVelocity;
+	};
+
 	/** Current collection of views that need to be taken into account for streaming. Emptied every frame. */
 	ENGINE_API static TArray<FStreamingViewInfo> CurrentViewInfos;
 
@@ -392,6 +422,9 @@ protected:
 	/** Set when Tick() has been called. The first time a new view is added, it will clear out all old views. */
 	static bool bPendingRemoveViews;
 
+	/** Motion history of the regular views, matched by their order in PendingViewInfos. Used to add predicted views. */
+	static TArray<FViewMotion> ViewMotions;
+
 	/** Number of resources that currently wants to be streamed in. */
 	int32		NumWantingResources;
 
@@ -560,6 +593,21 @@ struct IAudioStreamingManager : public IStreamingManager
 	 */
 	virtual void SetProfilingMode(bool bEnabled) = 0;
 
+	/**
+	 * Registers an audio component whose sound should have its first chunks prefetched while near a streaming view.
+	 * Streaming managers that do not support prefetching ignore this.
+	 */
+	virtual void AddPrefetchAudioComponent(UAudioComponent* AudioComponent) {}
+
+	/** Unregisters an audio component previously added with AddPrefetchAudioComponent. */
+	virtual void RemovePrefetchAudioComponent(UAudioComponent* AudioComponent) {}
+
+	/**
+	 * Requests the first streamed chunk of every sound wave the given sound may play, ahead of playback.
+	 * Streaming managers that do not support prefetching ignore this.
+	 */
+	virtual void PrefetchSound(USoundBase* Sound) {}
+
 protected:
 	friend FAudioChunkHandle;
 
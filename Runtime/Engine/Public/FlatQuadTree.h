@@ -0,0 +1,314 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Quadtree for static sets of elements, built in one go and stored in flat arrays.
+ *
+ * Unlike TQuadTree, which inserts elements one at a time into individually allocated sub-trees, elements are bulk loaded:
+ * they are sorted by the Morton code of their box center and the tree is cut along the Morton quadrants, so every node
+ * owns a contiguous range of the sorted elements. Nodes live in a single pool and hold the tight bounds of their four
+ * children in structure of arrays layout, so a query tests a box against all four children with one set of vector compares.
+ * Rebuilding reuses the allocations of the previous build.
+ *
+ * Elements can't be added or removed individually, rebuild the tree when they change.
+ */
+template <typename ElementType, int32 LeafCapacity = 8>
+class TFlatQuadTree
+{
+public:
+	TFlatQuadTree()
+		: TreeBox(ForceInit)
+	{
+	}
+
+	/** Replaces the content of the tree with the given elements, where Boxes[Index] is the box of Elements[Index]. */
+	void Build(TArrayView<const ElementType> InElements, TArrayView<const FBox2D> InBoxes);
+
+	/** Removes all elements of the tree, keeping its allocations. */
+	void Reset();
+
+	/** Given a 2D box, appends the elements whose box intersects it. There will not be any duplicates in the list. */
+	template<typename ElementAllocatorType>
+	void GetElements(const FBox2D& Box, TArray<ElementType, ElementAllocatorType>& ElementsOut) const;
+
+	/**
+	 * Answers many box queries at once.
+	 * The elements intersecting Boxes[Index] are ElementsOut[OffsetsOut[Index]] to ElementsOut[OffsetsOut[Index + 1] - 1], OffsetsOut has Boxes.Num() + 1 entries.
+	 */
+	void GetElements(TArrayView<const FBox2D> Boxes, TArray<ElementType>& ElementsOut, TArray<int32>& OffsetsOut) const;
+
+	/** Returns the bounds of all the elements in the tree. */
+	const FBox2D& GetTreeBox() const { return TreeBox; }
+
+	/** Returns the number of elements in the tree. */
+	int32 Num() const { return Elements.Num(); }
+
+	/** Returns the memory allocated by the tree. */
+	SIZE_T GetAllocatedSize() const { return Nodes.GetAllocatedSize() + Elements.GetAllocatedSize() + ElementBoxes.GetAllocatedSize(); }
+
+	void Serialize(FArchive& Ar);
+
+private:
+	/** Morton codes have 16 bits per axis, which limits the depth of the tree */
+	static constexpr int32 MaxDepth = 16;
+
+	struct FNode
+	{
+		/** Bounds of the four children per component, empty children have inverted bounds that never intersect */
+		float ChildMinX[4];
+		float ChildMinY[4];
+		float ChildMaxX[4];
+		float ChildMaxY[4];
+
+		/** Node index of each child, INDEX_NONE for empty children */
+		int32 Children[4];
+
+		/** Range of the sorted elements owned by a leaf, FirstElement is INDEX_NONE for internal nodes */
+		int32 FirstElement;
+		int32 NumElements;
+
+		FNode()
+			: FirstElement(INDEX_NONE)
+			, NumElements(0)
+		{
+			for (int32 ChildIndex = 0; ChildIndex < 4; ++ChildIndex)
+			{
+				ChildMinX[ChildIndex] = MAX_flt;
+				ChildMinY[ChildIndex] = MAX_flt;
+				ChildMaxX[ChildIndex] = -MAX_flt;
+				ChildMaxY[ChildIndex] = -MAX_flt;
+				Children[ChildIndex] = INDEX_NONE;
+			}
+		}
+
+		friend FArchive& operator<<(FArchive& Ar, FNode& Node)
+		{
+			for (int32 ChildIndex = 0; ChildIndex < 4; ++ChildIndex)
+			{
+				Ar << Node.ChildMinX[ChildIndex] << Node.ChildMinY[ChildIndex] << Node.ChildMaxX[ChildIndex] << Node.ChildMaxY[ChildIndex] << Node.Children[ChildIndex];
+			}
+			return Ar << Node.FirstElement << Node.NumElements;
+		}
+	};
+
+	/** Interleaves the bits of two 16 bit coordinates */
+	static uint32 MortonCode(uint32 X, uint32 Y);
+
+	/** Builds the node for SortedCodes[First, First + Count) and returns its index, OutBounds receives the bounds of its elements */
+	int32 BuildNode(const TArray<uint32>& SortedCodes, int32 First, int32 Count, int32 Depth, FBox2D& OutBounds);
+
+	/** Appends the elements intersecting Box, NodeStack is scratch space kept by the caller across queries */
+	template<typename ElementAllocatorType, typename StackAllocatorType>
+	void QueryBox(const FBox2D& Box, TArray<ElementType, ElementAllocatorType>& ElementsOut, TArray<int32, StackAllocatorType>& NodeStack) const;
+
+	/** Node pool, the root is the first node */
+	TArray<FNode> Nodes;
+
+	/** Elements and their boxes, sorted by Morton code */
+	TArray<ElementType> Elements;
+	TArray<FBox2D> ElementBoxes;
+
+	/** Bounds of all the elements */
+	FBox2D TreeBox;
+};
+
+template <typename ElementType, int32 LeafCapacity>
+uint32 TFlatQuadTree<ElementType, LeafCapacity>::MortonCode(uint32 X, uint32 Y)
+{
+	X = (X | (X << 8)) & 0x00FF00FF;
+	X = (X | (X << 4)) & 0x0F0F0F0F;
+	X = (X | (X << 2)) & 0x33333333;
+	X = (X | (X << 1)) & 0x55555555;
+
+	Y = (Y | (Y << 8)) & 0x00FF00FF;
+	Y = (Y | (Y << 4)) & 0x0F0F0F0F;
+	Y = (Y | (Y << 2)) & 0x33333333;
+	Y = (Y | (Y << 1)) & 0x55555555;
+
+	return X | (Y << 1);
+}
+
+template <typename ElementType, int32 LeafCapacity>
+void TFlatQuadTree<ElementType, LeafCapacity>::Reset()
+{
+	Nodes.Reset();
+	Elements.Reset();
+	ElementBoxes.Reset();
+	TreeBox = FBox2D(ForceInit);
+}
+
+template <typename ElementType, int32 LeafCapacity>
+void TFlatQuadTree<ElementType, LeafCapacity>::Build(TArrayView<const ElementType> InElements, TArrayView<const FBox2D> InBoxes)
+{
+	check(InElements.Num() == InBoxes.Num());
+
+	Reset();
+
+	for (const FBox2D& Box : InBoxes)
+	{
+		TreeBox += Box;
+	}
+
+	if (InElements.Num() == 0)
+	{
+		return;
+	}
+
+	// Quantize the box centers over the tree bounds and sort the elements along the Morton curve
+	const FVector2D TreeMin = TreeBox.Min;
+	const FVector2D TreeSize = TreeBox.GetSize();
+	const FVector2D QuantizeScale(TreeSize.X > 0.f ? 65535.f / TreeSize.X : 0.f, TreeSize.Y > 0.f ? 65535.f / TreeSize.Y : 0.f);
+
+	TArray<uint64> SortKeys;
+	SortKeys.Reserve(InElements.Num());
+	for (int32 Index = 0; Index < InBoxes.Num(); ++Index)
+	{
+		const FVector2D Quantized = (InBoxes[Index].GetCenter() - TreeMin) * QuantizeScale;
+		const uint32 Code = MortonCode((uint32)FMath::Clamp(Quantized.X, 0.f, 65535.f), (uint32)FMath::Clamp(Quantized.Y, 0.f, 65535.f));
+		SortKeys.Add(((uint64)Code << 32) | (uint32)Index);
+	}
+	SortKeys.Sort();
+
+	TArray<uint32> SortedCodes;
+	SortedCodes.Reserve(SortKeys.Num());
+	Elements.Reserve(SortKeys.Num());
+	ElementBoxes.Reserve(SortKeys.Num());
+	for (const uint64 SortKey : SortKeys)
+	{
+		const int32 Index = (int32)(SortKey & 0xFFFFFFFF);
+		SortedCodes.Add((uint32)(SortKey >> 32));
+		Elements.Add(InElements[Index]);
+		ElementBoxes.Add(InBoxes[Index]);
+	}
+
+	FBox2D RootBounds(ForceInit);
+	BuildNode(SortedCodes, 0, SortedCodes.Num(), 0, RootBounds);
+}
+
+template <typename ElementType, int32 LeafCapacity>
+int32 TFlatQuadTree<ElementType, LeafCapacity>::BuildNode(const TArray<uint32>& SortedCodes, int32 First, int32 Count, int32 Depth, FBox2D& OutBounds)
+{
+	const int32 NodeIndex = Nodes.AddDefaulted();
+
+	if (Count <= LeafCapacity || Depth == MaxDepth)
+	{
+		Nodes[NodeIndex].FirstElement = First;
+		Nodes[NodeIndex].NumElements = Count;
+		for (int32 Index = First; Index < First + Count; ++Index)
+		{
+			OutBounds += ElementBoxes[Index];
+		}
+		return NodeIndex;
+	}
+
+	// The codes are sorted, so the elements of each quadrant at this depth are contiguous
+	const int32 Shift = 30 - 2 * Depth;
+	int32 Start = First;
+	for (uint32 Quadrant = 0; Quadrant < 4; ++Quadrant)
+	{
+		int32 End = Start;
+		while (End < First + Count && ((SortedCodes[End] >> Shift) & 3) == Quadrant)
+		{
+			++End;
+		}
+
+		if (End > Start)
+		{
+			FBox2D ChildBounds(ForceInit);
+			const int32 ChildIndex = BuildNode(SortedCodes, Start, End - Start, Depth + 1, ChildBounds);
+
+			// Building the child may have grown the pool, so only index into it now
+			FNode& Node = Nodes[NodeIndex];
+			Node.Children[Quadrant] = ChildIndex;
+			Node.ChildMinX[Quadrant] = ChildBounds.Min.X;
+			Node.ChildMinY[Quadrant] = ChildBounds.Min.Y;
+			Node.ChildMaxX[Quadrant] = ChildBounds.Max.X;
+			Node.ChildMaxY[Quadrant] = ChildBounds.Max.Y;
+			OutBounds += ChildBounds;
+		}
+
+		Start = End;
+	}
+
+	return NodeIndex;
+}
+
+template <typename ElementType, int32 LeafCapacity>
+template <typename ElementAllocatorType, typename StackAllocatorType>
+void TFlatQuadTree<ElementType, LeafCapacity>::QueryBox(const FBox2D& Box, TArray<ElementType, ElementAllocatorType>& ElementsOut, TArray<int32, StackAllocatorType>& NodeStack) const
+{
+	if (Nodes.Num() == 0 || !Box.Intersect(TreeBox))
+	{
+		return;
+	}
+
+	const VectorRegister QueryMinX = VectorLoadFloat1(&Box.Min.X);
+	const VectorRegister QueryMinY = VectorLoadFloat1(&Box.Min.Y);
+	const VectorRegister QueryMaxX = VectorLoadFloat1(&Box.Max.X);
+	const VectorRegister QueryMaxY = VectorLoadFloat1(&Box.Max.Y);
+
+	NodeStack.Reset();
+	NodeStack.Add(0);
+	while (NodeStack.Num() > 0)
+	{
+		const FNode& Node = Nodes[NodeStack.Pop(false)];
+
+		if (Node.FirstElement != INDEX_NONE)
+		{
+			for (int32 Index = Node.FirstElement; Index < Node.FirstElement + Node.NumElements; ++Index)
+			{
+				if (Box.Intersect(ElementBoxes[Index]))
+				{
+					ElementsOut.Add(Elements[Index]);
+				}
+			}
+			continue;
+		}
+
+		// Same inclusive test as FBox2D::Intersect, against the four children at once
+		const VectorRegister OverlapX = VectorBitwiseAnd(VectorCompareGE(VectorLoad(Node.ChildMaxX), QueryMinX), VectorCompareLE(VectorLoad(Node.ChildMinX), QueryMaxX));
+		const VectorRegister OverlapY = VectorBitwiseAnd(VectorCompareGE(VectorLoad(Node.ChildMaxY), QueryMinY), VectorCompareLE(VectorLoad(Node.ChildMinY), QueryMaxY));
+
+		uint32 ChildMask = (uint32)VectorMaskBits(VectorBitwiseAnd(OverlapX, OverlapY));
+		while (ChildMask)
+		{
+			const uint32 ChildIndex = FMath::CountTrailingZeros(ChildMask);
+			ChildMask &= ChildMask - 1;
+			NodeStack.Add(Node.Children[ChildIndex]);
+		}
+	}
+}
+
+template <typename ElementType, int32 LeafCapacity>
+template <typename ElementAllocatorType>
+void TFlatQuadTree<ElementType, LeafCapacity>::GetElements(const FBox2D& Box, TArray<ElementType, ElementAllocatorType>& ElementsOut) const
+{
+	TArray<int32, TInlineAllocator<64>> NodeStack;
+	QueryBox(Box, ElementsOut, NodeStack);
+}
+
+template <typename ElementType, int32 LeafCapacity>
+void TFlatQuadTree<ElementType, LeafCapacity>::GetElements(TArrayView<const FBox2D> Boxes, TArray<ElementType>& ElementsOut, TArray<int32>& OffsetsOut) const
+{
+	TArray<int32, TInlineAllocator<64>> NodeStack;
+
+	OffsetsOut.Reset(Boxes.Num() + 1);
+	for (const FBox2D& Box : Boxes)
+	{
+		OffsetsOut.Add(ElementsOut.Num());
+		QueryBox(Box, ElementsOut, NodeStack);
+	}
+	OffsetsOut.Add(ElementsOut.Num());
+}
+
+template <typename ElementType, int32 LeafCapacity>
+void TFlatQuadTree<ElementType, LeafCapacity>::Serialize(FArchive& Ar)
+{
+	Ar << Nodes;
+	Ar << Elements;
+	Ar << ElementBoxes;
+	Ar << TreeBox;
+}
@@ -512,6 +512,30 @@ public:
 
 	ENGINE_API void FillUniformBuffer(const FMaterialRenderContext& MaterialRenderContext, const FUniformExpressionCache& UniformExpressionCache, uint8* TempBuffer, int TempBufferSize) const;
 
+	/** Returns the index of the scalar parameter, adding it with the given default value if the set doesn't reference it yet. */
+	int32 FindOrAddScalarParameter(const FHashedMaterialParameterInfo& ParameterInfo, float DefaultValue);
+
+	/** Returns the index of the vector parameter, adding it with the given default value if the set doesn't reference it yet. */
+	int32 FindOrAddVectorParameter(const FHashedMaterialParameterInfo& ParameterInfo, const FLinearColor& DefaultValue);
+
+	/** Writes the opcodes of the expression as the preshader of the next uniform scalar expression. */
+	void AddScalarPreshader(const FMaterialUniformExpression& Expression);
+
+	/** Writes the opcodes of the expression as the preshader of the next uniform vector expression. */
+	void AddVectorPreshader(const FMaterialUniformExpression& Expression);
+
+	/** Folds the constant parts of the preshaders and lets identical preshaders share their opcodes, once all preshaders were written. */
+	void OptimizePreshaders();
+
+	inline int32 GetNumScalarPreshaders() const { return UniformScalarPreshaders.Num(); }
+	inline int32 GetNumVectorPreshaders() const { return UniformVectorPreshaders.Num(); }
+
+	/**
+	 * Evaluates the uniform vector and scalar expressions, as FillUniformBuffer writes them to the uniform buffer.
+	 * @param bCacheParameters - whether parameters read by several preshaders are only looked up once through the render proxy, FillUniformBuffer always caches them
+	 */
+	void EvaluatePreshaders(const FMaterialRenderContext& MaterialRenderContext, TArrayView<FLinearColor> OutVectorValues, TArrayView<float> OutScalarValues, bool bCacheParameters = true) const;
+
 	// Get a combined hash of all referenced Texture2D's underlying RHI textures, going through TextureReferences. Can be used to tell if any texture has gone through texture streaming mip changes recently.
 	ENGINE_API uint32 GetReferencedTexture2DRHIHash(const FMaterialRenderContext& MaterialRenderContext) const;
 
@@ -1478,6 +1502,9 @@ public:
 		bStencilDitheredLOD = (CVarStencilDitheredLOD->GetValueOnAnyThread() != 0);
 #if UE_CHECK_FMATERIAL_LIFETIME
 		bOwnerBeginDestroyed = false;
+#endif
+#if WITH_EDITOR
+		LastFrameNeededForRendering = -1;
 #endif
 	}
 
@@ -1994,6 +2021,12 @@ private:
 	 * This can be used to access the shader map during async compiling, since GameThreadShaderMap will not have been set yet.
 	 */
 	TArray<int32, TInlineAllocator<1> > OutstandingCompileShaderMapIds;
+
+	/** 
+	 * Rendering thread frame in which this material was last reported to GShaderCompilingManager as drawn with a fallback.
+	 * Exchanged atomically by the rendering threads so that the material is reported once per frame.
+	 */
+	mutable volatile int32 LastFrameNeededForRendering;
 #endif // WITH_EDITOR
 
 	/** Quality level that this material is representing, may be EMaterialQualityLevel::Num if material doesn't depend on current quality level */
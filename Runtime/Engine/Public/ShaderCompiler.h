@@ -17,11 +17,14 @@
 #include "Templates/Atomic.h"
 #include "Templates/UniquePtr.h"
 #include "HAL/ThreadSafeCounter.h"
+#include "Containers/LockFreeList.h"
+#include "Misc/SecureHash.h"
 
 class FShaderCompileJob;
 class FShaderPipelineCompileJob;
 class FVertexFactoryType;
 class IDistributedBuildController;
+class FMaterial;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogShaderCompilers, Log, All);
 
@@ -42,12 +45,15 @@ public:
 	/** Output of the shader compile */
 	bool bSucceeded;
 	bool bOptimizeForLowLatency;
+	/** Time at which the job was added to the compile queue, used to measure the time taken to complete it. */
+	double QueuedTime;
 
 	FShaderCommonCompileJob(uint32 InId) :
 		Id(InId),
 		bFinalized(false),
 		bSucceeded(false),
-		bOptimizeForLowLatency(false)
+		bOptimizeForLowLatency(false),
+		QueuedTime(0.0)
 	{
 	}
 
@@ -85,6 +91,11 @@ public:
 	// List of pipelines that are sharing this job.
 	TMap<const FVertexFactoryType*, TArray<const FShaderPipelineType*>> SharingPipelines;
 
+	/** Hash of the shader files on disk the job includes, set when the job is added. Zero if the job can't be stored in the local job cache. */
+	FSHAHash SourceHash;
+	/** Hash of everything the compiled output depends on, set by the compile thread when looking for duplicate and cached jobs. */
+	FSHAHash InputHash;
+
 	FShaderCompileJob(uint32 InId, FVertexFactoryType* InVFType, FShaderType* InShaderType, int32 InPermutationId) :
 		FShaderCommonCompileJob(InId),
 		VFType(InVFType),
@@ -193,6 +204,35 @@ private:
 	/** Tracks the last time that this thread checked if the workers were still active. */
 	double LastCheckForWorkersTime;
 
+	/** A job being compiled along with the queued jobs that have the same input hash. */
+	struct FInFlightJob
+	{
+		const FShaderCommonCompileJob* Job;
+		TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>> DuplicateJobs;
+	};
+	/** Jobs being compiled keyed by their input hash, only accessed by this thread. */
+	TMap<FSHAHash, FInFlightJob> InFlightJobs;
+	/** Jobs completed from the local job cache or from a duplicate, waiting to be added to Manager->ShaderMapJobs. */
+	TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>> ResolvedJobs;
+	/** Serialized output of compiled jobs along with their input hash, waiting to be written to the local job cache. */
+	TArray<TPair<FSHAHash, TArray<uint8>>> JobCacheWrites;
+
+	/** Measurements of the jobs completed since all workers were last idle. */
+	struct FWorkerStats
+	{
+		/** Number of jobs completed, and the total and longest time from being queued to being completed. */
+		int32 NumJobs = 0;
+		double TotalJobLatency = 0.0;
+		double MaxJobLatency = 0.0;
+		/** Size of the worker input files written and the time spent serializing and writing them. */
+		int64 BytesWritten = 0;
+		double WriteTime = 0.0;
+		/** Size of the worker output files read and the time spent reading and deserializing them. */
+		int64 BytesRead = 0;
+		double ReadTime = 0.0;
+	};
+	FWorkerStats WorkerStats;
+
 public:
 	/** Initialization constructor. */
 	FShaderCompileThreadRunnable(class FShaderCompilingManager* InManager);
@@ -206,6 +246,15 @@ private:
 	 */
 	int32 PullTasksFromQueue();
 
+	/**
+	 * Removes the jobs that don't need compiling from new tasks in WorkerInfos.QueuedJobs, either because a job with the same input is already being compiled
+	 * or because the output is in the local job cache, and writes the output of compiled jobs to the local job cache.
+	 */
+	void ResolveDuplicateAndCachedJobs();
+
+	/** Adds the time taken to complete the job to WorkerStats. */
+	void AddJobLatency(const FShaderCommonCompileJob& Job);
+
 	/** Used when compiling through workers, writes out the worker inputs for any new tasks in WorkerInfos.QueuedJobs. */
 	void WriteNewTasks();
 
@@ -227,6 +276,12 @@ namespace FShaderCompileUtilities
 	bool DoWriteTasks(const TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>& QueuedJobs, FArchive& TransferFile);
 	void DoReadTaskResults(const TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>& QueuedJobs, FArchive& OutputFile);
 
+	/**
+	 * Reads the results of the jobs from a worker output file, mapping the file in memory where the platform supports it and reading it otherwise.
+	 * Returns the size of the file, or INDEX_NONE if it couldn't be opened.
+	 */
+	int64 ReadTaskResultsFile(const TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>& QueuedJobs, const FString& OutputFileName);
+
 	/** Execute the specified (single or pipeline) shader compile job. */
 	void ExecuteShaderCompileJob(FShaderCommonCompileJob& Job);
 }
@@ -462,6 +517,15 @@ private:
 	/** Critical section used to gain access to the variables above that are shared by both the main thread and the FShaderCompileThreadRunnable. */
 	FCriticalSection CompileQueueSection;
 
+	/** Materials the rendering threads had to replace with a fallback, pushed once per frame per material and drained by the main thread. */
+	TLockFreePointerListUnordered<const FMaterial, PLATFORM_CACHE_LINE_SIZE> RenderingFallbackMaterials;
+
+	/** Materials drained from RenderingFallbackMaterials whose jobs have not been moved ahead in CompileQueue yet. Only accessed on the main thread. */
+	TSet<const FMaterial*> PendingRenderingFallbackMaterials;
+
+	/** Last time the jobs of PendingRenderingFallbackMaterials were moved ahead in CompileQueue. */
+	double LastPrioritizeRenderingFallbackMaterialsTime;
+
 	//////////////////////////////////////////////////////
 	// Main thread state - These are only accessed on the main thread and used to track progress
 
@@ -535,6 +599,9 @@ private:
 	/** Finalizes the given Niagara shader map results and assigns the affected shader maps to Niagara scripts, while attempting to stay within an execution time budget. */
 	void ProcessCompiledNiagaraShaderMaps(TMap<int32, FShaderMapFinalizeResults>& CompiledShaderMaps, float TimeBudget);
 
+	/** Moves the queued jobs of the shader maps compiling for the materials reported by NotifyMaterialNeededForRendering ahead of the other normal latency jobs. */
+	void PrioritizeRenderingFallbackMaterials();
+
 	/** Propagate the completed compile to primitives that might be using the materials compiled. */
 	void PropagateMaterialChangesToPrimitives(const TMap<FMaterial*, class FMaterialShaderMap*>& MaterialsToUpdate);
 
@@ -632,6 +699,13 @@ public:
 	 */
 	ENGINE_API void AddJobs(TArray<TSharedRef<FShaderCommonCompileJob, ESPMode::ThreadSafe>>& NewJobs, bool bOptimizeForLowLatency, bool bRecreateComponentRenderStateOnCompletion, const FString MaterialBasePath, FString PermutationString = FString(""), bool bSkipResultProcessing = false);
 
+	/**
+	 * Notes that the rendering thread is drawing a fallback in place of the material because its shader map isn't available.
+	 * The jobs of the shader maps being compiled for the material are then compiled before the other normal latency jobs.
+	 * Can be called from any rendering thread.
+	 */
+	ENGINE_API void NotifyMaterialNeededForRendering(const FMaterial* Material);
+
 	/**
 	* Removes all outstanding compile jobs for the passed shader maps.
 	*/
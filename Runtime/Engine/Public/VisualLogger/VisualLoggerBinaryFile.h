@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EngineDefines.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/Queue.h"
+#include "VisualLogger/VisualLoggerTypes.h"
+
+#if ENABLE_VISUAL_LOG
+
+#define VISUAL_LOGGER_CHUNK_MAGIC_NUMBER 0xAFAFCACA
+#define VISUAL_LOGGER_INDEX_MAGIC_NUMBER 0xAFAF1D1D
+
+class FRunnableThread;
+class FEvent;
+
+/** Entries of one owner in a chunk of a binary vislog, stored as a column of the chunk */
+struct FVisualLogChunkOwner
+{
+	FName OwnerName;
+	TArray<FName> Categories;
+	float StartTime = 0.0f;
+	float EndTime = 0.0f;
+	uint32 Offset = 0u; // offset of the column in the uncompressed chunk
+	uint32 Size = 0u;
+};
+
+/**
+ * Chunk of a binary vislog, holding the entries logged over a time span grouped by owner.
+ * The file ends with the list of its chunks, so that readers can seek to a time range and owner without parsing the whole file.
+ */
+struct FVisualLogChunkInfo
+{
+	int64 PayloadOffset = 0; // offset of the chunk data in the file
+	int32 Version = EVisualLoggerVersion::LatestVersion;
+	float StartTime = 0.0f;
+	float EndTime = 0.0f;
+	TArray<FVisualLogChunkOwner> Owners;
+	bool bCompressed = false;
+	int32 UncompressedSize = 0;
+	int32 PayloadSize = 0;
+};
+
+struct ENGINE_API FVisualLoggerBinaryFile
+{
+	/** Writes the items as a chunk */
+	static void WriteChunk(FArchive& Ar, TArray<FVisualLogDevice::FVisualLogEntryItem>& Items, bool bCompress, FVisualLogChunkInfo& OutChunk);
+
+	/** Writes the list of chunks, it ends the file */
+	static void WriteIndex(FArchive& Ar, TArray<FVisualLogChunkInfo>& Chunks);
+
+	/** Reads all the items of the chunk at the archive position, after its tag */
+	static void ReadChunk(FArchive& Ar, TArray<FVisualLogDevice::FVisualLogEntryItem>& OutItems);
+
+	/** Reads the items of the chunk logged between StartTime and EndTime, only the ones of OwnerName unless it's NAME_None */
+	static void ReadChunkItems(FArchive& Ar, const FVisualLogChunkInfo& Chunk, float StartTime, float EndTime, FName OwnerName, TArray<FVisualLogDevice::FVisualLogEntryItem>& OutItems);
+};
+
+/**
+ * Writes the items of a recording as chunks of a binary vislog from a background thread,
+ * so that recording only costs the game thread a move of the items it logged.
+ */
+class ENGINE_API FVisualLoggerBinaryFileWriter final : public FRunnable
+{
+public:
+	FVisualLoggerBinaryFileWriter(FArchive& InFileArchive, bool bInCompress, float InChunkLength);
+	virtual ~FVisualLoggerBinaryFileWriter();
+
+	/** Queues items to be written, they must not be logged before the items already queued */
+	void Write(TArray<FVisualLogDevice::FVisualLogEntryItem>&& Items);
+
+	/** Writes the queued items and the index of the file, then stops the writer thread. Nothing is written after that. */
+	void Close();
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	// End FRunnable interface
+
+private:
+	void WriteQueuedItems(bool bFlush);
+	void WriteChunk();
+
+	FArchive& FileArchive;
+	TQueue<TArray<FVisualLogDevice::FVisualLogEntryItem>> QueuedItems;
+	TArray<FVisualLogDevice::FVisualLogEntryItem> ChunkItems;
+	TArray<FVisualLogChunkInfo> Chunks;
+
+	FRunnableThread* Thread;
+	FEvent* WorkEvent;
+	FThreadSafeCounter StopTaskCounter;
+	float ChunkLength;
+	bool bCompress;
+	bool bClosed;
+};
+
+/** Reads time ranges of the entries of a binary vislog through the index of its chunks */
+class ENGINE_API FVisualLoggerBinaryFileReader
+{
+public:
+	~FVisualLoggerBinaryFileReader();
+
+	/**
+	 * Opens a binary vislog and reads its index, or the headers of its chunks when the recording didn't finish.
+	 * @return false when the file can't be read or holds no chunks, e.g. files of older versions that must be loaded whole with FVisualLoggerHelpers::Serialize
+	 */
+	bool Open(const FString& Filename);
+	void Close();
+
+	const TArray<FVisualLogChunkInfo>& GetChunks() const { return Chunks; }
+
+	/** Reads the items logged between StartTime and EndTime in time order, only the ones of OwnerName unless it's NAME_None */
+	void ReadItems(float StartTime, float EndTime, FName OwnerName, TArray<FVisualLogDevice::FVisualLogEntryItem>& OutItems);
+
+private:
+	FArchive* FileArchive = nullptr;
+	TArray<FVisualLogChunkInfo> Chunks;
+};
+
+#endif //ENABLE_VISUAL_LOG